@@ -5,51 +5,51 @@
 #include "IResponseEvaluator.hpp"
 #include "IAdaptiveMethod.hpp"
 #include "IOutputFile.hpp"
+#include "PathTable.hpp"
 
 #include <av-speech-in-noise/Interface.hpp>
 
-#include <limits>
+#include <gsl/gsl>
+
 #include <memory>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace av_speech_in_noise {
-constexpr auto maximumInt{std::numeric_limits<int>::max()};
-constexpr auto minimumInt{std::numeric_limits<int>::min()};
-
-class Track {
-  public:
-    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(Track);
-    struct Settings {
-        const TrackingRule *rule{};
-        int startingX{};
-        int ceiling{maximumInt};
-        int floor{minimumInt};
-        int bumpLimit{maximumInt};
-    };
-    virtual void down() = 0;
-    virtual void up() = 0;
-    virtual auto x() -> int = 0;
-    virtual auto complete() -> bool = 0;
-    virtual auto reversals() -> int = 0;
-    virtual void reset() = 0;
-    virtual auto threshold(int reversals) -> double = 0;
-
-    class Factory {
-      public:
-        AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(Factory);
-        virtual auto make(const Settings &) -> std::shared_ptr<Track> = 0;
-    };
-};
-
 struct TargetPlaylistWithTrack {
     std::shared_ptr<TargetPlaylist> list;
     std::shared_ptr<Track> track;
 };
 
+// The indices of tracks still in progress. Removal, uniform access, the
+// next index in cyclic order and the least presented index are all cheap.
+class ActiveTracks {
+  public:
+    void reset(gsl::index tracks);
+    void remove(gsl::index track);
+    void presented(gsl::index track);
+    [[nodiscard]] auto contains(gsl::index track) const -> bool;
+    [[nodiscard]] auto size() const -> gsl::index;
+    [[nodiscard]] auto empty() const -> bool;
+    [[nodiscard]] auto at(gsl::index position) const -> gsl::index;
+    [[nodiscard]] auto after(gsl::index track) const -> gsl::index;
+    [[nodiscard]] auto leastPresented() const -> gsl::index;
+
+  private:
+    std::vector<gsl::index> tracks;
+    std::vector<gsl::index> position;
+    std::vector<gsl::index> next;
+    std::vector<gsl::index> previous;
+    std::vector<int> presentations;
+    std::set<std::pair<int, gsl::index>> byPresentations;
+};
+
 class AdaptiveMethodImpl : public AdaptiveMethod {
   public:
-    AdaptiveMethodImpl(Track::Factory &, ResponseEvaluator &, Randomizer &);
-    void initialize(const AdaptiveTest &, TargetPlaylistReader *) override;
+    AdaptiveMethodImpl(ResponseEvaluator &, Randomizer &);
+    void initialize(const AdaptiveTest &, TargetPlaylistReader *,
+        Track::Factory &) override;
     void submitIncorrectResponse() override;
     void submitCorrectResponse() override;
     void submit(const CorrectKeywords &) override;
@@ -61,27 +61,40 @@ class AdaptiveMethodImpl : public AdaptiveMethod {
     void writeTestingParameters(OutputFile &) override;
     void writeTestResult(OutputFile &) override;
     auto snr() -> SNR override;
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return std::nullopt;
+    }
+    auto trialPlan() -> const TrialPlan * override { return nullptr; }
     auto complete() -> bool override;
     auto nextTarget() -> LocalUrl override;
     auto currentTarget() -> LocalUrl override;
+    auto currentTargetFileName() -> std::string_view override;
+    auto currentTargetStem() -> std::string_view override;
     auto testResults() -> AdaptiveTestResults override;
+    auto currentTrackResult() -> std::optional<AdaptiveTestResult> override;
     void resetTracks() override;
 
   private:
     void selectNextList();
+    auto nextTrack() -> gsl::index;
+    void splitCurrentTarget();
 
     std::vector<TargetPlaylistWithTrack> targetListsWithTracks{};
+    ActiveTracks activeTracks;
+    gsl::index currentTrack{};
     coordinate_response_measure::AdaptiveTrial
         lastCoordinateResponseMeasureTrial{};
     open_set::AdaptiveTrial lastOpenSetTrial{};
     CorrectKeywordsTrial lastCorrectKeywordsTrial{};
     const AdaptiveTest *test{};
-    Track::Factory &snrTrackFactory;
     ResponseEvaluator &evaluator;
     Randomizer &randomizer;
+    PathTable currentTargetPaths;
+    PathTable::Handle currentTargetPath{};
     Track *snrTrack{};
     TargetPlaylist *targetList{};
     int thresholdReversals{};
+    TrackSelection trackSelection{};
 };
 }
 
@@ -6,6 +6,16 @@
 #include <memory>
 
 namespace adaptive_track {
+// The reversals so far of the rule sequence a track is on. The mean and
+// standard deviation are NaN when there are too few reversals.
+struct RunStatistics {
+    int stepSize{};
+    int reversals{};
+    int reversalsRemaining{};
+    double mean{};
+    double standardDeviation{};
+};
+
 class AdaptiveTrack : public av_speech_in_noise::Track {
   public:
     explicit AdaptiveTrack(const Settings &);
@@ -16,6 +26,9 @@ class AdaptiveTrack : public av_speech_in_noise::Track {
     auto reversals() -> int override;
     void reset() override;
     auto threshold(int reversals) -> double override;
+    auto thresholdStandardDeviation(int reversals) -> double override;
+    auto stoppingReason() -> av_speech_in_noise::TrackStoppingReason override;
+    [[nodiscard]] auto currentRun() const -> RunStatistics;
 
     class Factory : public Track::Factory {
         auto make(const Settings &s) -> std::shared_ptr<Track> override {
@@ -38,12 +51,16 @@ class AdaptiveTrack : public av_speech_in_noise::Track {
     void updateReversals(Step);
     void reversal();
     auto complete_() const -> bool;
+    auto converged() const -> bool;
 
     std::vector<int> runCounts;
     std::vector<int> stepSizes;
     std::vector<int> up_;
     std::vector<int> down_;
-    std::vector<int> reversalX;
+    // Running sums of the x and x squared at each reversal, starting with
+    // zero, so statistics over the last reversals take constant time.
+    std::vector<long long> reversalSums;
+    std::vector<long long> reversalSquareSums;
     std::size_t sequenceIndex{};
     int startingX_;
     int x_;
@@ -51,6 +68,8 @@ class AdaptiveTrack : public av_speech_in_noise::Track {
     int floor_;
     int bumpLimit_;
     int bumpCount_;
+    int convergenceReversals_;
+    double convergenceStandardErrorDb_;
     int sameDirectionConsecutiveCount{};
     int runCounter{};
     int reversals_{};
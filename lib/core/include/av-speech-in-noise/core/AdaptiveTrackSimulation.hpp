@@ -0,0 +1,53 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_ADAPTIVETRACKSIMULATIONHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_ADAPTIVETRACKSIMULATIONHPP_
+
+#include "AdaptiveMethod.hpp"
+#include "PsychometricFunction.hpp"
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <cstdint>
+
+namespace av_speech_in_noise {
+// The level where the next step of a tracking sequence is as likely to be
+// down as up, e.g. 70.7% correct for 1-up 2-down. NaN when the function
+// never reaches that probability.
+auto convergenceLevel(const PsychometricFunction &, const TrackingSequence &)
+    -> double;
+
+// What a track's threshold estimates. An up-down staircase converges on
+// the level its last tracking sequence targets; Psi estimates the
+// listener's threshold itself.
+enum class SimulatedThreshold { convergenceLevel, listenerThreshold };
+
+struct AdaptiveTrackSimulationSettings {
+    AdaptiveTest test;
+    PsychometricFunction listener;
+    SimulatedThreshold estimates{SimulatedThreshold::convergenceLevel};
+    gsl::index tracks{10000};
+    gsl::index maximumTrialsPerTrack{1000};
+    unsigned threads{1};
+    std::uint64_t seed{};
+};
+
+struct AdaptiveTrackSimulationResult {
+    gsl::index tracks{};
+    gsl::index incompleteTracks{};
+    double convergenceLevel{};
+    double expectedThreshold{};
+    double meanThreshold{};
+    double bias{};
+    double thresholdVariance{};
+    double meanTrials{};
+    double trialsStandardDeviation{};
+    int maximumTrials{};
+};
+
+// Results depend only on the settings, not on the number of threads.
+auto simulate(Track::Factory &, const AdaptiveTrackSimulationSettings &)
+    -> AdaptiveTrackSimulationResult;
+}
+
+#endif
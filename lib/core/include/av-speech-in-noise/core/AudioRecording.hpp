@@ -21,7 +21,7 @@ class AudioRecorder {
 class AudioRecording : public RunningATest::TestObserver {
   public:
     AudioRecording(AudioRecorder &, OutputFile &, TimeStamp &);
-    void notifyThatNewTestIsReady(std::string_view session) override;
+    void notifyThatNewTestIsReady(const Test &) override;
     void notifyThatTrialWillBegin(int trialNumber) override;
     void notifyThatTargetWillPlayAt(const PlayerTimeWithDelay &) override;
     void notifyThatStimulusHasEnded() override;
@@ -0,0 +1,72 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_CLOCKSYNCHRONIZATIONHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_CLOCKSYNCHRONIZATIONHPP_
+
+#include "IMaskerPlayer.hpp"
+#include "Player.hpp"
+
+#include <av-speech-in-noise/Interface.hpp>
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+class EyeTracker;
+
+class ClockSynchronization {
+  public:
+    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(
+        ClockSynchronization);
+    virtual void start() = 0;
+    virtual void stop() = 0;
+    virtual auto model() -> EyeTrackerTargetPlayerClockModel = 0;
+};
+
+// The eye tracker clock is read immediately before and after the target
+// player clock so that the round trip bounds the uncertainty of the pair.
+struct EyeTrackerTargetPlayerClockSample {
+    EyeTrackerSystemTime eyeTrackerSystemTimeBefore{};
+    TargetPlayerSystemTime targetPlayerSystemTime{};
+    EyeTrackerSystemTime eyeTrackerSystemTimeAfter{};
+};
+
+auto fit(gsl::span<const EyeTrackerTargetPlayerClockSample>)
+    -> EyeTrackerTargetPlayerClockModel;
+
+auto eyeTrackerSystemTime(const EyeTrackerTargetPlayerClockModel &,
+    TargetPlayerSystemTime) -> EyeTrackerSystemTime;
+
+class ClockSynchronizationImpl : public ClockSynchronization {
+  public:
+    struct Settings {
+        Duration samplingPeriod{0.005};
+        gsl::index capacity{4000};
+    };
+    ClockSynchronizationImpl(EyeTracker &, MaskerPlayer &);
+    ClockSynchronizationImpl(EyeTracker &, MaskerPlayer &, const Settings &);
+    ~ClockSynchronizationImpl() override;
+    void start() override;
+    void stop() override;
+    auto model() -> EyeTrackerTargetPlayerClockModel override;
+    void sample();
+
+  private:
+    void run();
+
+    Settings settings;
+    std::vector<EyeTrackerTargetPlayerClockSample> samples;
+    std::mutex mutex;
+    std::condition_variable stopRequested;
+    std::thread thread;
+    EyeTracker &eyeTracker;
+    MaskerPlayer &maskerPlayer;
+    gsl::index next{};
+    bool running{};
+};
+}
+
+#endif
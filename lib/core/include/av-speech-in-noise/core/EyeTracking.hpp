@@ -1,6 +1,8 @@
 #ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_EYETRACKINGHPP_
 #define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_EYETRACKINGHPP_
 
+#include "ClockSynchronization.hpp"
+#include "GazeAnalytics.hpp"
 #include "IMaskerPlayer.hpp"
 #include "IOutputFile.hpp"
 #include "IRunningATest.hpp"
@@ -21,14 +23,17 @@ class EyeTracker : public Writable {
 
 class EyeTracking : public RunningATest::TestObserver {
   public:
-    EyeTracking(EyeTracker &, MaskerPlayer &, TargetPlayer &, OutputFile &);
-    void notifyThatNewTestIsReady(std::string_view session) override;
+    EyeTracking(EyeTracker &, MaskerPlayer &, TargetPlayer &, OutputFile &,
+        ClockSynchronization &);
+    void notifyThatNewTestIsReady(const Test &) override;
     void notifyThatTrialWillBegin(int trialNumber) override;
     void notifyThatTargetWillPlayAt(const PlayerTimeWithDelay &) override;
     void notifyThatStimulusHasEnded() override;
     void notifyThatSubjectHasResponded() override;
 
   private:
+    GazeAnalytics gazeAnalytics;
+    GazeFilterSettings gazeFilterSettings{};
     EyeTrackerTargetPlayerSynchronization
         lastEyeTrackerTargetPlayerSynchronization{};
     TargetStartTime lastTargetStartTime{};
@@ -36,6 +41,7 @@ class EyeTracking : public RunningATest::TestObserver {
     MaskerPlayer &maskerPlayer;
     TargetPlayer &targetPlayer;
     OutputFile &outputFile;
+    ClockSynchronization &clockSynchronization;
 };
 }
 
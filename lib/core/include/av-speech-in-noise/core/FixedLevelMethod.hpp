@@ -3,6 +3,8 @@
 
 #include "IResponseEvaluator.hpp"
 #include "IFixedLevelMethod.hpp"
+#include "PathTable.hpp"
+#include "TrialPlan.hpp"
 
 #include <av-speech-in-noise/core/IOutputFile.hpp>
 
@@ -22,12 +24,18 @@ class FixedLevelMethodImpl : public FixedLevelMethod {
     void writeTestingParameters(OutputFile &) override;
     void writeTestResult(OutputFile &) override {}
     auto snr() -> SNR override;
+    auto maskerSeekFraction() -> std::optional<double> override;
+    auto trialPlan() -> const TrialPlan * override;
     auto nextTarget() -> LocalUrl override;
     auto currentTarget() -> LocalUrl override;
+    auto currentTargetFileName() -> std::string_view override;
+    auto currentTargetStem() -> std::string_view override;
     auto complete() -> bool override;
     auto keywordsTestResults() -> KeywordsTestResults override;
 
   private:
+    void splitCurrentTarget();
+
     coordinate_response_measure::FixedLevelTrial
         lastCoordinateResponseMeasureTrial{};
     const FixedLevelTest *test_{};
@@ -35,12 +43,16 @@ class FixedLevelMethodImpl : public FixedLevelMethod {
     FiniteTargetPlaylist *finiteTargetPlaylist{};
     FiniteTargetPlaylistWithRepeatables *finiteTargetPlaylistWithRepeatables{};
     ResponseEvaluator &evaluator;
+    TrialPlanPlaylist plannedTargets;
+    PathTable currentTargetPaths;
+    PathTable::Handle currentTargetPath{};
     SNR snr_{};
     int totalKeywordsCorrect_{};
     int totalKeywordsSubmitted_{};
     int trials_{};
     bool finiteTargetsExhausted_{};
     bool usingFiniteTargetPlaylist_{};
+    bool usingTrialPlan_{};
 };
 }
 
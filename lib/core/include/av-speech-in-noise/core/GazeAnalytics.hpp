@@ -0,0 +1,72 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_GAZEANALYTICSHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_GAZEANALYTICSHPP_
+
+#include "Player.hpp"
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <cstdint>
+
+namespace av_speech_in_noise {
+// Keeps running per-trial gaze statistics so that a summary is available as
+// soon as the last chunk of samples has been added.
+class GazeAnalytics {
+  public:
+    struct Settings {
+        // (max x - min x) + (max y - min y), in relative screen units
+        double maximumFixationDispersion{0.05};
+        Duration minimumFixationDuration{0.1};
+        Duration minimumBlinkDuration{0.075};
+        Duration maximumBlinkDuration{0.5};
+    };
+    GazeAnalytics();
+    explicit GazeAnalytics(const Settings &);
+    void reset();
+    void add(const BinocularGazeSample &);
+    void add(const BinocularGazeSamples &);
+    [[nodiscard]] auto statistics() const -> BinocularGazeStatistics;
+
+    struct RunningEyeStatistics {
+        gsl::index valid{};
+        double meanX{};
+        double meanY{};
+        double sumOfSquaredDeviationsX{};
+        double sumOfSquaredDeviationsY{};
+    };
+
+    struct FixationWindow {
+        Point2D minimum{};
+        Point2D maximum{};
+        std::int_least64_t firstMicroseconds{};
+        std::int_least64_t lastMicroseconds{};
+        bool open{};
+    };
+
+    struct InvalidRun {
+        std::int_least64_t firstMicroseconds{};
+        std::int_least64_t lastMicroseconds{};
+        bool open{};
+    };
+
+  private:
+    void addToFixationWindow(Point2D, std::int_least64_t microseconds);
+    void closeFixationWindow();
+    void closeInvalidRun(std::int_least64_t microseconds);
+
+    Settings settings;
+    RunningEyeStatistics left{};
+    RunningEyeStatistics right{};
+    FixationWindow fixationWindow{};
+    InvalidRun invalidRun{};
+    std::int_least64_t lastValidMicroseconds{};
+    gsl::index samples{};
+    int fixations{};
+    int blinks{};
+    int gaps{};
+    bool anyValid{};
+};
+}
+
+#endif
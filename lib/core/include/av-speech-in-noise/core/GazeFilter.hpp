@@ -0,0 +1,18 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_GAZEFILTERHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_GAZEFILTERHPP_
+
+#include <av-speech-in-noise/Model.hpp>
+
+namespace av_speech_in_noise {
+// Low-pass filters then keeps every Nth sample so that the output rate is
+// as close to outputRateHz as the input rate allows.
+auto decimate(const BinocularGazeSamples &, double outputRateHz)
+    -> BinocularGazeSamples;
+
+auto smooth(const BinocularGazeSamples &) -> BinocularGazeSamples;
+
+auto filter(const BinocularGazeSamples &, const GazeFilterSettings &)
+    -> BinocularGazeSamples;
+}
+
+#endif
@@ -3,10 +3,44 @@
 
 #include "TargetPlaylist.hpp"
 #include "TestMethod.hpp"
+#include <limits>
 #include <vector>
 #include <memory>
+#include <optional>
 
 namespace av_speech_in_noise {
+constexpr auto maximumInt{std::numeric_limits<int>::max()};
+constexpr auto minimumInt{std::numeric_limits<int>::min()};
+
+class Track {
+  public:
+    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(Track);
+    struct Settings {
+        const TrackingRule *rule{};
+        int startingX{};
+        int ceiling{maximumInt};
+        int floor{minimumInt};
+        int bumpLimit{maximumInt};
+        int convergenceReversals{};
+        double convergenceStandardErrorDb{};
+    };
+    virtual void down() = 0;
+    virtual void up() = 0;
+    virtual auto x() -> int = 0;
+    virtual auto complete() -> bool = 0;
+    virtual auto reversals() -> int = 0;
+    virtual void reset() = 0;
+    virtual auto threshold(int reversals) -> double = 0;
+    virtual auto thresholdStandardDeviation(int reversals) -> double = 0;
+    virtual auto stoppingReason() -> TrackStoppingReason = 0;
+
+    class Factory {
+      public:
+        AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(Factory);
+        virtual auto make(const Settings &) -> std::shared_ptr<Track> = 0;
+    };
+};
+
 class TargetPlaylistReader {
   public:
     AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(TargetPlaylistReader);
@@ -16,9 +50,12 @@ class TargetPlaylistReader {
 
 class AdaptiveMethod : public virtual TestMethod {
   public:
-    virtual void initialize(const AdaptiveTest &, TargetPlaylistReader *) = 0;
+    virtual void initialize(
+        const AdaptiveTest &, TargetPlaylistReader *, Track::Factory &) = 0;
     virtual void resetTracks() = 0;
     virtual auto testResults() -> AdaptiveTestResults = 0;
+    // The result so far of the track of the next trial, when it has one.
+    virtual auto currentTrackResult() -> std::optional<AdaptiveTestResult> = 0;
     using TestMethod::submit;
     virtual void submit(const CorrectKeywords &) = 0;
     virtual void writeLastCorrectKeywords(OutputFile &) = 0;
@@ -12,6 +12,9 @@
 #include <string>
 
 namespace av_speech_in_noise {
+struct TrialPlan;
+struct TrialPlanAmendment;
+
 struct Target {
     std::string target;
 };
@@ -75,6 +78,10 @@ struct KeyPressTrial : KeyPressResponse, open_set::Trial {
 
 struct PassFailTrial : Evaluative, Target {};
 
+struct MaskerSeek {
+    double seconds{};
+};
+
 class Writable {
   public:
     AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(Writable);
@@ -97,10 +104,15 @@ class OutputFile {
     virtual void write(const EmotionTrial &) = 0;
     virtual void write(const AdaptiveTest &) = 0;
     virtual void write(const FixedLevelTest &) = 0;
+    virtual void write(const TrialPlan &) = 0;
+    virtual void write(const TrialPlanAmendment &) = 0;
     virtual void write(const AdaptiveTestResults &) = 0;
     virtual void write(const BinocularGazeSamples &) = 0;
+    virtual void write(const BinocularGazeStatistics &) = 0;
     virtual void write(TargetStartTime) = 0;
+    virtual void write(MaskerSeek) = 0;
     virtual void write(const EyeTrackerTargetPlayerSynchronization &) = 0;
+    virtual void write(const EyeTrackerTargetPlayerClockModel &) = 0;
     virtual void write(const ThreeKeywordsTrial &) = 0;
     virtual void write(const SyllableTrial &) = 0;
     virtual void write(const PassFailTrial &) = 0;
@@ -4,18 +4,18 @@
 #include <av-speech-in-noise/Interface.hpp>
 #include <av-speech-in-noise/Model.hpp>
 
-#include <string>
+#include <string_view>
 
 namespace av_speech_in_noise {
+// Evaluates against the stem of the target, as split by the test method.
 class ResponseEvaluator {
   public:
     AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(ResponseEvaluator);
-    virtual auto correct(const LocalUrl &,
+    virtual auto correct(std::string_view targetStem,
         const coordinate_response_measure::Response &) -> bool = 0;
-    virtual auto correctColor(const LocalUrl &)
+    virtual auto correctColor(std::string_view targetStem)
         -> coordinate_response_measure::Color = 0;
-    virtual auto correctNumber(const LocalUrl &) -> int = 0;
-    virtual auto fileName(const LocalUrl &) -> std::string = 0;
+    virtual auto correctNumber(std::string_view targetStem) -> int = 0;
 };
 }
 
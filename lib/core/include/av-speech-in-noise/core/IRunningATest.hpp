@@ -27,7 +27,7 @@ class RunningATest {
     class TestObserver {
       public:
         AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(TestObserver);
-        virtual void notifyThatNewTestIsReady(std::string_view /*session*/) {}
+        virtual void notifyThatNewTestIsReady(const Test &) {}
         virtual void notifyThatTrialWillBegin(int /*trialNumber*/) {}
         virtual void notifyThatTargetWillPlayAt(const PlayerTimeWithDelay &) {}
         virtual void notifyThatStimulusHasEnded() {}
@@ -49,6 +49,7 @@ class RunningATest {
     virtual auto targetFileName() -> std::string = 0;
     virtual void prepareNextTrialIfNeeded() = 0;
     virtual auto playTrialTime() -> std::string = 0;
+    virtual auto method() -> const TestMethod * = 0;
     static constexpr Duration targetOnsetFringeDuration{0.166};
 };
 }
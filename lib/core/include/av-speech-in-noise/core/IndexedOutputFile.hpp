@@ -0,0 +1,73 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_INDEXEDOUTPUTFILEHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_INDEXEDOUTPUTFILEHPP_
+
+#include "IOutputFile.hpp"
+#include "ResultsStore.hpp"
+
+#include <filesystem>
+#include <ios>
+#include <optional>
+#include <string>
+
+namespace av_speech_in_noise {
+// Writes everything to the decorated file and also records tests, trials,
+// and thresholds in a results store kept next to it in the output
+// directory. Records that other instances append to the same store are
+// read before each append. Trials of a fixed level test are recorded at
+// the test's SNR.
+class IndexedOutputFile : public OutputFile {
+  public:
+    explicit IndexedOutputFile(OutputFile &);
+    void openNewFile(const TestIdentity &) override;
+    void write(const coordinate_response_measure::AdaptiveTrial &) override;
+    void write(const coordinate_response_measure::FixedLevelTrial &) override;
+    void write(const FreeResponseTrial &) override;
+    void write(const KeyPressTrial &) override;
+    void write(const CorrectKeywordsTrial &) override;
+    void write(const open_set::AdaptiveTrial &) override;
+    void write(const ConsonantTrial &) override;
+    void write(const EmotionTrial &) override;
+    void write(const AdaptiveTest &) override;
+    void write(const FixedLevelTest &) override;
+    void write(const TrialPlan &) override;
+    void write(const TrialPlanAmendment &) override;
+    void write(const AdaptiveTestResults &) override;
+    void write(const BinocularGazeSamples &) override;
+    void write(const BinocularGazeStatistics &) override;
+    void write(TargetStartTime) override;
+    void write(MaskerSeek) override;
+    void write(const EyeTrackerTargetPlayerSynchronization &) override;
+    void write(const EyeTrackerTargetPlayerClockModel &) override;
+    void write(const ThreeKeywordsTrial &) override;
+    void write(const SyllableTrial &) override;
+    void write(const PassFailTrial &) override;
+    void write(Writable &) override;
+    void close() override;
+    void save() override;
+    auto parentPath() -> std::filesystem::path override;
+    [[nodiscard]] auto store() const -> const ResultsStore &;
+
+    static constexpr auto storeFileName{"results-index.tsv"};
+
+  private:
+    void add(TestRecord, const Test &);
+    void add(const Target &, std::optional<bool> correct = std::nullopt,
+        std::optional<double> reactionTimeMilliseconds = std::nullopt,
+        std::optional<int> snr_dB = std::nullopt);
+    void flush();
+    void readNewRecords();
+
+    ResultsStore store_;
+    std::filesystem::path directory;
+    OutputFile &file;
+    std::optional<std::string> currentTest;
+    std::optional<int> fixedLevelSnr_dB;
+    std::streamoff readOffset{};
+};
+
+// Reads the results store of every output directory below a directory,
+// so that a lab can query all of its results at once.
+void readResultsStores(ResultsStore &, const std::filesystem::path &);
+}
+
+#endif
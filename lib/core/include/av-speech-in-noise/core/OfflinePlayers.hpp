@@ -0,0 +1,98 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OFFLINEPLAYERSHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OFFLINEPLAYERSHPP_
+
+#include "IMaskerPlayer.hpp"
+#include "ITargetPlayer.hpp"
+#include "VirtualTime.hpp"
+
+#include <av-speech-in-noise/Interface.hpp>
+
+#include <string>
+#include <vector>
+
+namespace av_speech_in_noise {
+struct StimulusDescription {
+    Duration duration{};
+    DigitalLevel digitalLevel{};
+};
+
+class StimulusDescriptions {
+  public:
+    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(StimulusDescriptions);
+    // Throws InvalidAudioFile when the file can't be read.
+    virtual auto describe(const LocalUrl &) -> StimulusDescription = 0;
+};
+
+// Players that render nothing and report each event at the virtual time
+// a device would have: pre-roll at once, fade-in after the ramp, the
+// target at its scheduled start and fade-out after the steady level.
+class OfflineTargetPlayer : public TargetPlayer {
+  public:
+    OfflineTargetPlayer(VirtualTime &, StimulusDescriptions &);
+    void attach(Observer *) override;
+    void setAudioDevice(std::string) override {}
+    void play() override;
+    void playAt(const PlayerTimeWithDelay &) override;
+    auto playing() -> bool override;
+    void loadFile(const LocalUrl &, RationalNumber videoScale) override;
+    void hideVideo() override {}
+    void showVideo() override {}
+    auto digitalLevel() -> DigitalLevel override;
+    void apply(LevelAmplification) override {}
+    auto duration() -> Duration override;
+    void useAllChannels() override {}
+    void useFirstChannelOnly() override {}
+    void preRoll() override;
+
+  private:
+    void playAfter(Duration);
+
+    StimulusDescription stimulus;
+    VirtualTime &time;
+    StimulusDescriptions &stimuli;
+    Observer *observer{};
+    bool playing_{};
+};
+
+class OfflineMaskerPlayer : public MaskerPlayer {
+  public:
+    OfflineMaskerPlayer(VirtualTime &, StimulusDescriptions &,
+        Duration rampDuration = Duration{0.02}, double sampleRateHz = 48000);
+    void attach(Observer *) override;
+    auto outputAudioDeviceDescriptions() -> std::vector<std::string> override;
+    void setAudioDevice(std::string) override {}
+    void fadeIn() override;
+    void loadFile(const LocalUrl &) override;
+    auto digitalLevel() -> DigitalLevel override;
+    void apply(LevelAmplification) override {}
+    auto duration() -> Duration override;
+    auto sampleRateHz() -> double override;
+    void seekSeconds(double) override {}
+    auto rampDuration() -> Duration override;
+    void useAllChannels() override {}
+    void useFirstChannelOnly() override {}
+    void useSecondChannelOnly() override {}
+    void clearChannelDelays() override {}
+    void setChannelDelaySeconds(gsl::index, double) override {}
+    void enableVibrotactileStimulus() override {}
+    void disableVibrotactileStimulus() override {}
+    auto nanoseconds(PlayerTime) -> std::uintmax_t override;
+    auto currentSystemTime() -> PlayerTime override;
+    void play() override {}
+    void stop() override {}
+    void setSteadyLevelFor(Duration) override;
+
+    static constexpr auto audioDevice{"offline"};
+
+  private:
+    StimulusDescription stimulus;
+    VirtualTime &time;
+    StimulusDescriptions &stimuli;
+    Observer *observer{};
+    Duration rampDuration_;
+    Duration steadyLevelDuration{};
+    double sampleRateHz_;
+};
+}
+
+#endif
@@ -47,6 +47,22 @@ enum class HeadingItem {
     vibrotactileDuration,
     vibrotactileDelay,
     emotion,
+    leftGazeValidPercent,
+    rightGazeValidPercent,
+    leftMeanGazePositionRelativeScreen,
+    rightMeanGazePositionRelativeScreen,
+    leftGazePositionRelativeScreenStandardDeviation,
+    rightGazePositionRelativeScreenStandardDeviation,
+    fixations,
+    blinks,
+    gaps,
+    clockReference,
+    eyeTrackerTimeAtClockReference,
+    clockDrift,
+    clockResidualStandardDeviation,
+    clockSamples,
+    trialNumber,
+    maskerSeekFraction,
 };
 
 constexpr auto name(HeadingItem i) -> const char * {
@@ -125,6 +141,38 @@ constexpr auto name(HeadingItem i) -> const char * {
         return "valid left gaze origin relative tracker";
     case HeadingItem::rightGazeOriginRelativeTrackerIsValid:
         return "valid right gaze origin relative tracker";
+    case HeadingItem::leftGazeValidPercent:
+        return "valid left gaze (%)";
+    case HeadingItem::rightGazeValidPercent:
+        return "valid right gaze (%)";
+    case HeadingItem::leftMeanGazePositionRelativeScreen:
+        return "left mean gaze position relative screen [x y]";
+    case HeadingItem::rightMeanGazePositionRelativeScreen:
+        return "right mean gaze position relative screen [x y]";
+    case HeadingItem::leftGazePositionRelativeScreenStandardDeviation:
+        return "left gaze position relative screen SD [x y]";
+    case HeadingItem::rightGazePositionRelativeScreenStandardDeviation:
+        return "right gaze position relative screen SD [x y]";
+    case HeadingItem::fixations:
+        return "fixations";
+    case HeadingItem::blinks:
+        return "blinks";
+    case HeadingItem::gaps:
+        return "gaps";
+    case HeadingItem::clockReference:
+        return "clock reference target player time (ns)";
+    case HeadingItem::eyeTrackerTimeAtClockReference:
+        return "eye tracker time at clock reference (us)";
+    case HeadingItem::clockDrift:
+        return "clock drift (ppm)";
+    case HeadingItem::clockResidualStandardDeviation:
+        return "clock fit residual SD (us)";
+    case HeadingItem::clockSamples:
+        return "clock fit samples";
+    case HeadingItem::trialNumber:
+        return "trial";
+    case HeadingItem::maskerSeekFraction:
+        return "masker seek fraction";
     }
 }
 
@@ -286,6 +334,8 @@ class OutputFileImpl : public OutputFile {
     void save() override;
     void write(const AdaptiveTest &) override;
     void write(const FixedLevelTest &) override;
+    void write(const TrialPlan &) override;
+    void write(const TrialPlanAmendment &) override;
     void write(const coordinate_response_measure::AdaptiveTrial &) override;
     void write(const open_set::AdaptiveTrial &) override;
     void write(const coordinate_response_measure::FixedLevelTrial &) override;
@@ -296,8 +346,11 @@ class OutputFileImpl : public OutputFile {
     void write(const ThreeKeywordsTrial &) override;
     void write(const AdaptiveTestResults &) override;
     void write(const BinocularGazeSamples &) override;
+    void write(const BinocularGazeStatistics &) override;
     void write(TargetStartTime) override;
+    void write(MaskerSeek) override;
     void write(const EyeTrackerTargetPlayerSynchronization &) override;
+    void write(const EyeTrackerTargetPlayerClockModel &) override;
     void write(const SyllableTrial &) override;
     void write(const KeyPressTrial &) override;
     void write(const PassFailTrial &) override;
@@ -0,0 +1,102 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OUTPUTFILEPARSERHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OUTPUTFILEPARSERHPP_
+
+#include "OutputFile.hpp"
+
+#include <av-speech-in-noise/Interface.hpp>
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <array>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+namespace av_speech_in_noise {
+enum class OutputFileTrialType {
+    fixedLevelCoordinateResponse,
+    adaptiveCoordinateResponse,
+    freeResponse,
+    openSetAdaptive,
+    correctKeywords,
+    consonant,
+    threeKeywords,
+    syllable,
+    keyPress,
+    emotion,
+    passFail
+};
+
+// Fields view the parsed contents and are only valid while they are.
+struct ParsedLabeledLine {
+    std::string_view label;
+    std::string_view value;
+};
+
+struct ParsedThreshold {
+    std::string_view targetsUrl;
+    double threshold{};
+};
+
+struct ParsedTrial {
+    static constexpr auto maximumFields{7};
+    OutputFileTrialType type{};
+    gsl::span<const HeadingItem> columns;
+    std::array<std::string_view, maximumFields> fields{};
+    bool flagged{};
+
+    [[nodiscard]] auto field(HeadingItem) const
+        -> std::optional<std::string_view>;
+    [[nodiscard]] auto number(HeadingItem) const -> std::optional<double>;
+    [[nodiscard]] auto correct() const -> std::optional<bool>;
+};
+
+class OutputFileParseObserver {
+  public:
+    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(
+        OutputFileParseObserver);
+    virtual void labeledLine(const ParsedLabeledLine &) {}
+    virtual void threshold(const ParsedThreshold &) {}
+    virtual void targetStartTime(TargetStartTime) {}
+    virtual void maskerSeek(MaskerSeek) {}
+    virtual void trial(const ParsedTrial &) {}
+    virtual void gazeSample(const BinocularGazeSample &) {}
+    virtual void gazeStatistics(const BinocularGazeStatistics &) {}
+    virtual void synchronization(
+        const EyeTrackerTargetPlayerSynchronization &) {}
+    virtual void clockModel(const EyeTrackerTargetPlayerClockModel &) {}
+};
+
+// Parses text written by OutputFileImpl without copying it. Lines that
+// cannot be attributed to any known record are skipped.
+void parse(std::string_view contents, OutputFileParseObserver &);
+
+// Read-only memory mapping of a whole file.
+class MappedFile {
+  public:
+    class OpenFailure {};
+    explicit MappedFile(const std::filesystem::path &);
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    auto operator=(const MappedFile &) -> MappedFile & = delete;
+    MappedFile(MappedFile &&) = delete;
+    auto operator=(MappedFile &&) -> MappedFile & = delete;
+    [[nodiscard]] auto contents() const -> std::string_view;
+
+  private:
+    void *data{};
+    std::size_t size{};
+};
+
+// Maps and parses each file on one of up to `threads` workers. Each file
+// is reported to the observer returned for its index, which must not be
+// shared with another file being parsed concurrently. The first failure
+// is rethrown once every worker has finished.
+void parse(gsl::span<const std::filesystem::path> files,
+    const std::function<OutputFileParseObserver &(gsl::index)> &observer,
+    unsigned threads);
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OUTPUTFILEREPLAYHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OUTPUTFILEREPLAYHPP_
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <string_view>
+#include <vector>
+
+namespace av_speech_in_noise {
+struct ReplayableTrial {
+    int trialNumber{};
+    LocalUrl target;
+    SNR snr{};
+    double maskerSeekSeconds{};
+};
+
+struct ReplayableSession {
+    LocalUrl masker;
+    RealLevel maskerLevel{};
+    std::vector<ReplayableTrial> trials;
+};
+
+// What is needed to reconstruct each trial's stimulus. Only trials with a
+// target column and a logged masker seek are included. Bare target names
+// are resolved against the test's targets directory.
+auto replayableSession(std::string_view contents) -> ReplayableSession;
+}
+
+#endif
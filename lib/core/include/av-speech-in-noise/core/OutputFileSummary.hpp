@@ -0,0 +1,43 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OUTPUTFILESUMMARYHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_OUTPUTFILESUMMARYHPP_
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace av_speech_in_noise {
+// One test of an output file. A file holds a test for each time a test
+// was started while it was open, and each is summarized on its own.
+struct OutputFileSummary {
+    std::filesystem::path file;
+    std::string subjectId;
+    std::string session;
+    std::string method;
+    gsl::index trials{};
+    gsl::index evaluatedTrials{};
+    gsl::index correctTrials{};
+    int keywordsCorrect{};
+    std::vector<double> reactionTimesMilliseconds;
+    AdaptiveTestResults thresholds;
+};
+
+// Trials written before any test heading are summarized as a test of
+// their own.
+auto summarize(std::string_view contents) -> std::vector<OutputFileSummary>;
+
+// Summarizes every test of every ".txt" file below the directory, in path
+// order.
+auto summarize(const std::filesystem::path &directory, unsigned threads)
+    -> std::vector<OutputFileSummary>;
+
+// One tab-separated row per test, preceded by a heading row.
+void writeSummaryTable(std::ostream &, const std::vector<OutputFileSummary> &);
+}
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_PATHTABLEHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_PATHTABLEHPP_
+
+#include <gsl/gsl>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace av_speech_in_noise {
+// These follow std::filesystem::path for '/' separated paths without
+// constructing one.
+auto fileName(std::string_view path) -> std::string_view;
+auto stem(std::string_view path) -> std::string_view;
+auto parentPath(std::string_view path) -> std::string_view;
+
+// Paths stored back to back in one buffer, each split into its parts once
+// when added. Views stay valid until the next add or clear.
+class PathTable {
+  public:
+    using Handle = gsl::index;
+    void clear();
+    // Joined as std::filesystem::path{directory} / file would be.
+    auto add(std::string_view directory, std::string_view file) -> Handle;
+    [[nodiscard]] auto path(Handle) const -> std::string_view;
+    [[nodiscard]] auto fileName(Handle) const -> std::string_view;
+    [[nodiscard]] auto stem(Handle) const -> std::string_view;
+    [[nodiscard]] auto size() const -> gsl::index;
+    [[nodiscard]] auto empty() const -> bool;
+
+  private:
+    struct Entry {
+        std::size_t begin;
+        std::size_t fileName;
+        std::size_t stemEnd;
+        std::size_t end;
+    };
+    [[nodiscard]] auto view(std::size_t begin, std::size_t end) const
+        -> std::string_view;
+
+    std::string arena;
+    std::vector<Entry> entries;
+};
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_PSITRACKHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_PSITRACKHPP_
+
+#include "AdaptiveMethod.hpp"
+
+#include <gsl/gsl>
+
+#include <memory>
+#include <vector>
+
+namespace av_speech_in_noise {
+struct PsiTrackParameters {
+    std::vector<double> slopes{0.05, 0.1, 0.2, 0.4, 0.8, 1.6};
+    double guessRate{};
+    double lapseRate{0.02};
+    int trials{32};
+};
+
+// Keeps a posterior over the threshold and slope of a logistic listener
+// on a grid spanning the floor and ceiling in 1 dB steps. Each trial is
+// presented at the level minimizing the expected posterior entropy.
+class PsiTrack : public Track {
+  public:
+    PsiTrack(const Settings &, const PsiTrackParameters &);
+    auto x() -> int override;
+    void up() override;
+    void down() override;
+    auto complete() -> bool override;
+    auto reversals() -> int override;
+    void reset() override;
+    // The posterior mean threshold; the reversal count is ignored.
+    auto threshold(int reversals) -> double override;
+    // The posterior standard deviation of the threshold.
+    auto thresholdStandardDeviation(int reversals) -> double override;
+    // Converged once the posterior standard deviation falls below the
+    // convergence criterion, when one is set.
+    auto stoppingReason() -> TrackStoppingReason override;
+
+    class Factory : public Track::Factory {
+      public:
+        Factory() = default;
+        explicit Factory(PsiTrackParameters p) : parameters{std::move(p)} {}
+        auto make(const Settings &s) -> std::shared_ptr<Track> override {
+            return std::make_shared<PsiTrack>(s, parameters);
+        }
+
+      private:
+        PsiTrackParameters parameters;
+    };
+
+  private:
+    void update(bool correct);
+    void present(int);
+    auto nextX() const -> int;
+
+    // Indexed [stimulus * gridSize + grid point].
+    std::vector<double> likelihood;
+    std::vector<double> negativeEntropy;
+    std::vector<double> gridThreshold;
+    std::vector<double> posterior;
+    gsl::index gridSize;
+    int floor_;
+    int startingX;
+    int trials;
+    double convergenceStandardErrorDb;
+    int x_{};
+    int previousStep{};
+    int reversals_{};
+    int trialsCompleted{};
+};
+}
+
+#endif
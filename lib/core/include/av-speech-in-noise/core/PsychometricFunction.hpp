@@ -0,0 +1,17 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_PSYCHOMETRICFUNCTIONHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_PSYCHOMETRICFUNCTIONHPP_
+
+namespace av_speech_in_noise {
+// Logistic in x with a floor at the guess rate and a ceiling one lapse
+// rate below 1.
+struct PsychometricFunction {
+    double threshold{};
+    double slope{1};
+    double guessRate{};
+    double lapseRate{};
+};
+
+auto probabilityCorrect(const PsychometricFunction &, double x) -> double;
+}
+
+#endif
@@ -3,16 +3,23 @@
 
 #include "IResponseEvaluator.hpp"
 
+#include <string_view>
+
 namespace av_speech_in_noise {
+// The color and number a coordinate response target is named for: the
+// leading letters of the stem and its first digit, e.g. "blue2_3" is
+// blue 2. Either is invalid when the stem doesn't have one.
+auto parseCoordinateResponseTarget(std::string_view stem)
+    -> coordinate_response_measure::Response;
+
 class ResponseEvaluatorImpl : public ResponseEvaluator {
   public:
-    auto correct(const LocalUrl &,
+    auto correct(std::string_view targetStem,
         const coordinate_response_measure::Response &) -> bool override;
     const static int invalidNumber;
-    auto correctNumber(const LocalUrl &) -> int override;
-    auto correctColor(const LocalUrl &)
+    auto correctNumber(std::string_view targetStem) -> int override;
+    auto correctColor(std::string_view targetStem)
         -> coordinate_response_measure::Color override;
-    auto fileName(const LocalUrl &) -> std::string override;
 };
 }
 
@@ -0,0 +1,107 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_RESULTSSTOREHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_RESULTSSTOREHPP_
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace av_speech_in_noise {
+// Trials and thresholds refer to their test by id rather than by position
+// so that rows appended by another instance, or after a torn line, still
+// land on the right test.
+struct TestRecord {
+    std::string id;
+    TestIdentity identity;
+    LocalUrl targetsUrl;
+    LocalUrl maskerFileUrl;
+    RealLevel maskerLevel;
+    Condition condition{};
+    // The SNR of a fixed level test.
+    SNR startingSnr{};
+    // Empty for fixed level tests.
+    TrackingRule trackingRule;
+};
+
+struct TrialRecord {
+    std::string test;
+    std::string target;
+    std::optional<bool> correct;
+    std::optional<double> reactionTimeMilliseconds;
+    std::optional<int> snr_dB;
+};
+
+struct ThresholdRecord {
+    std::string test;
+    LocalUrl targetsUrl;
+    double threshold{};
+};
+
+// Empty fields match anything.
+struct ResultsQuery {
+    std::string subjectId;
+    std::string session;
+    std::string method;
+};
+
+// Tests, trials, and thresholds from every session in an output directory,
+// indexed by subject, session, and method. New records are kept until
+// written so that the backing file only ever needs to be appended to.
+//
+// Reading skips rows of tests this store added itself, so the file can be
+// re-read after appending to pick up what other instances wrote. Rows that
+// don't parse, repeat a test id, or name an unknown test are rejected and
+// kept for reporting.
+class ResultsStore {
+  public:
+    ResultsStore();
+    void read(std::istream &);
+    void writeNewRecords(std::ostream &);
+    // Assigns a unique id when the record has none. Returns the id.
+    auto add(TestRecord) -> std::string;
+    void add(const TrialRecord &);
+    void add(const ThresholdRecord &);
+    [[nodiscard]] auto tests(const ResultsQuery &) const
+        -> std::vector<TestRecord>;
+    [[nodiscard]] auto trials(const ResultsQuery &) const
+        -> std::vector<TrialRecord>;
+    [[nodiscard]] auto thresholds(const ResultsQuery &) const
+        -> std::vector<ThresholdRecord>;
+    [[nodiscard]] auto percentCorrect(const ResultsQuery &) const -> double;
+    [[nodiscard]] auto malformed() const -> const std::vector<std::string> &;
+
+  private:
+    using Index = std::unordered_map<std::string, std::vector<gsl::index>>;
+    [[nodiscard]] auto matchingTests(const ResultsQuery &) const
+        -> std::vector<gsl::index>;
+    void read(const std::string &line);
+    void index(const TestRecord &);
+    void index(const TrialRecord &);
+    void index(const ThresholdRecord &);
+    [[nodiscard]] auto owns(const std::string &test) const -> bool;
+
+    std::vector<TestRecord> tests_;
+    std::vector<TrialRecord> trials_;
+    std::vector<ThresholdRecord> thresholds_;
+    std::vector<std::vector<gsl::index>> trialsOfTest;
+    std::vector<std::vector<gsl::index>> thresholdsOfTest;
+    Index bySubject;
+    Index bySession;
+    Index byMethod;
+    std::unordered_map<std::string, gsl::index> testsById;
+    std::unordered_set<std::string> added;
+    std::vector<std::string> newRecords;
+    std::vector<std::string> malformed_;
+    std::mt19937_64 ids;
+};
+}
+
+#endif
@@ -5,12 +5,13 @@
 #include "IMaskerPlayer.hpp"
 #include "IOutputFile.hpp"
 #include "IRunningATest.hpp"
-#include "IResponseEvaluator.hpp"
 #include "ITargetPlayer.hpp"
 
 #include <av-speech-in-noise/Interface.hpp>
 #include <av-speech-in-noise/Model.hpp>
 
+#include <cstddef>
+#include <map>
 #include <string>
 
 namespace av_speech_in_noise {
@@ -26,8 +27,8 @@ class RunningATestImpl : public TargetPlayer::Observer,
                          public MaskerPlayer::Observer,
                          public RunningATest {
   public:
-    RunningATestImpl(TargetPlayer &, MaskerPlayer &, ResponseEvaluator &,
-        OutputFile &, Randomizer &, Clock &);
+    RunningATestImpl(
+        TargetPlayer &, MaskerPlayer &, OutputFile &, Randomizer &, Clock &);
     void attach(RunningATest::RequestObserver *) override;
     void initialize(TestMethod *, const Test &,
         std::vector<std::reference_wrapper<TestObserver>>) override;
@@ -45,6 +46,7 @@ class RunningATestImpl : public TargetPlayer::Observer,
     void prepareNextTrialIfNeeded() override;
     void notifyThatPreRollHasCompleted() override;
     auto playTrialTime() -> std::string override;
+    auto method() -> const TestMethod * override;
     static constexpr Delay maskerChannelDelay{0.004};
     static constexpr Duration targetOffsetFringeDuration{
         targetOnsetFringeDuration};
@@ -53,7 +55,6 @@ class RunningATestImpl : public TargetPlayer::Observer,
     Test test;
     MaskerPlayer &maskerPlayer;
     TargetPlayer &targetPlayer;
-    ResponseEvaluator &evaluator;
     OutputFile &outputFile;
     Randomizer &randomizer;
     Clock &clock;
@@ -61,6 +62,9 @@ class RunningATestImpl : public TargetPlayer::Observer,
     std::vector<std::reference_wrapper<TestObserver>> testObservers;
     RunningATest::RequestObserver *requestObserver{};
     TestMethod *testMethod{};
+    std::map<std::string, Duration> plannedTargetDurations;
+    std::size_t plannedTrialsWritten{};
+    MaskerSeek maskerSeek_{};
     int trialNumber_{};
     bool trialInProgress_{};
 };
@@ -0,0 +1,85 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_SIMULATEDEYETRACKERHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_SIMULATEDEYETRACKERHPP_
+
+#include "EyeTracking.hpp"
+#include "Player.hpp"
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+struct SimulatedGazeSettings {
+    double rateHz{600};
+    Duration minimumFixationDuration{0.15};
+    Duration maximumFixationDuration{0.4};
+    Duration minimumSaccadeDuration{0.02};
+    Duration maximumSaccadeDuration{0.06};
+    Duration minimumBlinkDuration{0.1};
+    Duration maximumBlinkDuration{0.3};
+    double blinkProbability{0.1};
+    double invalidSampleProbability{0.01};
+    double fixationJitter{0.003};
+    std::uint_fast32_t seed{std::mt19937::default_seed};
+};
+
+// Alternates fixations and saccades between random screen points, with
+// occasional blinks in place of a saccade and isolated invalid samples.
+class SimulatedGaze {
+  public:
+    explicit SimulatedGaze(const SimulatedGazeSettings &);
+    auto next(EyeTrackerSystemTime) -> BinocularGazeSample;
+
+  private:
+    enum class Phase { fixation, saccade, blink };
+    void beginNextPhase(std::int_least64_t microseconds);
+    auto uniform(double, double) -> double;
+    auto microseconds(Duration minimum, Duration maximum)
+        -> std::int_least64_t;
+    auto invalid() -> bool;
+
+    SimulatedGazeSettings settings;
+    std::mt19937 engine;
+    Point2D from{0.5F, 0.5F};
+    Point2D to{0.5F, 0.5F};
+    std::int_least64_t phaseStartMicroseconds{};
+    std::int_least64_t phaseEndMicroseconds{};
+    Phase phase{Phase::fixation};
+    bool started{};
+};
+
+class SimulatedEyeTracker : public EyeTracker {
+  public:
+    explicit SimulatedEyeTracker(const SimulatedGazeSettings & = {});
+    ~SimulatedEyeTracker() override;
+    void allocateRecordingTimeSeconds(double) override;
+    void start() override;
+    void stop() override;
+    auto gazeSamples() -> BinocularGazeSamples override;
+    auto currentSystemTime() -> EyeTrackerSystemTime override;
+    void write(std::ostream &) override;
+    void injectStall(Duration);
+
+    static constexpr double minimumRateHz{60};
+    static constexpr double maximumRateHz{2000};
+
+  private:
+    void run();
+
+    SimulatedGaze gaze;
+    std::vector<BinocularGazeSample> buffer;
+    std::thread thread;
+    std::atomic<gsl::index> head{};
+    std::atomic<std::int_least64_t> pendingStallMicroseconds{};
+    std::atomic<bool> running{};
+    double periodMicroseconds;
+};
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_SIMULATEDSESSIONHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_SIMULATEDSESSIONHPP_
+
+#include "IModel.hpp"
+#include "IResponseEvaluator.hpp"
+#include "IRunningATest.hpp"
+#include "PsychometricFunction.hpp"
+#include "TestMethod.hpp"
+#include "VirtualTime.hpp"
+
+#include <av-speech-in-noise/Interface.hpp>
+
+#include <gsl/gsl>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace av_speech_in_noise {
+// Understands each target with the probability its psychometric function
+// gives at the trial's SNR.
+class SimulatedListener {
+  public:
+    SimulatedListener(const PsychometricFunction &, std::uint64_t seed);
+    auto understands(SNR) -> bool;
+    auto betweenInclusive(int, int) -> int;
+
+  private:
+    PsychometricFunction function;
+    std::mt19937_64 engine;
+};
+
+class SimulatedResponder {
+  public:
+    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(SimulatedResponder);
+    virtual void respond() = 0;
+};
+
+namespace submitting_pass_fail {
+class SimulatedResponder : public av_speech_in_noise::SimulatedResponder {
+  public:
+    SimulatedResponder(Interactor &, TestMethod &, SimulatedListener &);
+    void respond() override;
+
+  private:
+    Interactor &interactor;
+    TestMethod &method;
+    SimulatedListener &listener;
+};
+}
+
+namespace submitting_fixed_pass_fail {
+class SimulatedResponder : public av_speech_in_noise::SimulatedResponder {
+  public:
+    SimulatedResponder(Interactor &, TestMethod &, SimulatedListener &);
+    void respond() override;
+
+  private:
+    Interactor &interactor;
+    TestMethod &method;
+    SimulatedListener &listener;
+};
+}
+
+namespace submitting_number_keywords {
+// Each of the three keywords is understood independently.
+class SimulatedResponder : public av_speech_in_noise::SimulatedResponder {
+  public:
+    SimulatedResponder(Interactor &, TestMethod &, SimulatedListener &);
+    void respond() override;
+
+  private:
+    Interactor &interactor;
+    TestMethod &method;
+    SimulatedListener &listener;
+};
+}
+
+namespace submitting_free_response {
+// Repeats the target's file name when it's understood and says nothing
+// otherwise.
+class SimulatedResponder : public av_speech_in_noise::SimulatedResponder {
+  public:
+    SimulatedResponder(Interactor &, TestMethod &, SimulatedListener &);
+    void respond() override;
+
+  private:
+    Interactor &interactor;
+    TestMethod &method;
+    SimulatedListener &listener;
+};
+}
+
+namespace coordinate_response_measure {
+// Picks the target's color and number when it's understood and a
+// different response otherwise.
+class SimulatedResponder : public av_speech_in_noise::SimulatedResponder {
+  public:
+    SimulatedResponder(RunningATest &, TestMethod &, ResponseEvaluator &,
+        SimulatedListener &);
+    void respond() override;
+
+  private:
+    RunningATest &model;
+    TestMethod &method;
+    ResponseEvaluator &evaluator;
+    SimulatedListener &listener;
+};
+}
+
+struct SimulatedSessionResult {
+    // Wall time from the end of each trial to the start of the next: the
+    // response, the save and preparing the players.
+    std::vector<double> interTrialSeconds;
+    Duration virtualDuration{};
+    gsl::index trials{};
+    bool complete{};
+};
+
+// Plays trials of an initialized test back to back on virtual time,
+// answering each with the responder, until the test completes or
+// `maximumTrials` have been played.
+class SimulatedSession : public RunningATest::RequestObserver {
+  public:
+    SimulatedSession(RunningATest &, VirtualTime &, SimulatedResponder &);
+    auto run(const AudioSettings &, gsl::index maximumTrials)
+        -> SimulatedSessionResult;
+    void notifyThatPlayTrialHasCompleted() override;
+
+  private:
+    void playTrial(const AudioSettings &);
+
+    RunningATest &model;
+    VirtualTime &time;
+    SimulatedResponder &responder;
+    bool trialCompleted{};
+};
+}
+
+#endif
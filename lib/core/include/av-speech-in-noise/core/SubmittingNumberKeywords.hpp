@@ -5,6 +5,7 @@
 #include "IAdaptiveMethod.hpp"
 #include "IOutputFile.hpp"
 #include "IRunningATest.hpp"
+#include "Tracing.hpp"
 
 namespace av_speech_in_noise::submitting_number_keywords {
 class InteractorImpl : public Interactor {
@@ -14,6 +15,7 @@ class InteractorImpl : public Interactor {
         : method{method}, model{model}, outputFile{outputFile} {}
 
     void submit(const CorrectKeywords &k) override {
+        tracing::Span span{"submitResponse"};
         method.submit(k);
         method.writeLastCorrectKeywords(outputFile);
         outputFile.save();
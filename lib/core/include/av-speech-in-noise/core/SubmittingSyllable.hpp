@@ -5,8 +5,9 @@
 #include "IFixedLevelMethod.hpp"
 #include "IOutputFile.hpp"
 #include "IRunningATest.hpp"
-#include <filesystem>
+#include "Tracing.hpp"
 #include <regex>
+#include <string_view>
 
 namespace av_speech_in_noise::submitting_syllable {
 static auto syllable(const std::string &match) -> Syllable {
@@ -55,11 +56,10 @@ static auto syllable(const std::string &match) -> Syllable {
     return Syllable::unknown;
 }
 
-static auto correctSyllable(const LocalUrl &file) -> Syllable {
-    const auto stem{std::filesystem::path{file.path}.stem().string()};
+static auto correctSyllable(std::string_view stem) -> Syllable {
     std::regex pattern{"say_(.*?)_.*"};
-    std::smatch match;
-    std::regex_search(stem, match, pattern);
+    std::cmatch match;
+    std::regex_search(stem.data(), stem.data() + stem.size(), match, pattern);
     return match.size() > 1 ? syllable(match[1]) : Syllable::unknown;
 }
 
@@ -70,12 +70,12 @@ class InteractorImpl : public Interactor {
         : method{method}, model{model}, outputFile{outputFile} {}
 
     void submit(const SyllableResponse &p) override {
+        tracing::Span span{"submitResponse"};
         method.submit(p);
         SyllableTrial trial;
         trial.subjectSyllable = p.syllable;
-        trial.target =
-            std::filesystem::path{method.currentTarget().path}.filename();
-        trial.correctSyllable = correctSyllable(method.currentTarget());
+        trial.target = method.currentTargetFileName();
+        trial.correctSyllable = correctSyllable(method.currentTargetStem());
         trial.correct = trial.correctSyllable == p.syllable;
         trial.flagged = p.flagged;
         outputFile.write(trial);
@@ -6,6 +6,7 @@
 
 #include <gsl/gsl>
 
+#include <cstdint>
 #include <string>
 
 namespace av_speech_in_noise {
@@ -20,6 +21,13 @@ class TargetPlaylist {
     virtual auto directory() -> LocalUrl = 0;
 };
 
+// Once seeded, loads and draws come from a generator seeded with the seed,
+// so the targets a test plays are reproducible from it.
+class SeedableTargetPlaylist : public virtual TargetPlaylist {
+  public:
+    virtual void seed(std::uint64_t) = 0;
+};
+
 class FiniteTargetPlaylist : public virtual TargetPlaylist {
   public:
     virtual auto empty() -> bool = 0;
@@ -4,8 +4,12 @@
 #include <av-speech-in-noise/Model.hpp>
 #include <av-speech-in-noise/Interface.hpp>
 
+#include <optional>
+#include <string_view>
+
 namespace av_speech_in_noise {
 class OutputFile;
+struct TrialPlan;
 
 class TestMethod {
   public:
@@ -13,7 +17,16 @@ class TestMethod {
     virtual auto complete() -> bool = 0;
     virtual auto nextTarget() -> LocalUrl = 0;
     virtual auto currentTarget() -> LocalUrl = 0;
+    // Parts of the current target, split once when it was selected and
+    // valid until the next one is.
+    virtual auto currentTargetFileName() -> std::string_view = 0;
+    virtual auto currentTargetStem() -> std::string_view = 0;
     virtual auto snr() -> SNR = 0;
+    // Where to seek the masker for the current target, as a fraction of the
+    // allowed range, when the method decided it in advance.
+    virtual auto maskerSeekFraction() -> std::optional<double> = 0;
+    // The trials the method drew in advance, with any added since, or null.
+    virtual auto trialPlan() -> const TrialPlan * = 0;
     virtual void submit(const coordinate_response_measure::Response &) = 0;
     virtual void writeTestingParameters(OutputFile &) = 0;
     virtual void writeLastCoordinateResponse(OutputFile &) = 0;
@@ -0,0 +1,63 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_TRACINGHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_TRACINGHPP_
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+// Spans and instants recorded to per-thread buffers and written as Chrome
+// trace event JSON, which chrome://tracing and Perfetto open. Each thread
+// appends to its own fixed-size buffer without locking; a full buffer
+// drops further events. When a thread exits its events are kept and its
+// buffer is reused by the next thread to record. Disabled, recording is
+// one relaxed atomic load.
+//
+// Names must outlive the trace; string literals are the intent.
+namespace av_speech_in_noise::tracing {
+extern std::atomic<bool> enabled_;
+
+inline auto enabled() -> bool {
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+void enable();
+void disable();
+
+// Nanoseconds on the steady clock since the process started.
+auto now() -> std::int64_t;
+
+void instant(const char *name);
+void complete(const char *name, std::int64_t start, std::int64_t end);
+
+// Recorded as one complete event when it goes out of scope.
+class Span {
+  public:
+    explicit Span(const char *name)
+        : name_{enabled() ? name : nullptr},
+          start{name_ != nullptr ? now() : 0} {}
+    ~Span() {
+        if (name_ != nullptr)
+            complete(name_, start, now());
+    }
+    Span(const Span &) = delete;
+    auto operator=(const Span &) -> Span & = delete;
+    Span(Span &&) = delete;
+    auto operator=(Span &&) -> Span & = delete;
+
+  private:
+    const char *name_;
+    std::int64_t start;
+};
+
+// Everything recorded so far, on every thread, as a JSON object with a
+// "traceEvents" array. Safe to call while other threads record.
+void write(std::ostream &);
+
+// Events lost to full buffers.
+auto dropped() -> std::int64_t;
+
+// Forgets everything recorded. Only call when no other thread records.
+void clear();
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_TRIALPLANHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_TRIALPLANHPP_
+
+#include "TargetPlaylist.hpp"
+
+#include <av-speech-in-noise/Model.hpp>
+
+#include <gsl/gsl>
+
+#include <cstdint>
+#include <vector>
+
+namespace av_speech_in_noise {
+struct PlannedTrial {
+    LocalUrl target;
+    double maskerSeekFraction{};
+};
+
+struct TrialPlan {
+    std::uint64_t seed{};
+    std::vector<PlannedTrial> trials;
+};
+
+// A trial added to a plan after the plan was written, numbered from 1 like
+// the plan's own trials.
+struct TrialPlanAmendment {
+    gsl::index trial{};
+    PlannedTrial planned;
+};
+
+// Draws every target up front. Masker seek fractions, in [0, 1] of the
+// allowed seek range, come from a generator seeded with `seed` so that the
+// plan is reproducible from the seed and the target sequence alone.
+auto compileTrialPlan(TargetPlaylist &, gsl::index trials, std::uint64_t seed)
+    -> TrialPlan;
+auto compileTrialPlan(FiniteTargetPlaylist &, std::uint64_t seed) -> TrialPlan;
+
+// Throws std::runtime_error naming the first planned target that is not a
+// regular file.
+void checkTargetsExist(const TrialPlan &);
+
+// A reinserted target is planned again with the masker seek it had, so an
+// amended plan still follows from the seed and the responses.
+class TrialPlanPlaylist : public FiniteTargetPlaylistWithRepeatables {
+  public:
+    void assign(TrialPlan, LocalUrl directory);
+    void load(const LocalUrl &) override {}
+    auto next() -> LocalUrl override;
+    auto current() -> LocalUrl override;
+    auto directory() -> LocalUrl override;
+    auto empty() -> bool override;
+    void reinsertCurrent() override;
+    [[nodiscard]] auto plan() const -> const TrialPlan &;
+    [[nodiscard]] auto maskerSeekFraction() const -> double;
+
+  private:
+    TrialPlan plan_;
+    LocalUrl directory_;
+    gsl::index current_{-1};
+};
+}
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_VIRTUALTIMEHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_VIRTUALTIMEHPP_
+
+#include "ITimer.hpp"
+#include "Player.hpp"
+#include "RunningATest.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace av_speech_in_noise {
+// A timer and clock on a simulated timeline. Nothing happens until
+// `advance`, which jumps to the earliest scheduled callback and runs it;
+// callbacks due at the same time run in the order they were scheduled.
+class VirtualTime : public Timer, public Clock {
+  public:
+    // The clock reads `originSeconds` after the Unix epoch, UTC, at zero.
+    explicit VirtualTime(std::int64_t originSeconds = 0);
+    void attach(Timer::Observer *) override;
+    void scheduleCallbackAfterSeconds(double) override;
+    void cancelLastCallback() override;
+    auto time() -> std::string override;
+    void schedule(Duration after, std::function<void()>);
+    auto advance() -> bool;
+    [[nodiscard]] auto now() const -> Duration;
+    [[nodiscard]] auto pending() const -> bool;
+
+  private:
+    using Key = std::pair<double, std::uint64_t>;
+    std::map<Key, std::function<void()>> events;
+    Key lastTimerCallback{-1, 0};
+    Timer::Observer *observer{};
+    double now_{};
+    std::int64_t originSeconds;
+    std::uint64_t scheduled{};
+};
+}
+
+#endif
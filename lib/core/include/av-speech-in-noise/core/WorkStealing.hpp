@@ -0,0 +1,18 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_WORKSTEALINGHPP_
+#define AV_SPEECH_IN_NOISE_LIB_CORE_INCLUDE_AVSPEECHINNOISE_CORE_WORKSTEALINGHPP_
+
+#include <gsl/gsl>
+
+#include <functional>
+
+namespace av_speech_in_noise {
+// Runs task(0) through task(tasks - 1) on up to `threads` workers, the
+// calling thread included. Each worker starts with a contiguous share of
+// the indices and, once it runs out, steals half of what remains of the
+// busiest share. The first exception thrown by a task is rethrown after
+// every worker has finished.
+void runWorkStealing(gsl::index tasks, unsigned threads,
+    const std::function<void(gsl::index)> &task);
+}
+
+#endif
@@ -2,6 +2,8 @@
 
 #include <gsl/gsl>
 
+#include <cmath>
+
 namespace av_speech_in_noise {
 static auto track(const TargetPlaylistWithTrack &t) -> Track * {
     return t.track.get();
@@ -11,10 +13,6 @@ static auto complete(const TargetPlaylistWithTrack &t) -> bool {
     return track(t)->complete();
 }
 
-static auto incomplete(const TargetPlaylistWithTrack &t) -> bool {
-    return !complete(t);
-}
-
 static void assignReversals(AdaptiveProgress &trial, Track *track) {
     trial.reversals = track->reversals();
 }
@@ -29,11 +27,6 @@ static void assignCorrectness(open_set::AdaptiveTrial &trial, bool c) {
     trial.correct = c;
 }
 
-static auto fileName(ResponseEvaluator &evaluator, const LocalUrl &target)
-    -> std::string {
-    return evaluator.fileName(target);
-}
-
 static auto trackSettings(const AdaptiveTest &test) -> Track::Settings {
     Track::Settings trackSettings{};
     trackSettings.rule = &test.trackingRule;
@@ -41,32 +34,17 @@ static auto trackSettings(const AdaptiveTest &test) -> Track::Settings {
     trackSettings.startingX = test.startingSnr.dB;
     trackSettings.floor = test.floorSnr.dB;
     trackSettings.bumpLimit = test.trackBumpLimit;
+    trackSettings.convergenceReversals = test.convergenceReversals;
+    trackSettings.convergenceStandardErrorDb = test.convergenceStandardErrorDb;
     return trackSettings;
 }
 
-static auto moveCompleteTracksToEnd(
-    std::vector<TargetPlaylistWithTrack> &targetListsWithTracks) -> gsl::index {
-    return std::distance(targetListsWithTracks.begin(),
-        std::stable_partition(targetListsWithTracks.begin(),
-            targetListsWithTracks.end(), incomplete));
-}
-
 static void down(Track *track) { track->down(); }
 
 static void up(Track *track) { track->up(); }
 
-static auto current(TargetPlaylist *list) -> LocalUrl {
-    return list->current();
-}
-
-static void assignTarget(open_set::Trial &trial, ResponseEvaluator &evaluator,
-    TargetPlaylist *targetList) {
-    trial.target = fileName(evaluator, current(targetList));
-}
-
-static auto correct(ResponseEvaluator &evaluator, TargetPlaylist *targetList,
-    const coordinate_response_measure::Response &response) -> bool {
-    return evaluator.correct(current(targetList), response);
+static void assignTarget(open_set::Trial &trial, std::string_view fileName) {
+    trial.target = fileName;
 }
 
 static void resetTrack(TargetPlaylistWithTrack &targetListWithTrack) {
@@ -80,50 +58,170 @@ static auto testResults(
     int thresholdReversals) -> AdaptiveTestResults {
     AdaptiveTestResults results;
     for (const auto &t : targetListsWithTracks)
-        results.push_back(
-            {t.list->directory(), t.track->threshold(thresholdReversals)});
+        results.push_back({t.list->directory(),
+            t.track->threshold(thresholdReversals),
+            t.track->stoppingReason(),
+            t.track->thresholdStandardDeviation(thresholdReversals)});
     return results;
 }
 
-AdaptiveMethodImpl::AdaptiveMethodImpl(Track::Factory &snrTrackFactory,
+static auto size(const std::vector<gsl::index> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto size(const std::vector<TargetPlaylistWithTrack> &v)
+    -> gsl::index {
+    return v.size();
+}
+
+void ActiveTracks::reset(gsl::index n) {
+    tracks.resize(n);
+    position.resize(n);
+    next.resize(n);
+    previous.resize(n);
+    presentations.assign(n, 0);
+    byPresentations.clear();
+    for (gsl::index i{0}; i < n; ++i) {
+        tracks.at(i) = i;
+        position.at(i) = i;
+        next.at(i) = (i + 1) % n;
+        previous.at(i) = (i + n - 1) % n;
+        byPresentations.emplace(0, i);
+    }
+}
+
+// Swaps the last active track into the removed one's place and unlinks it
+// from the cycle. A removed track keeps its link forward so that after()
+// still works from it.
+void ActiveTracks::remove(gsl::index track) {
+    if (!contains(track))
+        return;
+    const auto last{tracks.back()};
+    tracks.at(position.at(track)) = last;
+    position.at(last) = position.at(track);
+    tracks.pop_back();
+    position.at(track) = -1;
+    next.at(previous.at(track)) = next.at(track);
+    previous.at(next.at(track)) = previous.at(track);
+    byPresentations.erase({presentations.at(track), track});
+}
+
+void ActiveTracks::presented(gsl::index track) {
+    if (!contains(track))
+        return;
+    byPresentations.erase({presentations.at(track), track});
+    byPresentations.emplace(++presentations.at(track), track);
+}
+
+auto ActiveTracks::contains(gsl::index track) const -> bool {
+    return track >= 0 && track < av_speech_in_noise::size(position) &&
+        position.at(track) != -1;
+}
+
+auto ActiveTracks::size() const -> gsl::index {
+    return av_speech_in_noise::size(tracks);
+}
+
+auto ActiveTracks::empty() const -> bool { return tracks.empty(); }
+
+auto ActiveTracks::at(gsl::index p) const -> gsl::index {
+    return tracks.at(p);
+}
+
+auto ActiveTracks::after(gsl::index track) const -> gsl::index {
+    auto candidate{next.at(track)};
+    while (!contains(candidate))
+        candidate = next.at(candidate);
+    return candidate;
+}
+
+auto ActiveTracks::leastPresented() const -> gsl::index {
+    return byPresentations.begin()->second;
+}
+
+AdaptiveMethodImpl::AdaptiveMethodImpl(
     ResponseEvaluator &evaluator, Randomizer &randomizer)
-    : snrTrackFactory{snrTrackFactory}, evaluator{evaluator},
-      randomizer{randomizer} {}
+    : evaluator{evaluator}, randomizer{randomizer} {
+    splitCurrentTarget();
+}
 
-void AdaptiveMethodImpl::initialize(
-    const AdaptiveTest &t, TargetPlaylistReader *targetListSetReader) {
+void AdaptiveMethodImpl::initialize(const AdaptiveTest &t,
+    TargetPlaylistReader *targetListSetReader,
+    Track::Factory &snrTrackFactory) {
     test = &t;
     thresholdReversals = t.thresholdReversals;
+    trackSelection = t.trackSelection;
     targetListsWithTracks.clear();
     for (const auto &list : targetListSetReader->read(t.targetsUrl))
         targetListsWithTracks.push_back(
             {list, snrTrackFactory.make(trackSettings(t))});
+    activeTracks.reset(size(targetListsWithTracks));
+    snrTrack = nullptr;
+    targetList = nullptr;
+    currentTrack = 0;
+    if (targetListsWithTracks.empty()) {
+        splitCurrentTarget();
+        return;
+    }
+    currentTrack = size(targetListsWithTracks) - 1;
     selectNextList();
 }
 
 void AdaptiveMethodImpl::resetTracks() {
     std::for_each(
         targetListsWithTracks.begin(), targetListsWithTracks.end(), resetTrack);
+    activeTracks.reset(size(targetListsWithTracks));
     selectNextList();
 }
 
+// Only the track just responded to can have completed, but any selected
+// track is checked before use so that completion is never missed.
 void AdaptiveMethodImpl::selectNextList() {
-    const auto tracksInProgress{moveCompleteTracksToEnd(targetListsWithTracks)};
-    if (tracksInProgress == 0)
+    if (activeTracks.contains(currentTrack) &&
+        av_speech_in_noise::complete(targetListsWithTracks.at(currentTrack)))
+        activeTracks.remove(currentTrack);
+    while (!activeTracks.empty()) {
+        const auto candidate{nextTrack()};
+        const auto &next{targetListsWithTracks.at(candidate)};
+        if (av_speech_in_noise::complete(next)) {
+            activeTracks.remove(candidate);
+            continue;
+        }
+        currentTrack = candidate;
+        activeTracks.presented(candidate);
+        snrTrack = track(next);
+        targetList = next.list.get();
+        splitCurrentTarget();
         return;
+    }
+}
 
-    const auto &next{targetListsWithTracks.at(
-        randomizer.betweenInclusive(0, tracksInProgress - 1))};
-    snrTrack = track(next);
-    targetList = next.list.get();
+auto AdaptiveMethodImpl::nextTrack() -> gsl::index {
+    switch (trackSelection) {
+    case TrackSelection::roundRobin:
+        return activeTracks.after(currentTrack);
+    case TrackSelection::leastPresented:
+        return activeTracks.leastPresented();
+    case TrackSelection::random:
+        break;
+    }
+    return activeTracks.at(randomizer.betweenInclusive(
+        0, gsl::narrow_cast<int>(activeTracks.size()) - 1));
 }
 
-auto AdaptiveMethodImpl::complete() -> bool {
-    return std::all_of(targetListsWithTracks.begin(),
-        targetListsWithTracks.end(), av_speech_in_noise::complete);
+auto AdaptiveMethodImpl::complete() -> bool { return activeTracks.empty(); }
+
+void AdaptiveMethodImpl::splitCurrentTarget() {
+    currentTargetPaths.clear();
+    currentTargetPath = currentTargetPaths.add(
+        {}, targetList == nullptr ? std::string{} : targetList->current().path);
 }
 
-auto AdaptiveMethodImpl::nextTarget() -> LocalUrl { return targetList->next(); }
+auto AdaptiveMethodImpl::nextTarget() -> LocalUrl {
+    auto target{targetList->next()};
+    splitCurrentTarget();
+    return target;
+}
 
 auto AdaptiveMethodImpl::snr() -> SNR {
     SNR snr;
@@ -135,18 +233,26 @@ auto AdaptiveMethodImpl::currentTarget() -> LocalUrl {
     return targetList->current();
 }
 
+auto AdaptiveMethodImpl::currentTargetFileName() -> std::string_view {
+    return currentTargetPaths.fileName(currentTargetPath);
+}
+
+auto AdaptiveMethodImpl::currentTargetStem() -> std::string_view {
+    return currentTargetPaths.stem(currentTargetPath);
+}
+
 void AdaptiveMethodImpl::submit(
     const coordinate_response_measure::Response &response) {
     lastCoordinateResponseMeasureTrial.subjectColor = response.color;
     lastCoordinateResponseMeasureTrial.subjectNumber = response.number;
     lastCoordinateResponseMeasureTrial.correctColor =
-        evaluator.correctColor(current(targetList));
+        evaluator.correctColor(currentTargetStem());
     lastCoordinateResponseMeasureTrial.correctNumber =
-        evaluator.correctNumber(current(targetList));
+        evaluator.correctNumber(currentTargetStem());
     lastCoordinateResponseMeasureTrial.snr.dB = x(snrTrack);
 
     if ((lastCoordinateResponseMeasureTrial.correct =
-                correct(evaluator, targetList, response)))
+                evaluator.correct(currentTargetStem(), response)))
         down(snrTrack);
     else
         up(snrTrack);
@@ -157,7 +263,7 @@ void AdaptiveMethodImpl::submit(
 void AdaptiveMethodImpl::submitIncorrectResponse() {
     assignCorrectness(lastOpenSetTrial, false);
     assignSnr(lastOpenSetTrial, snrTrack);
-    assignTarget(lastOpenSetTrial, evaluator, targetList);
+    assignTarget(lastOpenSetTrial, currentTargetFileName());
 
     up(snrTrack);
     assignReversals(lastOpenSetTrial, snrTrack);
@@ -167,7 +273,7 @@ void AdaptiveMethodImpl::submitIncorrectResponse() {
 void AdaptiveMethodImpl::submitCorrectResponse() {
     assignCorrectness(lastOpenSetTrial, true);
     assignSnr(lastOpenSetTrial, snrTrack);
-    assignTarget(lastOpenSetTrial, evaluator, targetList);
+    assignTarget(lastOpenSetTrial, currentTargetFileName());
 
     down(snrTrack);
     assignReversals(lastOpenSetTrial, snrTrack);
@@ -178,7 +284,7 @@ void AdaptiveMethodImpl::submit(const CorrectKeywords &p) {
     lastCorrectKeywordsTrial.count = p.count;
     assignCorrectness(lastCorrectKeywordsTrial, correct(p));
     assignSnr(lastCorrectKeywordsTrial, snrTrack);
-    assignTarget(lastCorrectKeywordsTrial, evaluator, targetList);
+    assignTarget(lastCorrectKeywordsTrial, currentTargetFileName());
 
     if (correct(p))
         down(snrTrack);
@@ -217,4 +323,16 @@ auto AdaptiveMethodImpl::testResults() -> AdaptiveTestResults {
     return av_speech_in_noise::testResults(
         targetListsWithTracks, thresholdReversals);
 }
+
+auto AdaptiveMethodImpl::currentTrackResult()
+    -> std::optional<AdaptiveTestResult> {
+    if (snrTrack == nullptr)
+        return std::nullopt;
+    const auto threshold{snrTrack->threshold(thresholdReversals)};
+    if (std::isnan(threshold))
+        return std::nullopt;
+    return AdaptiveTestResult{targetList->directory(), threshold,
+        snrTrack->stoppingReason(),
+        snrTrack->thresholdStandardDeviation(thresholdReversals)};
+}
 }
@@ -1,11 +1,16 @@
 #include "AdaptiveTrack.hpp"
 #include <gsl/gsl>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 
 namespace adaptive_track {
 AdaptiveTrack::AdaptiveTrack(const Settings &p)
     : startingX_{p.startingX}, x_{p.startingX}, ceiling_{p.ceiling},
-      floor_{p.floor}, bumpLimit_{p.bumpLimit}, bumpCount_{0} {
+      floor_{p.floor}, bumpLimit_{p.bumpLimit}, bumpCount_{0},
+      convergenceReversals_{p.convergenceReversals},
+      convergenceStandardErrorDb_{p.convergenceStandardErrorDb} {
     for (const auto &sequence : *p.rule)
         if (sequence.runCount != 0) {
             stepSizes.push_back(sequence.stepSize);
@@ -14,6 +19,12 @@ AdaptiveTrack::AdaptiveTrack(const Settings &p)
             down_.push_back(sequence.down);
         }
     stepSizes.push_back(0);
+    const auto totalReversals{
+        std::accumulate(runCounts.begin(), runCounts.end(), 1)};
+    reversalSums.reserve(totalReversals);
+    reversalSquareSums.reserve(totalReversals);
+    reversalSums.push_back(0);
+    reversalSquareSums.push_back(0);
 }
 
 void AdaptiveTrack::up() {
@@ -67,7 +78,9 @@ auto AdaptiveTrack::stepSize() -> int { return stepSizes.at(sequenceIndex); }
 
 void AdaptiveTrack::reversal() {
     ++reversals_;
-    reversalX.push_back(x_);
+    reversalSums.push_back(reversalSums.back() + x_);
+    reversalSquareSums.push_back(
+        reversalSquareSums.back() + static_cast<long long>(x_) * x_);
     if (++runCounter == runCounts.at(sequenceIndex)) {
         runCounter = 0;
         ++sequenceIndex;
@@ -90,7 +103,19 @@ auto AdaptiveTrack::x() -> int { return x_; }
 auto AdaptiveTrack::complete() -> bool { return complete_(); }
 
 auto AdaptiveTrack::complete_() const -> bool {
-    return sequenceIndex == runCounts.size() || bumpCount_ == bumpLimit_;
+    return sequenceIndex == runCounts.size() || bumpCount_ == bumpLimit_ ||
+        converged();
+}
+
+auto AdaptiveTrack::stoppingReason()
+    -> av_speech_in_noise::TrackStoppingReason {
+    if (sequenceIndex == runCounts.size())
+        return av_speech_in_noise::TrackStoppingReason::completedRule;
+    if (bumpCount_ == bumpLimit_)
+        return av_speech_in_noise::TrackStoppingReason::reachedBumpLimit;
+    if (converged())
+        return av_speech_in_noise::TrackStoppingReason::converged;
+    return av_speech_in_noise::TrackStoppingReason::none;
 }
 
 auto AdaptiveTrack::reversals() -> int { return reversals_; }
@@ -103,19 +128,66 @@ void AdaptiveTrack::reset() {
     sequenceIndex = 0;
     runCounter = 0;
     bumpCount_ = 0;
+    reversalSums.resize(1);
+    reversalSquareSums.resize(1);
 }
 
-static auto size(const std::vector<int> &v) -> gsl::index { return v.size(); }
+static auto size(const std::vector<long long> &v) -> gsl::index {
+    return v.size();
+}
 
-static auto bounded(int reversals, const std::vector<int> &reversalX)
+static auto bounded(int reversals, const std::vector<long long> &sums)
     -> gsl::index {
     return std::max(
-        std::min<gsl::index>(reversals, size(reversalX)), gsl::index{0});
+        std::min<gsl::index>(reversals, size(sums) - 1), gsl::index{0});
+}
+
+// Sum over the last n reversals.
+static auto lastSum(const std::vector<long long> &sums, gsl::index n)
+    -> double {
+    return static_cast<double>(sums.back() - sums.at(size(sums) - 1 - n));
 }
 
 auto AdaptiveTrack::threshold(int reversals) -> double {
-    return std::accumulate(reversalX.rbegin(),
-               reversalX.rbegin() + bounded(reversals, reversalX), 0) /
-        (bounded(reversals, reversalX) * 1.);
+    const auto n{bounded(reversals, reversalSums)};
+    return lastSum(reversalSums, n) / (n * 1.);
+}
+
+static auto lastVariance(const std::vector<long long> &sums,
+    const std::vector<long long> &squareSums, gsl::index n) -> double {
+    const auto sum{lastSum(sums, n)};
+    return std::max(0., (lastSum(squareSums, n) - sum * sum / n) / (n - 1.));
+}
+
+auto AdaptiveTrack::thresholdStandardDeviation(int reversals) -> double {
+    const auto n{bounded(reversals, reversalSums)};
+    if (n < 2)
+        return std::numeric_limits<double>::quiet_NaN();
+    return std::sqrt(lastVariance(reversalSums, reversalSquareSums, n));
+}
+
+auto AdaptiveTrack::currentRun() const -> RunStatistics {
+    RunStatistics run;
+    run.stepSize = stepSizes.at(sequenceIndex);
+    run.reversals = runCounter;
+    run.reversalsRemaining = sequenceIndex < runCounts.size()
+        ? runCounts.at(sequenceIndex) - runCounter
+        : 0;
+    const auto n{gsl::index{runCounter}};
+    run.mean = n == 0 ? std::numeric_limits<double>::quiet_NaN()
+                      : lastSum(reversalSums, n) / (n * 1.);
+    run.standardDeviation = n < 2
+        ? std::numeric_limits<double>::quiet_NaN()
+        : std::sqrt(lastVariance(reversalSums, reversalSquareSums, n));
+    return run;
+}
+
+auto AdaptiveTrack::converged() const -> bool {
+    if (convergenceReversals_ < 2 || convergenceStandardErrorDb_ <= 0 ||
+        size(reversalSums) - 1 < convergenceReversals_)
+        return false;
+    const auto n{gsl::index{convergenceReversals_}};
+    return lastVariance(reversalSums, reversalSquareSums, n) / n <
+        convergenceStandardErrorDb_ * convergenceStandardErrorDb_;
 }
 }
@@ -0,0 +1,165 @@
+#include "AdaptiveTrackSimulation.hpp"
+#include "WorkStealing.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+// Welford's running mean and sum of squared deviations, mergeable with
+// Chan et al.'s pairwise update.
+struct Moments {
+    gsl::index n{};
+    double mean{};
+    double m2{};
+
+    void add(double x) {
+        ++n;
+        const auto delta{x - mean};
+        mean += delta / n;
+        m2 += delta * (x - mean);
+    }
+
+    void merge(const Moments &other) {
+        if (other.n == 0)
+            return;
+        const auto total{n + other.n};
+        const auto delta{other.mean - mean};
+        mean += delta * other.n / total;
+        m2 += other.m2 + delta * delta * n * other.n / total;
+        n = total;
+    }
+
+    [[nodiscard]] auto variance() const -> double {
+        return n < 2 ? 0 : m2 / (n - 1);
+    }
+};
+
+struct ChunkResult {
+    Moments thresholds;
+    Moments trials;
+    gsl::index incomplete{};
+    int maximumTrials{};
+};
+}
+
+constexpr gsl::index tracksPerChunk{1024};
+
+static auto lastSequence(const TrackingRule &rule) -> const TrackingSequence * {
+    const auto found{std::find_if(rule.rbegin(), rule.rend(),
+        [](const TrackingSequence &s) { return s.runCount != 0; })};
+    return found == rule.rend() ? nullptr : &*found;
+}
+
+// Probability that `down` correct responses in a row come before `up`
+// incorrect responses in a row (Feller's run race).
+static auto probabilityOfStepDown(const TrackingSequence &sequence, double p)
+    -> double {
+    const auto q{1 - p};
+    const auto correctRun{std::pow(p, sequence.down - 1)};
+    const auto incorrectRun{std::pow(q, sequence.up - 1)};
+    return correctRun * (1 - std::pow(q, sequence.up)) /
+        (correctRun + incorrectRun - correctRun * incorrectRun);
+}
+
+auto convergenceLevel(const PsychometricFunction &f,
+    const TrackingSequence &sequence) -> double {
+    auto low{0.};
+    auto high{1.};
+    for (auto i{0}; i < 60; ++i) {
+        const auto p{(low + high) / 2};
+        if (probabilityOfStepDown(sequence, p) < 0.5)
+            low = p;
+        else
+            high = p;
+    }
+    const auto p{(low + high) / 2};
+    const auto normalized{
+        (p - f.guessRate) / (1 - f.guessRate - f.lapseRate)};
+    if (normalized <= 0 || normalized >= 1 || f.slope == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+    return f.threshold + std::log(normalized / (1 - normalized)) / f.slope;
+}
+
+static auto trackSettings(const AdaptiveTest &test) -> Track::Settings {
+    Track::Settings settings{};
+    settings.rule = &test.trackingRule;
+    settings.ceiling = test.ceilingSnr.dB;
+    settings.startingX = test.startingSnr.dB;
+    settings.floor = test.floorSnr.dB;
+    settings.bumpLimit = test.trackBumpLimit;
+    settings.convergenceReversals = test.convergenceReversals;
+    settings.convergenceStandardErrorDb = test.convergenceStandardErrorDb;
+    return settings;
+}
+
+static void simulate(Track::Factory &factory,
+    const AdaptiveTrackSimulationSettings &settings, gsl::index chunk,
+    ChunkResult &result) {
+    std::seed_seq seed{static_cast<std::uint32_t>(settings.seed),
+        static_cast<std::uint32_t>(settings.seed >> 32U),
+        static_cast<std::uint32_t>(chunk)};
+    std::mt19937_64 engine{seed};
+    std::uniform_real_distribution<> uniform;
+    const auto begin{chunk * tracksPerChunk};
+    const auto end{std::min(begin + tracksPerChunk, settings.tracks)};
+    for (auto i{begin}; i < end; ++i) {
+        const auto track{factory.make(trackSettings(settings.test))};
+        auto trials{0};
+        while (!track->complete() && trials < settings.maximumTrialsPerTrack) {
+            if (uniform(engine) <
+                probabilityCorrect(settings.listener, track->x()))
+                track->down();
+            else
+                track->up();
+            ++trials;
+        }
+        result.trials.add(trials);
+        result.maximumTrials = std::max(result.maximumTrials, trials);
+        if (track->complete())
+            result.thresholds.add(
+                track->threshold(settings.test.thresholdReversals));
+        else
+            ++result.incomplete;
+    }
+}
+
+auto simulate(Track::Factory &factory,
+    const AdaptiveTrackSimulationSettings &settings)
+    -> AdaptiveTrackSimulationResult {
+    const auto chunks{(settings.tracks + tracksPerChunk - 1) / tracksPerChunk};
+    std::vector<ChunkResult> chunkResults(chunks);
+    runWorkStealing(chunks, settings.threads, [&](gsl::index chunk) {
+        simulate(factory, settings, chunk, chunkResults.at(chunk));
+    });
+    ChunkResult total;
+    for (const auto &chunk : chunkResults) {
+        total.thresholds.merge(chunk.thresholds);
+        total.trials.merge(chunk.trials);
+        total.incomplete += chunk.incomplete;
+        total.maximumTrials =
+            std::max(total.maximumTrials, chunk.maximumTrials);
+    }
+    AdaptiveTrackSimulationResult result;
+    result.tracks = settings.tracks;
+    result.incompleteTracks = total.incomplete;
+    const auto *const sequence{lastSequence(settings.test.trackingRule)};
+    result.convergenceLevel = sequence == nullptr
+        ? std::numeric_limits<double>::quiet_NaN()
+        : convergenceLevel(settings.listener, *sequence);
+    result.expectedThreshold =
+        settings.estimates == SimulatedThreshold::listenerThreshold
+        ? settings.listener.threshold
+        : result.convergenceLevel;
+    result.meanThreshold = total.thresholds.mean;
+    result.bias = result.meanThreshold - result.expectedThreshold;
+    result.thresholdVariance = total.thresholds.variance();
+    result.meanTrials = total.trials.mean;
+    result.trialsStandardDeviation = std::sqrt(total.trials.variance());
+    result.maximumTrials = total.maximumTrials;
+    return result;
+}
+}
@@ -32,7 +32,7 @@ void AudioRecording::notifyThatStimulusHasEnded() {}
 
 void AudioRecording::notifyThatSubjectHasResponded() { audioRecorder.stop(); }
 
-void AudioRecording::notifyThatNewTestIsReady(std::string_view session) {
-    this->session = session;
+void AudioRecording::notifyThatNewTestIsReady(const Test &test) {
+    session = test.identity.session;
 }
 }
@@ -0,0 +1,221 @@
+#include "ClockSynchronization.hpp"
+#include "EyeTracking.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+namespace av_speech_in_noise {
+namespace {
+struct Point {
+    double x;
+    double y;
+};
+
+struct Line {
+    double slope;
+    double intercept;
+};
+}
+
+constexpr auto nominalMicrosecondsPerNanosecond{1e-3};
+constexpr auto outlierStandardDeviations{3.};
+
+static auto roundTripMicroseconds(const EyeTrackerTargetPlayerClockSample &s)
+    -> std::int_least64_t {
+    return s.eyeTrackerSystemTimeAfter.microseconds -
+        s.eyeTrackerSystemTimeBefore.microseconds;
+}
+
+static auto nanosecondsSince(TargetPlayerSystemTime reference,
+    TargetPlayerSystemTime t) -> std::int_least64_t {
+    return gsl::narrow_cast<std::int_least64_t>(
+        t.nanoseconds - reference.nanoseconds);
+}
+
+static auto mean(const std::vector<Point> &points, double Point::*member)
+    -> double {
+    double sum{0};
+    for (const auto &p : points)
+        sum += p.*member;
+    return sum / points.size();
+}
+
+static auto leastSquares(const std::vector<Point> &points) -> Line {
+    const auto meanX{mean(points, &Point::x)};
+    const auto meanY{mean(points, &Point::y)};
+    double covariance{0};
+    double variance{0};
+    for (const auto &p : points) {
+        covariance += (p.x - meanX) * (p.y - meanY);
+        variance += (p.x - meanX) * (p.x - meanX);
+    }
+    const auto slope{variance > 0 ? covariance / variance
+                                  : nominalMicrosecondsPerNanosecond};
+    return {slope, meanY - slope * meanX};
+}
+
+static auto residual(const Line &line, const Point &p) -> double {
+    return p.y - (line.slope * p.x + line.intercept);
+}
+
+static auto residualStandardDeviation(
+    const Line &line, const std::vector<Point> &points) -> double {
+    if (points.size() < 3)
+        return 0;
+    double sumOfSquares{0};
+    for (const auto &p : points)
+        sumOfSquares += residual(line, p) * residual(line, p);
+    return std::sqrt(sumOfSquares / (points.size() - 2));
+}
+
+// Pairs that took longer than the median round trip to read were most
+// likely preempted between reads, so they are dropped before fitting.
+static auto withShortRoundTrips(
+    gsl::span<const EyeTrackerTargetPlayerClockSample> samples)
+    -> std::vector<EyeTrackerTargetPlayerClockSample> {
+    std::vector<std::int_least64_t> roundTrips;
+    roundTrips.reserve(samples.size());
+    for (const auto &s : samples)
+        roundTrips.push_back(roundTripMicroseconds(s));
+    const auto median{roundTrips.begin() + roundTrips.size() / 2};
+    std::nth_element(roundTrips.begin(), median, roundTrips.end());
+    std::vector<EyeTrackerTargetPlayerClockSample> kept;
+    for (const auto &s : samples)
+        if (roundTripMicroseconds(s) <= *median)
+            kept.push_back(s);
+    return kept;
+}
+
+auto fit(gsl::span<const EyeTrackerTargetPlayerClockSample> samples)
+    -> EyeTrackerTargetPlayerClockModel {
+    EyeTrackerTargetPlayerClockModel model;
+    if (samples.empty())
+        return model;
+    const auto kept{withShortRoundTrips(samples)};
+    const auto reference{kept.front().targetPlayerSystemTime};
+    const auto eyeTrackerReference{
+        kept.front().eyeTrackerSystemTimeBefore.microseconds};
+    std::vector<Point> points;
+    points.reserve(kept.size());
+    for (const auto &s : kept)
+        points.push_back({static_cast<double>(nanosecondsSince(
+                              reference, s.targetPlayerSystemTime)),
+            s.eyeTrackerSystemTimeBefore.microseconds - eyeTrackerReference +
+                roundTripMicroseconds(s) / 2.});
+    auto line{leastSquares(points)};
+    const auto threshold{
+        outlierStandardDeviations * residualStandardDeviation(line, points)};
+    if (threshold > 0) {
+        const auto end{std::remove_if(points.begin(), points.end(),
+            [&](const Point &p) {
+                return std::abs(residual(line, p)) > threshold;
+            })};
+        if (end != points.end()) {
+            points.erase(end, points.end());
+            line = leastSquares(points);
+        }
+    }
+    model.reference = reference;
+    model.eyeTrackerSystemTimeAtReference.microseconds =
+        eyeTrackerReference + std::llround(line.intercept);
+    model.driftPartsPerMillion =
+        (line.slope / nominalMicrosecondsPerNanosecond - 1) * 1e6;
+    model.residualStandardDeviationMicroseconds =
+        residualStandardDeviation(line, points);
+    model.samples = gsl::narrow_cast<int>(points.size());
+    return model;
+}
+
+auto eyeTrackerSystemTime(const EyeTrackerTargetPlayerClockModel &model,
+    TargetPlayerSystemTime t) -> EyeTrackerSystemTime {
+    return EyeTrackerSystemTime{
+        model.eyeTrackerSystemTimeAtReference.microseconds +
+        std::llround(static_cast<double>(nanosecondsSince(model.reference, t)) *
+            nominalMicrosecondsPerNanosecond *
+            (1 + model.driftPartsPerMillion / 1e6))};
+}
+
+// Elsewhere the sampling thread keeps the default priority.
+static void lowerPriorityOfCurrentThread() {
+#ifdef __APPLE__
+    pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#elif defined(__linux__)
+    // Linux keeps a nice value per thread, and 0 names the calling one.
+    setpriority(PRIO_PROCESS, 0, 10);
+#endif
+}
+
+ClockSynchronizationImpl::ClockSynchronizationImpl(
+    EyeTracker &eyeTracker, MaskerPlayer &maskerPlayer)
+    : ClockSynchronizationImpl{eyeTracker, maskerPlayer, Settings{}} {}
+
+ClockSynchronizationImpl::ClockSynchronizationImpl(EyeTracker &eyeTracker,
+    MaskerPlayer &maskerPlayer, const Settings &settings)
+    : settings{settings}, eyeTracker{eyeTracker}, maskerPlayer{maskerPlayer} {
+    samples.reserve(settings.capacity);
+}
+
+ClockSynchronizationImpl::~ClockSynchronizationImpl() { stop(); }
+
+void ClockSynchronizationImpl::start() {
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (running)
+            return;
+        running = true;
+    }
+    thread = std::thread{[this] { run(); }};
+}
+
+void ClockSynchronizationImpl::stop() {
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (!running)
+            return;
+        running = false;
+    }
+    stopRequested.notify_one();
+    thread.join();
+}
+
+void ClockSynchronizationImpl::run() {
+    lowerPriorityOfCurrentThread();
+    const std::chrono::duration<double> period{settings.samplingPeriod.seconds};
+    std::unique_lock<std::mutex> lock{mutex};
+    do {
+        lock.unlock();
+        sample();
+        lock.lock();
+    } while (!stopRequested.wait_for(lock, period, [&] { return !running; }));
+}
+
+void ClockSynchronizationImpl::sample() {
+    EyeTrackerTargetPlayerClockSample s;
+    s.eyeTrackerSystemTimeBefore = eyeTracker.currentSystemTime();
+    s.targetPlayerSystemTime.nanoseconds =
+        maskerPlayer.nanoseconds(maskerPlayer.currentSystemTime());
+    s.eyeTrackerSystemTimeAfter = eyeTracker.currentSystemTime();
+    std::lock_guard<std::mutex> lock{mutex};
+    if (gsl::narrow_cast<gsl::index>(samples.size()) < settings.capacity)
+        samples.push_back(s);
+    else
+        samples.at(next) = s;
+    next = (next + 1) % settings.capacity;
+}
+
+auto ClockSynchronizationImpl::model() -> EyeTrackerTargetPlayerClockModel {
+    std::vector<EyeTrackerTargetPlayerClockSample> copy;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        copy = samples;
+    }
+    return fit(copy);
+}
+}
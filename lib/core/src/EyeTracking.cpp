@@ -1,5 +1,6 @@
 #include "EyeTracking.hpp"
 
+#include "GazeFilter.hpp"
 #include "RunningATest.hpp"
 
 namespace av_speech_in_noise {
@@ -18,11 +19,14 @@ static auto nanoseconds(MaskerPlayer &player, const PlayerTimeWithDelay &t)
 }
 
 EyeTracking::EyeTracking(EyeTracker &eyeTracker, MaskerPlayer &maskerPlayer,
-    TargetPlayer &targetPlayer, OutputFile &outputFile)
+    TargetPlayer &targetPlayer, OutputFile &outputFile,
+    ClockSynchronization &clockSynchronization)
     : eyeTracker{eyeTracker}, maskerPlayer{maskerPlayer},
-      targetPlayer{targetPlayer}, outputFile{outputFile} {}
+      targetPlayer{targetPlayer}, outputFile{outputFile},
+      clockSynchronization{clockSynchronization} {}
 
 void EyeTracking::notifyThatTrialWillBegin(int /*trialNumber*/) {
+    gazeAnalytics.reset();
     eyeTracker.allocateRecordingTimeSeconds(
         Duration{trialDuration(targetPlayer, maskerPlayer)}.seconds);
     eyeTracker.start();
@@ -42,12 +46,33 @@ void EyeTracking::notifyThatTargetWillPlayAt(
 
 void EyeTracking::notifyThatStimulusHasEnded() { eyeTracker.stop(); }
 
+// The fitted model places the target start on the eye tracker clock. The
+// single pair read when the target was scheduled is only a fallback for
+// when no clock samples have been collected yet.
+static auto synchronization(const EyeTrackerTargetPlayerClockModel &model,
+    TargetStartTime targetStartTime,
+    const EyeTrackerTargetPlayerSynchronization &measured)
+    -> EyeTrackerTargetPlayerSynchronization {
+    if (model.samples == 0)
+        return measured;
+    return {eyeTrackerSystemTime(model, targetStartTime), targetStartTime};
+}
+
 void EyeTracking::notifyThatSubjectHasResponded() {
+    const auto model{clockSynchronization.model()};
     outputFile.write(lastTargetStartTime);
-    outputFile.write(lastEyeTrackerTargetPlayerSynchronization);
-    outputFile.write(eyeTracker.gazeSamples());
+    outputFile.write(synchronization(
+        model, lastTargetStartTime, lastEyeTrackerTargetPlayerSynchronization));
+    outputFile.write(model);
+    const auto gazeSamples{eyeTracker.gazeSamples()};
+    gazeAnalytics.add(gazeSamples);
+    outputFile.write(filter(gazeSamples, gazeFilterSettings));
+    outputFile.write(gazeAnalytics.statistics());
     outputFile.save();
 }
 
-void EyeTracking::notifyThatNewTestIsReady(std::string_view /*session*/) {}
+void EyeTracking::notifyThatNewTestIsReady(const Test &test) {
+    gazeFilterSettings = test.gazeFilter;
+    clockSynchronization.start();
+}
 }
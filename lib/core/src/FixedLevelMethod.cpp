@@ -2,10 +2,13 @@
 
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 namespace av_speech_in_noise {
 FixedLevelMethodImpl::FixedLevelMethodImpl(ResponseEvaluator &evaluator)
-    : evaluator{evaluator} {}
+    : evaluator{evaluator} {
+    splitCurrentTarget();
+}
 
 static void load(TargetPlaylist *list, const FixedLevelTest &test) {
     list->load(test.targetsUrl);
@@ -34,40 +37,87 @@ static void initialize(bool &usingFiniteTargetPlaylist_,
     finiteTargetsExhausted_ = finiteTargetPlaylist->empty();
 }
 
+static void assign(
+    TrialPlanPlaylist &plannedTargets, TrialPlan plan, TargetPlaylist *list) {
+    checkTargetsExist(plan);
+    plannedTargets.assign(std::move(plan), list->directory());
+}
+
 void FixedLevelMethodImpl::initialize(
     const FixedLevelFixedTrialsTest &test, TargetPlaylist *list) {
     usingFiniteTargetPlaylist_ = false;
     av_speech_in_noise::initialize(targetList, test_, snr_, test, list);
     trials_ = test.trials;
+    usingTrialPlan_ = test.compileTrialPlan;
+    if (usingTrialPlan_) {
+        assign(plannedTargets,
+            compileTrialPlan(*list, trials_, test.trialPlanSeed), list);
+        targetList = &plannedTargets;
+    }
+    splitCurrentTarget();
 }
 
 void FixedLevelMethodImpl::initialize(
     const FixedLevelTest &test, FiniteTargetPlaylistWithRepeatables *list) {
     av_speech_in_noise::initialize(targetList, test_, snr_, test, list);
+    usingTrialPlan_ = test.compileTrialPlan;
+    if (usingTrialPlan_) {
+        assign(plannedTargets, compileTrialPlan(*list, test.trialPlanSeed),
+            list);
+        targetList = &plannedTargets;
+        list = &plannedTargets;
+    }
     av_speech_in_noise::initialize(usingFiniteTargetPlaylist_,
         finiteTargetPlaylist, finiteTargetsExhausted_, list);
     finiteTargetPlaylistWithRepeatables = list;
     totalKeywordsSubmitted_ = 0;
     totalKeywordsCorrect_ = 0;
+    splitCurrentTarget();
 }
 
 void FixedLevelMethodImpl::initialize(
     const FixedLevelTest &test, FiniteTargetPlaylist *list) {
     av_speech_in_noise::initialize(targetList, test_, snr_, test, list);
+    usingTrialPlan_ = test.compileTrialPlan;
+    if (usingTrialPlan_) {
+        assign(plannedTargets, compileTrialPlan(*list, test.trialPlanSeed),
+            list);
+        targetList = &plannedTargets;
+        list = &plannedTargets;
+    }
     av_speech_in_noise::initialize(usingFiniteTargetPlaylist_,
         finiteTargetPlaylist, finiteTargetsExhausted_, list);
+    splitCurrentTarget();
 }
 
 auto FixedLevelMethodImpl::complete() -> bool {
     return usingFiniteTargetPlaylist_ ? finiteTargetsExhausted_ : trials_ == 0;
 }
 
+void FixedLevelMethodImpl::splitCurrentTarget() {
+    currentTargetPaths.clear();
+    currentTargetPath = currentTargetPaths.add(
+        {}, targetList == nullptr ? std::string{} : targetList->current().path);
+}
+
 auto FixedLevelMethodImpl::nextTarget() -> LocalUrl {
-    return targetList->next();
+    auto target{targetList->next()};
+    splitCurrentTarget();
+    return target;
 }
 
 auto FixedLevelMethodImpl::snr() -> SNR { return snr_; }
 
+auto FixedLevelMethodImpl::maskerSeekFraction() -> std::optional<double> {
+    if (usingTrialPlan_)
+        return plannedTargets.maskerSeekFraction();
+    return std::nullopt;
+}
+
+auto FixedLevelMethodImpl::trialPlan() -> const TrialPlan * {
+    return usingTrialPlan_ ? &plannedTargets.plan() : nullptr;
+}
+
 static auto current(TargetPlaylist *list) -> LocalUrl {
     return list->current();
 }
@@ -77,12 +127,13 @@ void FixedLevelMethodImpl::submit(
     lastCoordinateResponseMeasureTrial.subjectColor = response.color;
     lastCoordinateResponseMeasureTrial.subjectNumber = response.number;
     lastCoordinateResponseMeasureTrial.correctColor =
-        evaluator.correctColor(current(targetList));
+        evaluator.correctColor(currentTargetStem());
     lastCoordinateResponseMeasureTrial.correctNumber =
-        evaluator.correctNumber(current(targetList));
+        evaluator.correctNumber(currentTargetStem());
     lastCoordinateResponseMeasureTrial.correct =
-        evaluator.correct(current(targetList), response);
-    lastCoordinateResponseMeasureTrial.target = current(targetList).path;
+        evaluator.correct(currentTargetStem(), response);
+    lastCoordinateResponseMeasureTrial.target =
+        currentTargetPaths.path(currentTargetPath);
     if (usingFiniteTargetPlaylist_)
         finiteTargetsExhausted_ = finiteTargetPlaylist->empty();
     else
@@ -93,8 +144,18 @@ auto FixedLevelMethodImpl::currentTarget() -> LocalUrl {
     return current(targetList);
 }
 
+auto FixedLevelMethodImpl::currentTargetFileName() -> std::string_view {
+    return currentTargetPaths.fileName(currentTargetPath);
+}
+
+auto FixedLevelMethodImpl::currentTargetStem() -> std::string_view {
+    return currentTargetPaths.stem(currentTargetPath);
+}
+
 void FixedLevelMethodImpl::writeTestingParameters(OutputFile &file) {
     file.write(*test_);
+    if (usingTrialPlan_)
+        file.write(plannedTargets.plan());
 }
 
 void FixedLevelMethodImpl::writeLastCoordinateResponse(OutputFile &file) {
@@ -0,0 +1,174 @@
+#include "GazeAnalytics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace av_speech_in_noise {
+static auto microseconds(const Duration &d) -> std::int_least64_t {
+    return gsl::narrow_cast<std::int_least64_t>(d.seconds * 1e6);
+}
+
+static auto valid(const Gaze &g) -> bool { return g.position.valid; }
+
+static auto relativeScreen(const Gaze &g) -> Point2D {
+    return g.position.relativeScreen;
+}
+
+static void add(GazeAnalytics::RunningEyeStatistics &s, Point2D p) {
+    ++s.valid;
+    const auto deltaX{p.x - s.meanX};
+    const auto deltaY{p.y - s.meanY};
+    s.meanX += deltaX / s.valid;
+    s.meanY += deltaY / s.valid;
+    s.sumOfSquaredDeviationsX += deltaX * (p.x - s.meanX);
+    s.sumOfSquaredDeviationsY += deltaY * (p.y - s.meanY);
+}
+
+static auto standardDeviation(double sumOfSquaredDeviations, gsl::index n)
+    -> double {
+    return n > 1 ? std::sqrt(sumOfSquaredDeviations / (n - 1)) : 0;
+}
+
+static auto statistics(const GazeAnalytics::RunningEyeStatistics &s,
+    gsl::index samples) -> EyeGazeStatistics {
+    EyeGazeStatistics statistics;
+    statistics.percentValid = samples == 0 ? 0 : s.valid * 100. / samples;
+    statistics.meanRelativeScreen = {gsl::narrow_cast<float>(s.meanX),
+        gsl::narrow_cast<float>(s.meanY)};
+    statistics.standardDeviationRelativeScreen = {
+        gsl::narrow_cast<float>(
+            standardDeviation(s.sumOfSquaredDeviationsX, s.valid)),
+        gsl::narrow_cast<float>(
+            standardDeviation(s.sumOfSquaredDeviationsY, s.valid))};
+    return statistics;
+}
+
+static auto dispersion(Point2D minimum, Point2D maximum) -> double {
+    return maximum.x - minimum.x + (maximum.y - minimum.y);
+}
+
+static auto isFixation(const GazeAnalytics::FixationWindow &w,
+    const GazeAnalytics::Settings &settings) -> bool {
+    return w.open &&
+        w.lastMicroseconds - w.firstMicroseconds >=
+        microseconds(settings.minimumFixationDuration);
+}
+
+static auto isBlink(std::int_least64_t durationMicroseconds,
+    const GazeAnalytics::Settings &settings) -> bool {
+    return durationMicroseconds >=
+        microseconds(settings.minimumBlinkDuration) &&
+        durationMicroseconds <= microseconds(settings.maximumBlinkDuration);
+}
+
+static auto average(const BinocularGazeSample &sample) -> Point2D {
+    if (!valid(sample.left))
+        return relativeScreen(sample.right);
+    if (!valid(sample.right))
+        return relativeScreen(sample.left);
+    return {(relativeScreen(sample.left).x + relativeScreen(sample.right).x) /
+            2,
+        (relativeScreen(sample.left).y + relativeScreen(sample.right).y) / 2};
+}
+
+GazeAnalytics::GazeAnalytics() : settings{} {}
+
+GazeAnalytics::GazeAnalytics(const Settings &settings) : settings{settings} {}
+
+void GazeAnalytics::reset() {
+    left = {};
+    right = {};
+    fixationWindow = {};
+    invalidRun = {};
+    lastValidMicroseconds = 0;
+    samples = 0;
+    fixations = 0;
+    blinks = 0;
+    gaps = 0;
+    anyValid = false;
+}
+
+void GazeAnalytics::add(const BinocularGazeSamples &chunk) {
+    for (const auto &sample : chunk)
+        add(sample);
+}
+
+void GazeAnalytics::add(const BinocularGazeSample &sample) {
+    ++samples;
+    const auto t{sample.systemTime.microseconds};
+    if (valid(sample.left))
+        av_speech_in_noise::add(left, relativeScreen(sample.left));
+    if (valid(sample.right))
+        av_speech_in_noise::add(right, relativeScreen(sample.right));
+    if (!valid(sample.left) && !valid(sample.right)) {
+        closeFixationWindow();
+        if (!invalidRun.open) {
+            invalidRun.open = true;
+            invalidRun.firstMicroseconds = anyValid ? lastValidMicroseconds : t;
+        }
+        invalidRun.lastMicroseconds = t;
+        return;
+    }
+    closeInvalidRun(t);
+    addToFixationWindow(average(sample), t);
+    lastValidMicroseconds = t;
+    anyValid = true;
+}
+
+void GazeAnalytics::addToFixationWindow(
+    Point2D p, std::int_least64_t microseconds) {
+    if (fixationWindow.open) {
+        const Point2D minimum{std::min(fixationWindow.minimum.x, p.x),
+            std::min(fixationWindow.minimum.y, p.y)};
+        const Point2D maximum{std::max(fixationWindow.maximum.x, p.x),
+            std::max(fixationWindow.maximum.y, p.y)};
+        if (dispersion(minimum, maximum) <=
+            settings.maximumFixationDispersion) {
+            fixationWindow.minimum = minimum;
+            fixationWindow.maximum = maximum;
+            fixationWindow.lastMicroseconds = microseconds;
+            return;
+        }
+        closeFixationWindow();
+    }
+    fixationWindow.open = true;
+    fixationWindow.minimum = p;
+    fixationWindow.maximum = p;
+    fixationWindow.firstMicroseconds = microseconds;
+    fixationWindow.lastMicroseconds = microseconds;
+}
+
+void GazeAnalytics::closeFixationWindow() {
+    if (isFixation(fixationWindow, settings))
+        ++fixations;
+    fixationWindow.open = false;
+}
+
+void GazeAnalytics::closeInvalidRun(std::int_least64_t microseconds) {
+    if (!invalidRun.open)
+        return;
+    if (isBlink(microseconds - invalidRun.firstMicroseconds, settings))
+        ++blinks;
+    else
+        ++gaps;
+    invalidRun.open = false;
+}
+
+auto GazeAnalytics::statistics() const -> BinocularGazeStatistics {
+    BinocularGazeStatistics statistics;
+    statistics.left = av_speech_in_noise::statistics(left, samples);
+    statistics.right = av_speech_in_noise::statistics(right, samples);
+    statistics.fixations =
+        fixations + (isFixation(fixationWindow, settings) ? 1 : 0);
+    statistics.blinks = blinks;
+    statistics.gaps = gaps;
+    if (invalidRun.open) {
+        if (isBlink(invalidRun.lastMicroseconds - invalidRun.firstMicroseconds,
+                settings))
+            ++statistics.blinks;
+        else
+            ++statistics.gaps;
+    }
+    return statistics;
+}
+}
@@ -0,0 +1,170 @@
+#include "GazeFilter.hpp"
+
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+struct WeightedPoint {
+    double x{};
+    double y{};
+    double z{};
+};
+
+struct WeightedGaze {
+    WeightedPoint origin;
+    double originWeight{};
+    WeightedPoint positionTrackbox;
+    WeightedPoint positionScreen;
+    double positionWeight{};
+};
+}
+
+constexpr auto pi{3.14159265358979323846};
+
+// A window that has lost more than half its weight to invalid samples is
+// mostly gap, so the sample it is centered on is passed through unfiltered.
+constexpr auto minimumValidWeight{0.5};
+
+static auto size(const BinocularGazeSamples &v) -> gsl::index {
+    return v.size();
+}
+
+static auto size(const std::vector<double> &v) -> gsl::index {
+    return v.size();
+}
+
+static void accumulate(WeightedPoint &sum, Point3D p, double weight) {
+    sum.x += weight * p.x;
+    sum.y += weight * p.y;
+    sum.z += weight * p.z;
+}
+
+static void accumulate(WeightedPoint &sum, Point2D p, double weight) {
+    sum.x += weight * p.x;
+    sum.y += weight * p.y;
+}
+
+static void accumulate(WeightedGaze &sum, const Gaze &gaze, double weight) {
+    if (gaze.origin.valid) {
+        accumulate(sum.origin, gaze.origin.relativeTrackbox, weight);
+        sum.originWeight += weight;
+    }
+    if (gaze.position.valid) {
+        accumulate(
+            sum.positionTrackbox, gaze.position.relativeTrackbox, weight);
+        accumulate(sum.positionScreen, gaze.position.relativeScreen, weight);
+        sum.positionWeight += weight;
+    }
+}
+
+static void assignAverage(
+    Point3D &p, const WeightedPoint &sum, double weight) {
+    p.x = gsl::narrow_cast<float>(sum.x / weight);
+    p.y = gsl::narrow_cast<float>(sum.y / weight);
+    p.z = gsl::narrow_cast<float>(sum.z / weight);
+}
+
+static void assignAverage(
+    Point2D &p, const WeightedPoint &sum, double weight) {
+    p.x = gsl::narrow_cast<float>(sum.x / weight);
+    p.y = gsl::narrow_cast<float>(sum.y / weight);
+}
+
+static auto average(const WeightedGaze &sum, const Gaze &center) -> Gaze {
+    auto gaze{center};
+    if (center.origin.valid && sum.originWeight >= minimumValidWeight)
+        assignAverage(
+            gaze.origin.relativeTrackbox, sum.origin, sum.originWeight);
+    if (center.position.valid && sum.positionWeight >= minimumValidWeight) {
+        assignAverage(gaze.position.relativeTrackbox, sum.positionTrackbox,
+            sum.positionWeight);
+        assignAverage(gaze.position.relativeScreen, sum.positionScreen,
+            sum.positionWeight);
+    }
+    return gaze;
+}
+
+// Invalid samples contribute nothing, and the remaining weights are
+// renormalized, so values from the far side of a gap never leak in.
+static auto convolve(const BinocularGazeSamples &samples,
+    const std::vector<double> &kernel, gsl::index stride)
+    -> BinocularGazeSamples {
+    const auto half{size(kernel) / 2};
+    BinocularGazeSamples filtered;
+    filtered.reserve(samples.size() / stride + 1);
+    for (gsl::index center{0}; center < size(samples); center += stride) {
+        WeightedGaze left;
+        WeightedGaze right;
+        for (gsl::index k{0}; k < size(kernel); ++k) {
+            const auto i{center + k - half};
+            if (i < 0 || i >= size(samples))
+                continue;
+            accumulate(left, samples.at(i).left, kernel.at(k));
+            accumulate(right, samples.at(i).right, kernel.at(k));
+        }
+        filtered.push_back({samples.at(center).systemTime,
+            average(left, samples.at(center).left),
+            average(right, samples.at(center).right)});
+    }
+    return filtered;
+}
+
+static auto medianPeriodMicroseconds(const BinocularGazeSamples &samples)
+    -> double {
+    std::vector<std::int_least64_t> periods;
+    periods.reserve(samples.size());
+    for (gsl::index i{1}; i < size(samples); ++i)
+        periods.push_back(samples.at(i).systemTime.microseconds -
+            samples.at(i - 1).systemTime.microseconds);
+    const auto median{periods.begin() + periods.size() / 2};
+    std::nth_element(periods.begin(), median, periods.end());
+    return static_cast<double>(*median);
+}
+
+// Hamming-windowed sinc with its cutoff below the output Nyquist frequency
+static auto antiAliasingKernel(gsl::index factor) -> std::vector<double> {
+    const auto half{2 * factor};
+    const auto cutoff{0.8 * 0.5 / factor};
+    std::vector<double> kernel(2 * half + 1);
+    for (gsl::index k{0}; k < size(kernel); ++k) {
+        const auto n{static_cast<double>(k - half)};
+        const auto sinc{n == 0
+                ? 1.
+                : std::sin(2 * pi * cutoff * n) / (2 * pi * cutoff * n)};
+        const auto window{0.54 + 0.46 * std::cos(pi * n / half)};
+        kernel.at(k) = sinc * window;
+    }
+    const auto sum{std::accumulate(kernel.begin(), kernel.end(), 0.)};
+    for (auto &weight : kernel)
+        weight /= sum;
+    return kernel;
+}
+
+auto decimate(const BinocularGazeSamples &samples, double outputRateHz)
+    -> BinocularGazeSamples {
+    if (outputRateHz <= 0 || samples.size() < 2)
+        return samples;
+    const auto period{medianPeriodMicroseconds(samples)};
+    if (period <= 0)
+        return samples;
+    const auto factor{std::lround(1e6 / period / outputRateHz)};
+    if (factor <= 1)
+        return samples;
+    return convolve(samples, antiAliasingKernel(factor), factor);
+}
+
+auto smooth(const BinocularGazeSamples &samples) -> BinocularGazeSamples {
+    return convolve(samples, {0.25, 0.5, 0.25}, 1);
+}
+
+auto filter(const BinocularGazeSamples &samples,
+    const GazeFilterSettings &settings) -> BinocularGazeSamples {
+    auto filtered{decimate(samples, settings.outputRateHz)};
+    return settings.smoothing ? smooth(filtered) : filtered;
+}
+}
@@ -0,0 +1,239 @@
+#include "IndexedOutputFile.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace av_speech_in_noise {
+IndexedOutputFile::IndexedOutputFile(OutputFile &file) : file{file} {}
+
+void IndexedOutputFile::openNewFile(const TestIdentity &identity) {
+    file.openNewFile(identity);
+    currentTest.reset();
+    fixedLevelSnr_dB.reset();
+    const auto parent{file.parentPath()};
+    if (parent == directory)
+        return;
+    flush();
+    directory = parent;
+    store_ = {};
+    readOffset = 0;
+    readNewRecords();
+}
+
+void IndexedOutputFile::add(TestRecord record, const Test &test) {
+    record.identity = test.identity;
+    record.targetsUrl = test.targetsUrl;
+    record.maskerFileUrl = test.maskerFileUrl;
+    record.maskerLevel = test.maskerLevel;
+    record.condition = test.condition;
+    currentTest = store_.add(std::move(record));
+}
+
+void IndexedOutputFile::add(const Target &target, std::optional<bool> correct,
+    std::optional<double> reactionTimeMilliseconds,
+    std::optional<int> snr_dB) {
+    if (!currentTest)
+        return;
+    TrialRecord record;
+    record.test = *currentTest;
+    record.target = target.target;
+    record.correct = correct;
+    record.reactionTimeMilliseconds = reactionTimeMilliseconds;
+    record.snr_dB = snr_dB ? snr_dB : fixedLevelSnr_dB;
+    store_.add(record);
+}
+
+// Only whole lines are read, so a record that another instance is part way
+// through appending is picked up the next time.
+void IndexedOutputFile::readNewRecords() {
+    std::ifstream stream{directory / storeFileName, std::ios::binary};
+    if (!stream.seekg(readOffset))
+        return;
+    const std::string appended{std::istreambuf_iterator<char>{stream}, {}};
+    const auto end{appended.rfind('\n')};
+    if (end == std::string::npos)
+        return;
+    std::stringstream lines{appended.substr(0, end + 1)};
+    store_.read(lines);
+    readOffset += gsl::narrow_cast<std::streamoff>(end + 1);
+}
+
+static auto endsInTornLine(const std::filesystem::path &path) -> bool {
+    std::ifstream stream{path, std::ios::binary | std::ios::ate};
+    if (!stream || stream.tellg() <= 0)
+        return false;
+    stream.seekg(-1, std::ios::end);
+    return stream.get() != '\n';
+}
+
+// Other instances may have appended since this one last read, so their
+// records are read first. A line left torn by a crash is terminated so
+// that it can't swallow the first record appended after it.
+void IndexedOutputFile::flush() {
+    if (directory.empty())
+        return;
+    readNewRecords();
+    std::stringstream records;
+    store_.writeNewRecords(records);
+    if (records.tellp() <= 0)
+        return;
+    const auto path{directory / storeFileName};
+    const auto torn{endsInTornLine(path)};
+    std::ofstream stream{path, std::ios::app | std::ios::binary};
+    if (torn)
+        stream << '\n';
+    stream << records.str();
+}
+
+void IndexedOutputFile::write(
+    const coordinate_response_measure::AdaptiveTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct, std::nullopt, trial.snr.dB);
+}
+
+void IndexedOutputFile::write(
+    const coordinate_response_measure::FixedLevelTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct);
+}
+
+void IndexedOutputFile::write(const FreeResponseTrial &trial) {
+    file.write(trial);
+    add(trial);
+}
+
+void IndexedOutputFile::write(const KeyPressTrial &trial) {
+    file.write(trial);
+    add(trial, std::nullopt, trial.rt.milliseconds);
+}
+
+void IndexedOutputFile::write(const CorrectKeywordsTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct, std::nullopt, trial.snr.dB);
+}
+
+void IndexedOutputFile::write(const open_set::AdaptiveTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct, std::nullopt, trial.snr.dB);
+}
+
+void IndexedOutputFile::write(const ConsonantTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct);
+}
+
+void IndexedOutputFile::write(const EmotionTrial &trial) {
+    file.write(trial);
+    add(trial, std::nullopt, trial.reactionTimeMilliseconds);
+}
+
+void IndexedOutputFile::write(const AdaptiveTest &test) {
+    file.write(test);
+    TestRecord record;
+    record.startingSnr = test.startingSnr;
+    record.trackingRule = test.trackingRule;
+    add(std::move(record), test);
+    fixedLevelSnr_dB.reset();
+}
+
+void IndexedOutputFile::write(const FixedLevelTest &test) {
+    file.write(test);
+    TestRecord record;
+    record.startingSnr = test.snr;
+    add(std::move(record), test);
+    fixedLevelSnr_dB = test.snr.dB;
+}
+
+void IndexedOutputFile::write(const TrialPlan &plan) { file.write(plan); }
+
+void IndexedOutputFile::write(const TrialPlanAmendment &amendment) {
+    file.write(amendment);
+}
+
+void IndexedOutputFile::write(const AdaptiveTestResults &results) {
+    file.write(results);
+    if (!currentTest)
+        return;
+    for (const auto &result : results) {
+        ThresholdRecord record;
+        record.test = *currentTest;
+        record.targetsUrl = result.targetsUrl;
+        record.threshold = result.threshold;
+        store_.add(record);
+    }
+}
+
+void IndexedOutputFile::write(const BinocularGazeSamples &samples) {
+    file.write(samples);
+}
+
+void IndexedOutputFile::write(const BinocularGazeStatistics &statistics) {
+    file.write(statistics);
+}
+
+void IndexedOutputFile::write(TargetStartTime t) { file.write(t); }
+
+void IndexedOutputFile::write(MaskerSeek s) { file.write(s); }
+
+void IndexedOutputFile::write(const EyeTrackerTargetPlayerSynchronization &s) {
+    file.write(s);
+}
+
+void IndexedOutputFile::write(const EyeTrackerTargetPlayerClockModel &m) {
+    file.write(m);
+}
+
+void IndexedOutputFile::write(const ThreeKeywordsTrial &trial) {
+    file.write(trial);
+    add(trial);
+}
+
+void IndexedOutputFile::write(const SyllableTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct);
+}
+
+void IndexedOutputFile::write(const PassFailTrial &trial) {
+    file.write(trial);
+    add(trial, trial.correct);
+}
+
+void IndexedOutputFile::write(Writable &w) { file.write(w); }
+
+void IndexedOutputFile::close() {
+    file.close();
+    flush();
+}
+
+void IndexedOutputFile::save() {
+    file.save();
+    flush();
+}
+
+auto IndexedOutputFile::parentPath() -> std::filesystem::path {
+    return file.parentPath();
+}
+
+auto IndexedOutputFile::store() const -> const ResultsStore & {
+    return store_;
+}
+
+void readResultsStores(
+    ResultsStore &store, const std::filesystem::path &directory) {
+    std::vector<std::filesystem::path> paths;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator{
+             directory,
+             std::filesystem::directory_options::skip_permission_denied})
+        if (entry.path().filename() == IndexedOutputFile::storeFileName)
+            paths.push_back(entry.path());
+    std::sort(paths.begin(), paths.end());
+    for (const auto &path : paths) {
+        std::ifstream stream{path};
+        store.read(stream);
+    }
+}
+}
@@ -0,0 +1,111 @@
+#include "OfflinePlayers.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace av_speech_in_noise {
+static auto nanoseconds(Duration d) -> std::uintmax_t {
+    return std::llround(d.seconds * 1e9);
+}
+
+static auto seconds(PlayerTime t) -> double {
+    return static_cast<double>(t.system) / 1e9;
+}
+
+OfflineTargetPlayer::OfflineTargetPlayer(
+    VirtualTime &time, StimulusDescriptions &stimuli)
+    : time{time}, stimuli{stimuli} {}
+
+void OfflineTargetPlayer::attach(Observer *o) { observer = o; }
+
+void OfflineTargetPlayer::playAfter(Duration delay) {
+    playing_ = true;
+    time.schedule(
+        Duration{delay.seconds + stimulus.duration.seconds}, [this]() {
+            playing_ = false;
+            if (observer != nullptr)
+                observer->playbackComplete();
+        });
+}
+
+void OfflineTargetPlayer::play() { playAfter(Duration{0}); }
+
+void OfflineTargetPlayer::playAt(const PlayerTimeWithDelay &t) {
+    playAfter(Duration{std::max(0.,
+        seconds(t.playerTime) + t.delay.seconds - time.now().seconds)});
+}
+
+auto OfflineTargetPlayer::playing() -> bool { return playing_; }
+
+void OfflineTargetPlayer::loadFile(const LocalUrl &url, RationalNumber) {
+    stimulus = stimuli.describe(url);
+}
+
+auto OfflineTargetPlayer::digitalLevel() -> DigitalLevel {
+    return stimulus.digitalLevel;
+}
+
+auto OfflineTargetPlayer::duration() -> Duration { return stimulus.duration; }
+
+void OfflineTargetPlayer::preRoll() {
+    time.schedule(Duration{0}, [this]() {
+        if (observer != nullptr)
+            observer->notifyThatPreRollHasCompleted();
+    });
+}
+
+OfflineMaskerPlayer::OfflineMaskerPlayer(VirtualTime &time,
+    StimulusDescriptions &stimuli, Duration rampDuration, double sampleRateHz)
+    : time{time}, stimuli{stimuli}, rampDuration_{rampDuration},
+      sampleRateHz_{sampleRateHz} {}
+
+void OfflineMaskerPlayer::attach(Observer *o) { observer = o; }
+
+auto OfflineMaskerPlayer::outputAudioDeviceDescriptions()
+    -> std::vector<std::string> {
+    return {audioDevice};
+}
+
+void OfflineMaskerPlayer::fadeIn() {
+    const auto fadeInComplete{
+        Duration{time.now().seconds + rampDuration_.seconds}};
+    time.schedule(rampDuration_, [this, fadeInComplete]() {
+        if (observer != nullptr)
+            observer->fadeInComplete(
+                {PlayerTime{av_speech_in_noise::nanoseconds(fadeInComplete)},
+                    0});
+    });
+    time.schedule(Duration{2 * rampDuration_.seconds +
+                      steadyLevelDuration.seconds},
+        [this]() {
+            if (observer != nullptr)
+                observer->fadeOutComplete();
+        });
+}
+
+void OfflineMaskerPlayer::loadFile(const LocalUrl &url) {
+    stimulus = stimuli.describe(url);
+}
+
+auto OfflineMaskerPlayer::digitalLevel() -> DigitalLevel {
+    return stimulus.digitalLevel;
+}
+
+auto OfflineMaskerPlayer::duration() -> Duration { return stimulus.duration; }
+
+auto OfflineMaskerPlayer::sampleRateHz() -> double { return sampleRateHz_; }
+
+auto OfflineMaskerPlayer::rampDuration() -> Duration { return rampDuration_; }
+
+auto OfflineMaskerPlayer::nanoseconds(PlayerTime t) -> std::uintmax_t {
+    return t.system;
+}
+
+auto OfflineMaskerPlayer::currentSystemTime() -> PlayerTime {
+    return PlayerTime{av_speech_in_noise::nanoseconds(time.now())};
+}
+
+void OfflineMaskerPlayer::setSteadyLevelFor(Duration d) {
+    steadyLevelDuration = d;
+}
+}
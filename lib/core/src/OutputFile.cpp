@@ -1,11 +1,15 @@
 #include "OutputFile.hpp"
 #include "IOutputFile.hpp"
+#include "Tracing.hpp"
+#include "TrialPlan.hpp"
 
 #include <av-speech-in-noise/Interface.hpp>
 
 #include <sstream>
 #include <ostream>
 #include <algorithm>
+#include <iomanip>
+#include <limits>
 
 namespace av_speech_in_noise {
 enum class OutputFileImpl::Trial {
@@ -191,6 +195,16 @@ static auto operator<<(
     insertLabeledLine(stream, "reversals per step size", runCounts);
     insertLabeledLine(stream, "step sizes (dB)", stepSizes);
     insertLabeledLine(stream, "threshold reversals", test.thresholdReversals);
+    if (test.trackSelection != TrackSelection::random)
+        insertLabeledLine(stream, "track selection", name(test.trackSelection));
+    if (test.trackAlgorithm != TrackAlgorithm::staircase)
+        insertLabeledLine(stream, "track", name(test.trackAlgorithm));
+    if (test.convergenceReversals != 0) {
+        insertLabeledLine(
+            stream, "convergence reversals", test.convergenceReversals);
+        insertLabeledLine(stream, "convergence standard error (dB)",
+            test.convergenceStandardErrorDb);
+    }
     return insertNewLine(stream);
 }
 
@@ -264,11 +278,59 @@ static auto operator<<(std::ostream &stream,
     return insertNewLine(stream);
 }
 
+static auto operator<<(std::ostream &stream,
+    const BinocularGazeStatistics &statistics) -> std::ostream & {
+    insert(stream, HeadingItem::leftGazeValidPercent);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::rightGazeValidPercent);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::leftMeanGazePositionRelativeScreen);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::rightMeanGazePositionRelativeScreen);
+    insertCommaAndSpace(stream);
+    insert(
+        stream, HeadingItem::leftGazePositionRelativeScreenStandardDeviation);
+    insertCommaAndSpace(stream);
+    insert(
+        stream, HeadingItem::rightGazePositionRelativeScreenStandardDeviation);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::fixations);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::blinks);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::gaps);
+    insertNewLine(stream);
+    insert(stream, statistics.left.percentValid);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.right.percentValid);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.left.meanRelativeScreen);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.right.meanRelativeScreen);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.left.standardDeviationRelativeScreen);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.right.standardDeviationRelativeScreen);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.fixations);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.blinks);
+    insertCommaAndSpace(stream);
+    insert(stream, statistics.gaps);
+    return insertNewLine(stream);
+}
+
 static auto operator<<(
     std::ostream &stream, TargetStartTime t) -> std::ostream & {
     return insertLabeledLine(stream, "target start time (ns)", t.nanoseconds);
 }
 
+// In full, so that replaying the trial lands on the same masker sample.
+static auto operator<<(std::ostream &stream, MaskerSeek s) -> std::ostream & {
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    return insertLabeledLine(stream, "masker seek (s)", s.seconds);
+}
+
 static auto operator<<(std::ostream &stream,
     const EyeTrackerTargetPlayerSynchronization &s) -> std::ostream & {
     insert(stream, HeadingItem::eyeTrackerTime);
@@ -281,10 +343,72 @@ static auto operator<<(std::ostream &stream,
     return insertNewLine(stream);
 }
 
+static auto operator<<(std::ostream &stream,
+    const EyeTrackerTargetPlayerClockModel &m) -> std::ostream & {
+    insert(stream, HeadingItem::clockReference);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::eyeTrackerTimeAtClockReference);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::clockDrift);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::clockResidualStandardDeviation);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::clockSamples);
+    insertNewLine(stream);
+    insert(stream, m.reference.nanoseconds);
+    insertCommaAndSpace(stream);
+    insert(stream, m.eyeTrackerSystemTimeAtReference.microseconds);
+    insertCommaAndSpace(stream);
+    insert(stream, m.driftPartsPerMillion);
+    insertCommaAndSpace(stream);
+    insert(stream, m.residualStandardDeviationMicroseconds);
+    insertCommaAndSpace(stream);
+    insert(stream, m.samples);
+    return insertNewLine(stream);
+}
+
+// Seek fractions are written in full so that a trial can be replayed
+// exactly from the file.
+static auto operator<<(std::ostream &stream, const TrialPlan &plan)
+    -> std::ostream & {
+    insertLabeledLine(stream, "trial plan seed", plan.seed);
+    insert(stream, HeadingItem::trialNumber);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::maskerSeekFraction);
+    insertCommaAndSpace(stream);
+    insert(stream, HeadingItem::target);
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    auto trial{0};
+    for (const auto &planned : plan.trials) {
+        insertNewLine(stream);
+        insert(stream, ++trial);
+        insertCommaAndSpace(stream);
+        insert(stream, planned.maskerSeekFraction);
+        insertCommaAndSpace(stream);
+        insert(stream, planned.target.path);
+    }
+    insertNewLine(stream);
+    return insertNewLine(stream);
+}
+
+static auto operator<<(std::ostream &stream,
+    const TrialPlanAmendment &amendment) -> std::ostream & {
+    std::stringstream value;
+    value << std::setprecision(std::numeric_limits<double>::max_digits10)
+          << amendment.trial << ", " << amendment.planned.maskerSeekFraction
+          << ", " << amendment.planned.target.path;
+    return insertLabeledLine(stream, "trial plan amendment", value.str());
+}
+
 static auto operator<<(
     std::ostream &stream, const AdaptiveTestResult &result) -> std::ostream & {
-    return insertLabeledLine(
+    insertLabeledLine(
         stream, "threshold for " + result.targetsUrl.path, result.threshold);
+    if (result.stoppingReason != TrackStoppingReason::none)
+        insertLabeledLine(stream,
+            "stopping reason for " + result.targetsUrl.path,
+            name(result.stoppingReason));
+    return stream;
 }
 
 static auto operator<<(
@@ -765,24 +889,54 @@ void OutputFileImpl::write(const FixedLevelTest &test) {
     write(string(stream));
 }
 
+void OutputFileImpl::write(const TrialPlan &plan) {
+    std::stringstream stream;
+    stream << plan;
+    write(string(stream));
+}
+
+void OutputFileImpl::write(const TrialPlanAmendment &amendment) {
+    std::stringstream stream;
+    stream << amendment;
+    write(string(stream));
+}
+
 void OutputFileImpl::write(const BinocularGazeSamples &gazeSamples) {
     std::stringstream stream;
     stream << gazeSamples;
     write(string(stream));
 }
 
+void OutputFileImpl::write(const BinocularGazeStatistics &statistics) {
+    std::stringstream stream;
+    stream << statistics;
+    write(string(stream));
+}
+
 void OutputFileImpl::write(TargetStartTime t) {
     std::stringstream stream;
     stream << t;
     write(string(stream));
 }
 
+void OutputFileImpl::write(MaskerSeek s) {
+    std::stringstream stream;
+    stream << s;
+    write(string(stream));
+}
+
 void OutputFileImpl::write(const EyeTrackerTargetPlayerSynchronization &s) {
     std::stringstream stream;
     stream << s;
     write(string(stream));
 }
 
+void OutputFileImpl::write(const EyeTrackerTargetPlayerClockModel &m) {
+    std::stringstream stream;
+    stream << m;
+    write(string(stream));
+}
+
 void OutputFileImpl::openNewFile(const TestIdentity &test) {
     writer.open(generateNewFilePath(test));
     if (writer.failed())
@@ -798,7 +952,10 @@ auto OutputFileImpl::generateNewFilePath(
 
 void OutputFileImpl::close() { writer.close(); }
 
-void OutputFileImpl::save() { writer.save(); }
+void OutputFileImpl::save() {
+    tracing::Span span{"saveOutputFile"};
+    writer.save();
+}
 
 void OutputFileImpl::write(const AdaptiveTestResults &results) {
     std::stringstream stream;
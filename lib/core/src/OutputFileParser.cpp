@@ -0,0 +1,548 @@
+#include "OutputFileParser.hpp"
+#include "WorkStealing.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+enum class Table {
+    trial,
+    gazeSamples,
+    gazeStatistics,
+    synchronization,
+    clockModel,
+    trialPlan
+};
+
+struct TrialFormat {
+    OutputFileTrialType type{};
+    std::vector<HeadingItem> columns;
+    bool flaggable{};
+};
+
+struct Heading {
+    Table table{};
+    const TrialFormat *trialFormat{};
+};
+}
+
+constexpr std::string_view fieldDelimiter{", "};
+constexpr std::string_view labelDelimiter{": "};
+constexpr std::string_view flagged{", FLAGGED"};
+constexpr std::string_view thresholdLabel{"threshold for "};
+constexpr std::string_view stoppingReasonLabel{"stopping reason for "};
+constexpr std::string_view targetStartTimeLabel{"target start time (ns)"};
+constexpr std::string_view maskerSeekLabel{"masker seek (s)"};
+
+static auto trialFormats() -> const std::vector<TrialFormat> & {
+    using Type = OutputFileTrialType;
+    using H = HeadingItem;
+    static const std::vector<TrialFormat> formats{
+        {Type::fixedLevelCoordinateResponse,
+            {H::correctNumber, H::subjectNumber, H::correctColor,
+                H::subjectColor, H::evaluation, H::target}},
+        {Type::adaptiveCoordinateResponse,
+            {H::snr_dB, H::correctNumber, H::subjectNumber, H::correctColor,
+                H::subjectColor, H::evaluation, H::reversals}},
+        {Type::freeResponse, {H::time, H::target, H::freeResponse}, true},
+        {Type::openSetAdaptive,
+            {H::snr_dB, H::target, H::evaluation, H::reversals}},
+        {Type::correctKeywords,
+            {H::snr_dB, H::target, H::correctKeywords, H::evaluation,
+                H::reversals}},
+        {Type::consonant,
+            {H::correctConsonant, H::subjectConsonant, H::evaluation,
+                H::target}},
+        {Type::threeKeywords,
+            {H::target, H::firstKeywordEvaluation, H::secondKeywordEvaluation,
+                H::thirdKeywordEvaluation},
+            true},
+        {Type::syllable,
+            {H::correctSyllable, H::subjectSyllable, H::evaluation,
+                H::target},
+            true},
+        {Type::keyPress,
+            {H::target, H::keyPressed, H::reactionTime,
+                H::vibrotactileDuration, H::vibrotactileDelay}},
+        {Type::emotion, {H::target, H::emotion, H::reactionTime}},
+        {Type::passFail, {H::target, H::evaluation}}};
+    return formats;
+}
+
+static auto heading(const std::vector<HeadingItem> &items) -> std::string {
+    std::string line;
+    for (const auto item : items) {
+        if (!line.empty())
+            line += fieldDelimiter;
+        line += name(item);
+    }
+    return line;
+}
+
+static auto headings() -> const std::map<std::string, Heading, std::less<>> & {
+    using H = HeadingItem;
+    static const auto headings{[] {
+        std::map<std::string, Heading, std::less<>> headings;
+        for (const auto &format : trialFormats())
+            headings[heading(format.columns)] = {Table::trial, &format};
+        headings[heading({H::eyeTrackerTime, H::leftGazePositionRelativeScreen,
+            H::rightGazePositionRelativeScreen,
+            H::leftGazePositionRelativeTracker,
+            H::rightGazePositionRelativeTracker,
+            H::leftGazeOriginRelativeTracker,
+            H::rightGazeOriginRelativeTracker,
+            H::leftGazePositionRelativeScreenIsValid,
+            H::rightGazePositionRelativeScreenIsValid,
+            H::leftGazePositionRelativeTrackerIsValid,
+            H::rightGazePositionRelativeTrackerIsValid,
+            H::leftGazeOriginRelativeTrackerIsValid,
+            H::rightGazeOriginRelativeTrackerIsValid})] = {Table::gazeSamples};
+        headings[heading({H::leftGazeValidPercent, H::rightGazeValidPercent,
+            H::leftMeanGazePositionRelativeScreen,
+            H::rightMeanGazePositionRelativeScreen,
+            H::leftGazePositionRelativeScreenStandardDeviation,
+            H::rightGazePositionRelativeScreenStandardDeviation,
+            H::fixations, H::blinks, H::gaps})] = {Table::gazeStatistics};
+        headings[heading({H::eyeTrackerTime, H::targetPlayerTime})] = {
+            Table::synchronization};
+        headings[heading({H::clockReference, H::eyeTrackerTimeAtClockReference,
+            H::clockDrift, H::clockResidualStandardDeviation,
+            H::clockSamples})] = {Table::clockModel};
+        headings[heading({H::trialNumber, H::maskerSeekFraction, H::target})] =
+            {Table::trialPlan};
+        return headings;
+    }()};
+    return headings;
+}
+
+static auto labels() -> const std::set<std::string, std::less<>> & {
+    static const std::set<std::string, std::less<>> labels{"subject",
+        "tester", "session", "method", "RME setting", "transducer", "masker",
+        "targets", "masker level (dB SPL)", "starting SNR (dB)", "SNR (dB)",
+        "condition", "up", "down", "reversals per step size",
+        "step sizes (dB)", "threshold reversals", "convergence reversals",
+        "convergence standard error (dB)", "track selection", "track",
+        "trial plan seed", "trial plan amendment"};
+    return labels;
+}
+
+static auto startsWith(std::string_view s, std::string_view prefix) -> bool {
+    return s.substr(0, prefix.size()) == prefix;
+}
+
+static auto endsWith(std::string_view s, std::string_view suffix) -> bool {
+    return s.size() >= suffix.size() &&
+        s.substr(s.size() - suffix.size()) == suffix;
+}
+
+static auto nextField(std::string_view &rest)
+    -> std::optional<std::string_view> {
+    const auto end{rest.find(fieldDelimiter)};
+    if (end == std::string_view::npos)
+        return std::nullopt;
+    const auto field{rest.substr(0, end)};
+    rest.remove_prefix(end + fieldDelimiter.size());
+    return field;
+}
+
+// Exact when the digits fit in a double's mantissa and the power of ten is
+// itself exact, which covers what the writer's six significant digits
+// produce.
+static auto parseShortDecimal(std::string_view s, double &x) -> bool {
+    constexpr std::array<double, 23> powersOfTen{1e0, 1e1, 1e2, 1e3, 1e4,
+        1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16,
+        1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    constexpr std::uint64_t maximumExactMantissa{1ULL << 53U};
+    gsl::index i{0};
+    const auto n{gsl::narrow_cast<gsl::index>(s.size())};
+    const auto negative{i < n && s[i] == '-'};
+    if (negative)
+        ++i;
+    std::uint64_t mantissa{0};
+    auto exponent{0};
+    auto digits{0};
+    for (; i < n && s[i] >= '0' && s[i] <= '9'; ++i, ++digits)
+        mantissa = mantissa * 10 + (s[i] - '0');
+    if (i < n && s[i] == '.')
+        for (++i; i < n && s[i] >= '0' && s[i] <= '9'; ++i, ++digits) {
+            mantissa = mantissa * 10 + (s[i] - '0');
+            --exponent;
+        }
+    if (digits == 0 || digits > 15)
+        return false;
+    if (i < n && (s[i] == 'e' || s[i] == 'E')) {
+        auto written{0};
+        const auto *const end{s.data() + n};
+        auto begin{s.data() + i + 1};
+        if (begin != end && *begin == '+')
+            ++begin;
+        const auto result{std::from_chars(begin, end, written)};
+        if (result.ec != std::errc{} || result.ptr != end)
+            return false;
+        exponent += written;
+        i = n;
+    }
+    if (i != n || mantissa > maximumExactMantissa ||
+        std::abs(exponent) >= gsl::narrow_cast<int>(powersOfTen.size()))
+        return false;
+    const auto magnitude{exponent < 0
+            ? static_cast<double>(mantissa) / powersOfTen.at(-exponent)
+            : static_cast<double>(mantissa) * powersOfTen.at(exponent)};
+    x = negative ? -magnitude : magnitude;
+    return true;
+}
+
+// The writer's streams format floating point values in the classic locale,
+// which strtod reads; it needs a terminated copy of the field.
+static auto parse(std::string_view s, double &x) -> bool {
+    if (parseShortDecimal(s, x))
+        return true;
+    std::array<char, 64> buffer{};
+    if (s.empty() || s.size() >= buffer.size())
+        return false;
+    std::copy(s.begin(), s.end(), buffer.begin());
+    char *end{};
+    x = std::strtod(buffer.data(), &end);
+    return end == buffer.data() + s.size();
+}
+
+static auto parse(std::string_view s, float &x) -> bool {
+    double y{};
+    if (!parse(s, y))
+        return false;
+    x = gsl::narrow_cast<float>(y);
+    return true;
+}
+
+template <typename T>
+auto parseInteger(std::string_view s, T &x) -> bool {
+    const auto *const end{s.data() + s.size()};
+    const auto result{std::from_chars(s.data(), end, x)};
+    return result.ec == std::errc{} && result.ptr == end;
+}
+
+static auto parse(std::string_view s, Point2D &p) -> bool {
+    const auto space{s.find(' ')};
+    return space != std::string_view::npos &&
+        parse(s.substr(0, space), p.x) && parse(s.substr(space + 1), p.y);
+}
+
+static auto parse(std::string_view s, Point3D &p) -> bool {
+    const auto first{s.find(' ')};
+    if (first == std::string_view::npos)
+        return false;
+    const auto second{s.find(' ', first + 1)};
+    return second != std::string_view::npos &&
+        parse(s.substr(0, first), p.x) &&
+        parse(s.substr(first + 1, second - first - 1), p.y) &&
+        parse(s.substr(second + 1), p.z);
+}
+
+static auto parseValidity(std::string_view s, bool &valid) -> bool {
+    if (s != "y" && s != "n")
+        return false;
+    valid = s == "y";
+    return true;
+}
+
+static auto parseGazeSample(std::string_view rest, BinocularGazeSample &g)
+    -> bool {
+    std::array<std::string_view, 13> f;
+    for (gsl::index i{0}; i < 12; ++i) {
+        const auto field{nextField(rest)};
+        if (!field)
+            return false;
+        f.at(i) = *field;
+    }
+    f.back() = rest;
+    auto positionValid{std::array<bool, 4>{}};
+    const auto parsed{parseInteger(f[0], g.systemTime.microseconds) &&
+        parse(f[1], g.left.position.relativeScreen) &&
+        parse(f[2], g.right.position.relativeScreen) &&
+        parse(f[3], g.left.position.relativeTrackbox) &&
+        parse(f[4], g.right.position.relativeTrackbox) &&
+        parse(f[5], g.left.origin.relativeTrackbox) &&
+        parse(f[6], g.right.origin.relativeTrackbox) &&
+        parseValidity(f[7], positionValid[0]) &&
+        parseValidity(f[8], positionValid[1]) &&
+        parseValidity(f[9], positionValid[2]) &&
+        parseValidity(f[10], positionValid[3]) &&
+        parseValidity(f[11], g.left.origin.valid) &&
+        parseValidity(f[12], g.right.origin.valid)};
+    g.left.position.valid = positionValid[0] && positionValid[2];
+    g.right.position.valid = positionValid[1] && positionValid[3];
+    return parsed;
+}
+
+static auto parseGazeStatistics(std::string_view rest,
+    BinocularGazeStatistics &s) -> bool {
+    std::array<std::string_view, 9> f;
+    for (gsl::index i{0}; i < 8; ++i) {
+        const auto field{nextField(rest)};
+        if (!field)
+            return false;
+        f.at(i) = *field;
+    }
+    f.back() = rest;
+    return parse(f[0], s.left.percentValid) &&
+        parse(f[1], s.right.percentValid) &&
+        parse(f[2], s.left.meanRelativeScreen) &&
+        parse(f[3], s.right.meanRelativeScreen) &&
+        parse(f[4], s.left.standardDeviationRelativeScreen) &&
+        parse(f[5], s.right.standardDeviationRelativeScreen) &&
+        parseInteger(f[6], s.fixations) && parseInteger(f[7], s.blinks) &&
+        parseInteger(f[8], s.gaps);
+}
+
+static auto parseSynchronization(std::string_view rest,
+    EyeTrackerTargetPlayerSynchronization &s) -> bool {
+    const auto first{nextField(rest)};
+    return first &&
+        parseInteger(*first, s.eyeTrackerSystemTime.microseconds) &&
+        parseInteger(rest, s.targetPlayerSystemTime.nanoseconds);
+}
+
+static auto parseClockModel(std::string_view rest,
+    EyeTrackerTargetPlayerClockModel &m) -> bool {
+    std::array<std::string_view, 5> f;
+    for (gsl::index i{0}; i < 4; ++i) {
+        const auto field{nextField(rest)};
+        if (!field)
+            return false;
+        f.at(i) = *field;
+    }
+    f.back() = rest;
+    return parseInteger(f[0], m.reference.nanoseconds) &&
+        parseInteger(f[1], m.eyeTrackerSystemTimeAtReference.microseconds) &&
+        parse(f[2], m.driftPartsPerMillion) &&
+        parse(f[3], m.residualStandardDeviationMicroseconds) &&
+        parseInteger(f[4], m.samples);
+}
+
+// Only the last column may contain the field delimiter, which free
+// responses and target paths are free to.
+static auto parseTrial(std::string_view rest, const TrialFormat &format,
+    ParsedTrial &trial) -> bool {
+    trial.type = format.type;
+    trial.columns = {format.columns.data(), format.columns.size()};
+    trial.flagged = format.flaggable && endsWith(rest, flagged);
+    if (trial.flagged)
+        rest.remove_suffix(flagged.size());
+    const auto columns{gsl::narrow_cast<gsl::index>(format.columns.size())};
+    for (gsl::index i{0}; i < columns - 1; ++i) {
+        const auto field{nextField(rest)};
+        if (!field)
+            return false;
+        trial.fields.at(i) = *field;
+    }
+    trial.fields.at(columns - 1) = rest;
+    return true;
+}
+
+namespace {
+class Parser {
+  public:
+    explicit Parser(OutputFileParseObserver &observer) : observer{observer} {}
+
+    void line(std::string_view line) {
+        if (line.empty())
+            return;
+        if (!startsWithNumber(line) && (heading(line) || labeledLine(line)))
+            return;
+        row(line);
+    }
+
+  private:
+    static auto startsWithNumber(std::string_view line) -> bool {
+        const auto c{line.front()};
+        return c == '-' || (c >= '0' && c <= '9');
+    }
+
+    auto heading(std::string_view line) -> bool {
+        const auto found{headings().find(line)};
+        if (found == headings().end())
+            return false;
+        table = found->second.table;
+        if (found->second.trialFormat != nullptr)
+            trialFormat = found->second.trialFormat;
+        return true;
+    }
+
+    auto labeledLine(std::string_view line) -> bool {
+        if (startsWith(line, thresholdLabel)) {
+            const auto delimiter{line.rfind(labelDelimiter)};
+            ParsedThreshold threshold;
+            if (delimiter == std::string_view::npos ||
+                !parse(line.substr(delimiter + labelDelimiter.size()),
+                    threshold.threshold))
+                return false;
+            threshold.targetsUrl = line.substr(
+                thresholdLabel.size(), delimiter - thresholdLabel.size());
+            observer.threshold(threshold);
+            return true;
+        }
+        const auto delimiter{line.find(labelDelimiter)};
+        if (delimiter == std::string_view::npos)
+            return false;
+        const auto label{line.substr(0, delimiter)};
+        const auto value{line.substr(delimiter + labelDelimiter.size())};
+        if (label == targetStartTimeLabel) {
+            TargetStartTime t;
+            if (!parseInteger(value, t.nanoseconds))
+                return false;
+            observer.targetStartTime(t);
+            return true;
+        }
+        if (label == maskerSeekLabel) {
+            MaskerSeek s;
+            if (!parse(value, s.seconds))
+                return false;
+            observer.maskerSeek(s);
+            return true;
+        }
+        if (labels().find(label) == labels().end() &&
+            !startsWith(label, stoppingReasonLabel))
+            return false;
+        observer.labeledLine({label, value});
+        return true;
+    }
+
+    // Tables other than gaze samples and the trial plan are a single row,
+    // after which unlabeled rows continue the last trial table.
+    void row(std::string_view line) {
+        switch (table) {
+        case Table::trialPlan:
+            return;
+        case Table::gazeSamples: {
+            BinocularGazeSample sample;
+            if (parseGazeSample(line, sample)) {
+                observer.gazeSample(sample);
+                return;
+            }
+            break;
+        }
+        case Table::gazeStatistics: {
+            BinocularGazeStatistics statistics;
+            if (parseGazeStatistics(line, statistics))
+                observer.gazeStatistics(statistics);
+            table = Table::trial;
+            return;
+        }
+        case Table::synchronization: {
+            EyeTrackerTargetPlayerSynchronization synchronization{};
+            if (parseSynchronization(line, synchronization))
+                observer.synchronization(synchronization);
+            table = Table::trial;
+            return;
+        }
+        case Table::clockModel: {
+            EyeTrackerTargetPlayerClockModel model;
+            if (parseClockModel(line, model))
+                observer.clockModel(model);
+            table = Table::trial;
+            return;
+        }
+        case Table::trial:
+            break;
+        }
+        table = Table::trial;
+        ParsedTrial trial;
+        if (trialFormat != nullptr && parseTrial(line, *trialFormat, trial))
+            observer.trial(trial);
+    }
+
+    OutputFileParseObserver &observer;
+    const TrialFormat *trialFormat{};
+    Table table{Table::trial};
+};
+}
+
+auto ParsedTrial::field(HeadingItem item) const
+    -> std::optional<std::string_view> {
+    const auto found{std::find(columns.begin(), columns.end(), item)};
+    if (found == columns.end())
+        return std::nullopt;
+    return fields.at(found - columns.begin());
+}
+
+auto ParsedTrial::number(HeadingItem item) const -> std::optional<double> {
+    const auto f{field(item)};
+    double x{};
+    if (!f || !parse(*f, x))
+        return std::nullopt;
+    return x;
+}
+
+auto ParsedTrial::correct() const -> std::optional<bool> {
+    const auto evaluation{field(HeadingItem::evaluation)};
+    if (!evaluation)
+        return std::nullopt;
+    return *evaluation == "correct";
+}
+
+void parse(std::string_view contents, OutputFileParseObserver &observer) {
+    Parser parser{observer};
+    while (!contents.empty()) {
+        const auto end{contents.find('\n')};
+        auto line{contents.substr(0, end)};
+        if (endsWith(line, "\r"))
+            line.remove_suffix(1);
+        parser.line(line);
+        contents.remove_prefix(
+            end == std::string_view::npos ? contents.size() : end + 1);
+    }
+}
+
+MappedFile::MappedFile(const std::filesystem::path &path) {
+    const auto descriptor{::open(path.c_str(), O_RDONLY)};
+    if (descriptor == -1)
+        throw OpenFailure{};
+    struct stat status {};
+    if (::fstat(descriptor, &status) == -1) {
+        ::close(descriptor);
+        throw OpenFailure{};
+    }
+    size = gsl::narrow_cast<std::size_t>(status.st_size);
+    if (size != 0) {
+        data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (data == MAP_FAILED) {
+            ::close(descriptor);
+            throw OpenFailure{};
+        }
+        ::madvise(data, size, MADV_SEQUENTIAL);
+    }
+    ::close(descriptor);
+}
+
+MappedFile::~MappedFile() {
+    if (size != 0)
+        ::munmap(data, size);
+}
+
+auto MappedFile::contents() const -> std::string_view {
+    return {static_cast<const char *>(data), size};
+}
+
+void parse(gsl::span<const std::filesystem::path> files,
+    const std::function<OutputFileParseObserver &(gsl::index)> &observer,
+    unsigned threads) {
+    runWorkStealing(gsl::narrow_cast<gsl::index>(files.size()), threads,
+        [&](gsl::index i) {
+            const MappedFile file{gsl::at(files, i)};
+            parse(file.contents(), observer(i));
+        });
+}
+}
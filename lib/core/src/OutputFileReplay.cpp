@@ -0,0 +1,75 @@
+#include "OutputFileReplay.hpp"
+#include "OutputFileParser.hpp"
+
+#include <gsl/gsl>
+
+#include <charconv>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace av_speech_in_noise {
+static auto integer(std::string_view s) -> int {
+    auto x{0};
+    std::from_chars(s.data(), s.data() + s.size(), x);
+    return x;
+}
+
+namespace {
+class ReplayCollector : public OutputFileParseObserver {
+  public:
+    explicit ReplayCollector(ReplayableSession &session) : session{session} {}
+
+    void labeledLine(const ParsedLabeledLine &line) override {
+        if (line.label == "masker")
+            session.masker.path = line.value;
+        else if (line.label == "targets")
+            targets = line.value;
+        else if (line.label == "masker level (dB SPL)")
+            session.maskerLevel.dB_SPL = integer(line.value);
+        else if (line.label == "SNR (dB)")
+            snr = SNR{integer(line.value)};
+    }
+
+    void maskerSeek(MaskerSeek s) override { lastSeek = s.seconds; }
+
+    void trial(const ParsedTrial &trial) override {
+        ++trialNumber;
+        const auto target{trial.field(HeadingItem::target)};
+        if (!target || !lastSeek)
+            return;
+        ReplayableTrial replayable;
+        replayable.trialNumber = trialNumber;
+        replayable.target.path = resolved(*target);
+        replayable.snr = snr;
+        if (const auto x{trial.number(HeadingItem::snr_dB)})
+            replayable.snr = SNR{gsl::narrow_cast<int>(*x)};
+        replayable.maskerSeekSeconds = *lastSeek;
+        session.trials.push_back(replayable);
+        lastSeek.reset();
+    }
+
+  private:
+    [[nodiscard]] auto resolved(std::string_view target) const
+        -> std::string {
+        const std::filesystem::path path{std::string{target}};
+        if (path.has_parent_path() || targets.empty())
+            return path.string();
+        return (std::filesystem::path{targets} / path).string();
+    }
+
+    ReplayableSession &session;
+    std::string targets;
+    std::optional<double> lastSeek;
+    SNR snr{};
+    int trialNumber{};
+};
+}
+
+auto replayableSession(std::string_view contents) -> ReplayableSession {
+    ReplayableSession session;
+    ReplayCollector collector{session};
+    parse(contents, collector);
+    return session;
+}
+}
@@ -0,0 +1,171 @@
+#include "OutputFileSummary.hpp"
+#include "OutputFileParser.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <numeric>
+
+namespace av_speech_in_noise {
+namespace {
+// Every test heading begins with the subject, so that line starts the
+// summary of the next test.
+class Summarizer : public OutputFileParseObserver {
+  public:
+    explicit Summarizer(std::vector<OutputFileSummary> &summaries)
+        : summaries{summaries} {}
+
+    void labeledLine(const ParsedLabeledLine &line) override {
+        if (line.label == "subject") {
+            summaries.emplace_back();
+            summaries.back().subjectId = line.value;
+        } else if (line.label == "session")
+            current().session = line.value;
+        else if (line.label == "method")
+            current().method = line.value;
+    }
+
+    void threshold(const ParsedThreshold &t) override {
+        auto &summary{current()};
+        AdaptiveTestResult result;
+        result.targetsUrl.path = t.targetsUrl;
+        result.threshold = t.threshold;
+        summary.thresholds.push_back(result);
+    }
+
+    void trial(const ParsedTrial &trial) override {
+        auto &summary{current()};
+        ++summary.trials;
+        if (const auto correct{trial.correct()}) {
+            ++summary.evaluatedTrials;
+            if (*correct)
+                ++summary.correctTrials;
+        }
+        switch (trial.type) {
+        case OutputFileTrialType::correctKeywords:
+            if (const auto count{trial.number(HeadingItem::correctKeywords)})
+                summary.keywordsCorrect += gsl::narrow_cast<int>(*count);
+            break;
+        case OutputFileTrialType::threeKeywords:
+            for (const auto item : {HeadingItem::firstKeywordEvaluation,
+                     HeadingItem::secondKeywordEvaluation,
+                     HeadingItem::thirdKeywordEvaluation})
+                if (trial.field(item) == std::string_view{"correct"})
+                    ++summary.keywordsCorrect;
+            break;
+        case OutputFileTrialType::keyPress:
+        case OutputFileTrialType::emotion:
+            if (const auto rt{trial.number(HeadingItem::reactionTime)})
+                summary.reactionTimesMilliseconds.push_back(*rt);
+            break;
+        default:
+            break;
+        }
+    }
+
+  private:
+    auto current() -> OutputFileSummary & {
+        if (summaries.empty())
+            summaries.emplace_back();
+        return summaries.back();
+    }
+
+    std::vector<OutputFileSummary> &summaries;
+};
+}
+
+static auto size(const std::vector<double> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto size(const std::vector<std::filesystem::path> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto mean(const std::vector<double> &x) -> double {
+    return std::accumulate(x.begin(), x.end(), 0.) / size(x);
+}
+
+static auto median(std::vector<double> x) -> double {
+    const auto middle{x.begin() + size(x) / 2};
+    std::nth_element(x.begin(), middle, x.end());
+    if (size(x) % 2 == 1)
+        return *middle;
+    return (*middle + *std::max_element(x.begin(), middle)) / 2;
+}
+
+static auto standardDeviation(const std::vector<double> &x) -> double {
+    if (size(x) < 2)
+        return 0;
+    const auto m{mean(x)};
+    auto squares{0.};
+    for (const auto y : x)
+        squares += (y - m) * (y - m);
+    return std::sqrt(squares / (size(x) - 1));
+}
+
+auto summarize(std::string_view contents) -> std::vector<OutputFileSummary> {
+    std::vector<OutputFileSummary> summaries;
+    Summarizer summarizer{summaries};
+    parse(contents, summarizer);
+    return summaries;
+}
+
+auto summarize(const std::filesystem::path &directory, unsigned threads)
+    -> std::vector<OutputFileSummary> {
+    std::vector<std::filesystem::path> files;
+    for (const auto &entry :
+        std::filesystem::recursive_directory_iterator{directory})
+        if (entry.is_regular_file() && entry.path().extension() == ".txt")
+            files.push_back(entry.path());
+    std::sort(files.begin(), files.end());
+    std::vector<std::vector<OutputFileSummary>> summariesOfFile(files.size());
+    std::deque<Summarizer> summarizers;
+    for (auto &summaries : summariesOfFile)
+        summarizers.emplace_back(summaries);
+    parse(files,
+        [&](gsl::index i) -> OutputFileParseObserver & {
+            return summarizers.at(i);
+        },
+        threads);
+    std::vector<OutputFileSummary> summaries;
+    for (gsl::index i{0}; i < size(files); ++i)
+        for (auto &summary : summariesOfFile.at(i)) {
+            summary.file = files.at(i);
+            summaries.push_back(std::move(summary));
+        }
+    return summaries;
+}
+
+void writeSummaryTable(
+    std::ostream &stream, const std::vector<OutputFileSummary> &summaries) {
+    stream << "file\tsubject\tsession\tmethod\ttrials\tpercent correct\t"
+              "keywords correct\treaction times\tmean reaction time (ms)\t"
+              "median reaction time (ms)\treaction time SD (ms)\t"
+              "thresholds\n";
+    for (const auto &summary : summaries) {
+        stream << summary.file.string() << '\t' << summary.subjectId << '\t'
+               << summary.session << '\t' << summary.method << '\t'
+               << summary.trials << '\t';
+        if (summary.evaluatedTrials != 0)
+            stream << 100. * summary.correctTrials / summary.evaluatedTrials;
+        stream << '\t' << summary.keywordsCorrect << '\t';
+        const auto &rt{summary.reactionTimesMilliseconds};
+        stream << rt.size() << '\t';
+        if (!rt.empty())
+            stream << mean(rt) << '\t' << median(rt) << '\t'
+                   << standardDeviation(rt) << '\t';
+        else
+            stream << "\t\t\t";
+        auto first{true};
+        for (const auto &threshold : summary.thresholds) {
+            if (!first)
+                stream << "; ";
+            stream << threshold.targetsUrl.path << ": "
+                   << threshold.threshold;
+            first = false;
+        }
+        stream << '\n';
+    }
+}
+}
@@ -0,0 +1,75 @@
+#include "PathTable.hpp"
+
+namespace av_speech_in_noise {
+auto fileName(std::string_view path) -> std::string_view {
+    const auto separator{path.rfind('/')};
+    return separator == std::string_view::npos ? path
+                                               : path.substr(separator + 1);
+}
+
+auto stem(std::string_view path) -> std::string_view {
+    const auto name{fileName(path)};
+    if (name == "." || name == "..")
+        return name;
+    const auto dot{name.rfind('.')};
+    return dot == std::string_view::npos || dot == 0 ? name
+                                                     : name.substr(0, dot);
+}
+
+auto parentPath(std::string_view path) -> std::string_view {
+    const auto separator{path.rfind('/')};
+    if (separator == std::string_view::npos)
+        return {};
+    const auto last{path.find_last_not_of('/', separator)};
+    return last == std::string_view::npos ? path.substr(0, 1)
+                                          : path.substr(0, last + 1);
+}
+
+void PathTable::clear() {
+    arena.clear();
+    entries.clear();
+}
+
+auto PathTable::add(std::string_view directory, std::string_view file)
+    -> Handle {
+    Entry entry{};
+    entry.begin = arena.size();
+    if (!directory.empty() && (file.empty() || file.front() != '/')) {
+        arena += directory;
+        if (directory.back() != '/')
+            arena += '/';
+    }
+    arena += file;
+    entry.end = arena.size();
+    const auto joined{view(entry.begin, entry.end)};
+    entry.fileName = entry.end - av_speech_in_noise::fileName(joined).size();
+    entry.stemEnd =
+        entry.fileName + av_speech_in_noise::stem(joined).size();
+    entries.push_back(entry);
+    return size() - 1;
+}
+
+auto PathTable::view(std::size_t begin, std::size_t end) const
+    -> std::string_view {
+    return std::string_view{arena}.substr(begin, end - begin);
+}
+
+auto PathTable::path(Handle h) const -> std::string_view {
+    const auto &entry{entries.at(h)};
+    return view(entry.begin, entry.end);
+}
+
+auto PathTable::fileName(Handle h) const -> std::string_view {
+    const auto &entry{entries.at(h)};
+    return view(entry.fileName, entry.end);
+}
+
+auto PathTable::stem(Handle h) const -> std::string_view {
+    const auto &entry{entries.at(h)};
+    return view(entry.fileName, entry.stemEnd);
+}
+
+auto PathTable::size() const -> gsl::index { return entries.size(); }
+
+auto PathTable::empty() const -> bool { return entries.empty(); }
+}
@@ -0,0 +1,153 @@
+#include "PsiTrack.hpp"
+#include "PsychometricFunction.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace av_speech_in_noise {
+static auto size(const std::vector<double> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto stimuli(const Track::Settings &s) -> gsl::index {
+    if (s.ceiling == maximumInt || s.floor == minimumInt || s.ceiling < s.floor)
+        throw std::runtime_error{"Psi track needs a floor and ceiling"};
+    return gsl::index{s.ceiling} - s.floor + 1;
+}
+
+static auto xLogX(double x) -> double { return x > 0 ? x * std::log(x) : 0; }
+
+static auto dot(const double *a, const double *b, gsl::index n) -> double {
+    auto sum{0.};
+    for (gsl::index i{0}; i < n; ++i)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+PsiTrack::PsiTrack(const Settings &s, const PsiTrackParameters &p)
+    : gridSize{stimuli(s) * static_cast<gsl::index>(p.slopes.size())},
+      floor_{s.floor}, startingX{std::clamp(s.startingX, s.floor, s.ceiling)},
+      trials{p.trials},
+      convergenceStandardErrorDb{s.convergenceStandardErrorDb} {
+    const auto levels{stimuli(s)};
+    likelihood.resize(levels * gridSize);
+    negativeEntropy.resize(levels * gridSize);
+    gridThreshold.resize(gridSize);
+    for (gsl::index t{0}; t < levels; ++t)
+        for (gsl::index k{0}; k < size(p.slopes); ++k)
+            gridThreshold.at(t * size(p.slopes) + k) =
+                static_cast<double>(floor_ + t);
+    for (gsl::index x{0}; x < levels; ++x)
+        for (gsl::index g{0}; g < gridSize; ++g) {
+            PsychometricFunction f;
+            f.threshold = gridThreshold.at(g);
+            f.slope = p.slopes.at(g % size(p.slopes));
+            f.guessRate = p.guessRate;
+            f.lapseRate = p.lapseRate;
+            const auto correct{probabilityCorrect(f, floor_ + x)};
+            likelihood.at(x * gridSize + g) = correct;
+            negativeEntropy.at(x * gridSize + g) =
+                xLogX(correct) + xLogX(1 - correct);
+        }
+    reset();
+}
+
+void PsiTrack::reset() {
+    posterior.assign(gridSize, 1. / gridSize);
+    x_ = startingX;
+    previousStep = 0;
+    reversals_ = 0;
+    trialsCompleted = 0;
+}
+
+auto PsiTrack::x() -> int { return x_; }
+
+void PsiTrack::down() { update(true); }
+
+void PsiTrack::up() { update(false); }
+
+auto PsiTrack::complete() -> bool {
+    return stoppingReason() != TrackStoppingReason::none;
+}
+
+auto PsiTrack::stoppingReason() -> TrackStoppingReason {
+    if (trialsCompleted >= trials)
+        return TrackStoppingReason::completedRule;
+    if (convergenceStandardErrorDb > 0 && trialsCompleted > 0 &&
+        thresholdStandardDeviation(0) < convergenceStandardErrorDb)
+        return TrackStoppingReason::converged;
+    return TrackStoppingReason::none;
+}
+
+auto PsiTrack::reversals() -> int { return reversals_; }
+
+auto PsiTrack::threshold(int) -> double {
+    return std::inner_product(
+        posterior.begin(), posterior.end(), gridThreshold.begin(), 0.);
+}
+
+auto PsiTrack::thresholdStandardDeviation(int) -> double {
+    const auto mean{threshold(0)};
+    auto variance{0.};
+    for (gsl::index g{0}; g < gridSize; ++g)
+        variance += posterior.at(g) * (gridThreshold.at(g) - mean) *
+            (gridThreshold.at(g) - mean);
+    return std::sqrt(variance);
+}
+
+// The multiply and normalization are plain loops over contiguous
+// arrays so the compiler can vectorize them.
+void PsiTrack::update(bool correct) {
+    if (complete())
+        return;
+    const auto *const row{&likelihood.at((x_ - floor_) * gridSize)};
+    auto *const p{posterior.data()};
+    auto sum{0.};
+    if (correct)
+        for (gsl::index g{0}; g < gridSize; ++g)
+            sum += p[g] *= row[g];
+    else
+        for (gsl::index g{0}; g < gridSize; ++g)
+            sum += p[g] *= 1 - row[g];
+    if (sum > 0)
+        for (gsl::index g{0}; g < gridSize; ++g)
+            p[g] /= sum;
+    ++trialsCompleted;
+    present(nextX());
+}
+
+void PsiTrack::present(int x) {
+    const auto step{x > x_ ? 1 : x < x_ ? -1 : 0};
+    if (step != 0) {
+        if (previousStep != 0 && step != previousStep)
+            ++reversals_;
+        previousStep = step;
+    }
+    x_ = x;
+}
+
+// The expected posterior entropy after presenting x differs between
+// levels only by pc log pc + (1 - pc) log(1 - pc) minus the posterior
+// mean of the likelihood's negative entropy, where pc is the predicted
+// probability correct.
+auto PsiTrack::nextX() const -> int {
+    const auto levels{size(likelihood) / gridSize};
+    auto best{std::numeric_limits<double>::infinity()};
+    gsl::index chosen{0};
+    for (gsl::index x{0}; x < levels; ++x) {
+        const auto correct{
+            dot(posterior.data(), &likelihood.at(x * gridSize), gridSize)};
+        const auto expectedEntropy{xLogX(correct) + xLogX(1 - correct) -
+            dot(posterior.data(), &negativeEntropy.at(x * gridSize),
+                gridSize)};
+        if (expectedEntropy < best) {
+            best = expectedEntropy;
+            chosen = x;
+        }
+    }
+    return floor_ + gsl::narrow_cast<int>(chosen);
+}
+}
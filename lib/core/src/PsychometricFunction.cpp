@@ -0,0 +1,11 @@
+#include "PsychometricFunction.hpp"
+
+#include <cmath>
+
+namespace av_speech_in_noise {
+auto probabilityCorrect(const PsychometricFunction &f, double x) -> double {
+    return f.guessRate +
+        (1 - f.guessRate - f.lapseRate) /
+        (1 + std::exp(-f.slope * (x - f.threshold)));
+}
+}
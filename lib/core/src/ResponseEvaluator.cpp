@@ -2,11 +2,10 @@
 
 #include <gsl/gsl>
 
-#include <regex>
-#include <filesystem>
+#include <algorithm>
 
 namespace av_speech_in_noise {
-static auto color(const std::string &colorName)
+static auto color(std::string_view colorName)
     -> coordinate_response_measure::Color {
     using coordinate_response_measure::Color;
     if (colorName == "green")
@@ -21,52 +20,38 @@ static auto color(const std::string &colorName)
     return Color::unknown;
 }
 
-static auto fileName(const LocalUrl &url) -> std::string {
-    return std::filesystem::path{url.path}.filename();
+static auto isLetter(char c) -> bool {
+    return ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z');
 }
 
-static auto stem(const LocalUrl &url) -> std::string {
-    return std::filesystem::path{url.path}.stem();
-}
-
-static auto correctNumber(const LocalUrl &url) -> int {
-    const auto stem{av_speech_in_noise::stem(url)};
-    std::regex pattern{"[A-Za-z]*(\\d).*"};
-    std::smatch match;
-    std::regex_search(stem, match, pattern);
-    return match.size() > 1 ? std::stoi(match[1])
-                            : ResponseEvaluatorImpl::invalidNumber;
-}
+static auto isDigit(char c) -> bool { return '0' <= c && c <= '9'; }
 
-static auto correctColor(const LocalUrl &url)
-    -> coordinate_response_measure::Color {
-    const auto stem{av_speech_in_noise::stem(url)};
-    std::regex pattern{"([A-Za-z]*).*"};
-    std::smatch match;
-    std::regex_search(stem, match, pattern);
-    return match.size() > 1 ? color(match[1])
-                            : coordinate_response_measure::Color::unknown;
+auto parseCoordinateResponseTarget(std::string_view stem)
+    -> coordinate_response_measure::Response {
+    const auto letters{std::find_if_not(stem.begin(), stem.end(), isLetter)};
+    const auto digit{std::find_if(stem.begin(), stem.end(), isDigit)};
+    coordinate_response_measure::Response parsed;
+    parsed.color = color(stem.substr(0, letters - stem.begin()));
+    parsed.number = digit == stem.end() ? ResponseEvaluatorImpl::invalidNumber
+                                        : *digit - '0';
+    return parsed;
 }
 
 const int ResponseEvaluatorImpl::invalidNumber = -1;
 
-auto ResponseEvaluatorImpl::correctColor(const LocalUrl &url)
+auto ResponseEvaluatorImpl::correctColor(std::string_view targetStem)
     -> coordinate_response_measure::Color {
-    return av_speech_in_noise::correctColor(url);
-}
-
-auto ResponseEvaluatorImpl::correctNumber(const LocalUrl &url) -> int {
-    return av_speech_in_noise::correctNumber(url);
+    return parseCoordinateResponseTarget(targetStem).color;
 }
 
-auto ResponseEvaluatorImpl::fileName(const LocalUrl &url) -> std::string {
-    return av_speech_in_noise::fileName(url);
+auto ResponseEvaluatorImpl::correctNumber(std::string_view targetStem) -> int {
+    return parseCoordinateResponseTarget(targetStem).number;
 }
 
-auto ResponseEvaluatorImpl::correct(const LocalUrl &url,
+auto ResponseEvaluatorImpl::correct(std::string_view targetStem,
     const coordinate_response_measure::Response &r) -> bool {
-    return av_speech_in_noise::correctNumber(url) == r.number &&
-        av_speech_in_noise::correctColor(url) == r.color &&
+    const auto target{parseCoordinateResponseTarget(targetStem)};
+    return target.number == r.number && target.color == r.color &&
         r.color != coordinate_response_measure::Color::unknown &&
         r.number != invalidNumber;
 }
@@ -0,0 +1,401 @@
+#include "ResultsStore.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+namespace av_speech_in_noise {
+constexpr auto testTable{"test"};
+constexpr auto trialTable{"trial"};
+constexpr auto thresholdTable{"threshold"};
+constexpr auto fieldDelimiter{'\t'};
+
+static auto size(const std::vector<std::string> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto size(const std::vector<TestRecord> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto field(std::string s) -> std::string {
+    std::replace_if(
+        s.begin(), s.end(), [](char c) { return c == '\t' || c == '\n'; },
+        ' ');
+    return s;
+}
+
+static auto fields(const std::string &line) -> std::vector<std::string> {
+    std::vector<std::string> fields;
+    std::stringstream stream{line};
+    for (std::string f; std::getline(stream, f, fieldDelimiter);)
+        fields.push_back(f);
+    if (!line.empty() && line.back() == fieldDelimiter)
+        fields.emplace_back();
+    return fields;
+}
+
+static auto record(std::initializer_list<std::string> fields)
+    -> std::string {
+    std::stringstream stream;
+    auto first{true};
+    for (const auto &f : fields) {
+        if (!first)
+            stream << fieldDelimiter;
+        stream << field(f);
+        first = false;
+    }
+    return stream.str();
+}
+
+static auto string(double x) -> std::string {
+    std::stringstream stream;
+    stream.precision(10);
+    stream << x;
+    return stream.str();
+}
+
+static auto string(const std::optional<bool> &b) -> std::string {
+    if (!b.has_value())
+        return "";
+    return *b ? "1" : "0";
+}
+
+static auto string(const std::optional<double> &x) -> std::string {
+    return x.has_value() ? string(*x) : "";
+}
+
+static auto string(const std::optional<int> &x) -> std::string {
+    return x.has_value() ? std::to_string(*x) : "";
+}
+
+static auto string(const TrackingRule &rule) -> std::string {
+    std::stringstream stream;
+    auto first{true};
+    for (const auto &sequence : rule) {
+        if (!first)
+            stream << ';';
+        stream << sequence.runCount << ' ' << sequence.stepSize << ' '
+               << sequence.down << ' ' << sequence.up;
+        first = false;
+    }
+    return stream.str();
+}
+
+static auto parse(const std::string &s, int &x) -> bool {
+    const auto *const end{s.data() + s.size()};
+    const auto result{std::from_chars(s.data(), end, x)};
+    return result.ec == std::errc{} && result.ptr == end;
+}
+
+// Floating point from_chars isn't available with every standard library
+// this builds against, so strtod reads the field and has to consume all of
+// it.
+static auto parse(const std::string &s, double &x) -> bool {
+    if (s.empty() || std::isspace(static_cast<unsigned char>(s.front())) != 0)
+        return false;
+    char *end{};
+    x = std::strtod(s.c_str(), &end);
+    return end == s.c_str() + s.size();
+}
+
+static auto parse(const std::string &s, std::optional<bool> &b) -> bool {
+    if (s.empty())
+        b.reset();
+    else if (s == "1" || s == "0")
+        b = s == "1";
+    else
+        return false;
+    return true;
+}
+
+template <typename T>
+static auto parse(const std::string &s, std::optional<T> &x) -> bool {
+    if (s.empty()) {
+        x.reset();
+        return true;
+    }
+    T y{};
+    if (!parse(s, y))
+        return false;
+    x = y;
+    return true;
+}
+
+static auto parse(const std::string &s, Condition &c) -> bool {
+    for (const auto candidate :
+        {Condition::auditoryOnly, Condition::audioVisual})
+        if (s == name(candidate)) {
+            c = candidate;
+            return true;
+        }
+    return false;
+}
+
+static auto parse(const std::string &s, TrackingSequence &sequence) -> bool {
+    std::vector<std::string> numbers;
+    std::stringstream stream{s};
+    for (std::string number; std::getline(stream, number, ' ');)
+        numbers.push_back(number);
+    return size(numbers) == 4 && parse(numbers.at(0), sequence.runCount) &&
+        parse(numbers.at(1), sequence.stepSize) &&
+        parse(numbers.at(2), sequence.down) &&
+        parse(numbers.at(3), sequence.up);
+}
+
+static auto parse(const std::string &s, TrackingRule &rule) -> bool {
+    rule.clear();
+    std::stringstream stream{s};
+    for (std::string sequence; std::getline(stream, sequence, ';');)
+        if (!parse(sequence, rule.emplace_back()))
+            return false;
+    return true;
+}
+
+static auto parseTest(const std::vector<std::string> &f)
+    -> std::optional<TestRecord> {
+    if (size(f) != 12 || f.at(1).empty())
+        return std::nullopt;
+    TestRecord test;
+    test.id = f.at(1);
+    test.identity.subjectId = f.at(2);
+    test.identity.testerId = f.at(3);
+    test.identity.session = f.at(4);
+    test.identity.method = f.at(5);
+    test.targetsUrl.path = f.at(6);
+    test.maskerFileUrl.path = f.at(7);
+    if (!parse(f.at(8), test.maskerLevel.dB_SPL) ||
+        !parse(f.at(9), test.condition) ||
+        !parse(f.at(10), test.startingSnr.dB) ||
+        !parse(f.at(11), test.trackingRule))
+        return std::nullopt;
+    return test;
+}
+
+static auto parseTrial(const std::vector<std::string> &f)
+    -> std::optional<TrialRecord> {
+    if (size(f) != 6)
+        return std::nullopt;
+    TrialRecord trial;
+    trial.test = f.at(1);
+    trial.target = f.at(2);
+    if (!parse(f.at(3), trial.correct) ||
+        !parse(f.at(4), trial.reactionTimeMilliseconds) ||
+        !parse(f.at(5), trial.snr_dB))
+        return std::nullopt;
+    return trial;
+}
+
+static auto parseThreshold(const std::vector<std::string> &f)
+    -> std::optional<ThresholdRecord> {
+    if (size(f) != 4)
+        return std::nullopt;
+    ThresholdRecord threshold;
+    threshold.test = f.at(1);
+    threshold.targetsUrl.path = f.at(2);
+    if (!parse(f.at(3), threshold.threshold))
+        return std::nullopt;
+    return threshold;
+}
+
+ResultsStore::ResultsStore() {
+    std::random_device device;
+    std::seed_seq seed{device(), device(), device(), device()};
+    ids.seed(seed);
+}
+
+void ResultsStore::read(std::istream &stream) {
+    for (std::string line; std::getline(stream, line);)
+        if (!line.empty())
+            read(line);
+}
+
+void ResultsStore::read(const std::string &line) {
+    const auto f{fields(line)};
+    if (f.front() == testTable) {
+        const auto test{parseTest(f)};
+        if (test && owns(test->id))
+            return;
+        if (test && testsById.count(test->id) == 0) {
+            index(*test);
+            return;
+        }
+    } else if (f.front() == trialTable) {
+        const auto trial{parseTrial(f)};
+        if (trial && owns(trial->test))
+            return;
+        if (trial && testsById.count(trial->test) != 0) {
+            index(*trial);
+            return;
+        }
+    } else if (f.front() == thresholdTable) {
+        const auto threshold{parseThreshold(f)};
+        if (threshold && owns(threshold->test))
+            return;
+        if (threshold && testsById.count(threshold->test) != 0) {
+            index(*threshold);
+            return;
+        }
+    }
+    malformed_.push_back(line);
+}
+
+void ResultsStore::writeNewRecords(std::ostream &stream) {
+    for (const auto &r : newRecords)
+        stream << r << '\n';
+    newRecords.clear();
+}
+
+static auto hexadecimal(std::uint64_t x) -> std::string {
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << x;
+    return stream.str();
+}
+
+auto ResultsStore::add(TestRecord test) -> std::string {
+    while (test.id.empty() || testsById.count(test.id) != 0)
+        test.id = hexadecimal(ids());
+    newRecords.push_back(record({testTable, test.id,
+        test.identity.subjectId, test.identity.testerId,
+        test.identity.session, test.identity.method, test.targetsUrl.path,
+        test.maskerFileUrl.path, std::to_string(test.maskerLevel.dB_SPL),
+        name(test.condition), std::to_string(test.startingSnr.dB),
+        string(test.trackingRule)}));
+    added.insert(test.id);
+    index(test);
+    return test.id;
+}
+
+void ResultsStore::add(const TrialRecord &trial) {
+    if (testsById.count(trial.test) == 0)
+        return;
+    newRecords.push_back(record({trialTable, trial.test, trial.target,
+        string(trial.correct), string(trial.reactionTimeMilliseconds),
+        string(trial.snr_dB)}));
+    index(trial);
+}
+
+void ResultsStore::add(const ThresholdRecord &threshold) {
+    if (testsById.count(threshold.test) == 0)
+        return;
+    newRecords.push_back(record({thresholdTable, threshold.test,
+        threshold.targetsUrl.path, string(threshold.threshold)}));
+    index(threshold);
+}
+
+auto ResultsStore::owns(const std::string &test) const -> bool {
+    return added.count(test) != 0;
+}
+
+void ResultsStore::index(const TestRecord &test) {
+    const auto i{size(tests_)};
+    tests_.push_back(test);
+    trialsOfTest.emplace_back();
+    thresholdsOfTest.emplace_back();
+    testsById.emplace(test.id, i);
+    bySubject[test.identity.subjectId].push_back(i);
+    bySession[test.identity.session].push_back(i);
+    byMethod[test.identity.method].push_back(i);
+}
+
+void ResultsStore::index(const TrialRecord &trial) {
+    trialsOfTest.at(testsById.at(trial.test)).push_back(trials_.size());
+    trials_.push_back(trial);
+}
+
+void ResultsStore::index(const ThresholdRecord &threshold) {
+    thresholdsOfTest.at(testsById.at(threshold.test))
+        .push_back(thresholds_.size());
+    thresholds_.push_back(threshold);
+}
+
+static auto matches(const std::string &queried, const std::string &actual)
+    -> bool {
+    return queried.empty() || queried == actual;
+}
+
+static auto matches(const ResultsQuery &query, const TestRecord &test)
+    -> bool {
+    return matches(query.subjectId, test.identity.subjectId) &&
+        matches(query.session, test.identity.session) &&
+        matches(query.method, test.identity.method);
+}
+
+static void narrowCandidates(const std::vector<gsl::index> *&candidates,
+    const std::unordered_map<std::string, std::vector<gsl::index>> &index,
+    const std::string &key) {
+    static const std::vector<gsl::index> none;
+    if (key.empty())
+        return;
+    const auto found{index.find(key)};
+    const auto *keyed{found == index.end() ? &none : &found->second};
+    if (candidates == nullptr || keyed->size() < candidates->size())
+        candidates = keyed;
+}
+
+// Starts from the smallest index bucket that the query names and filters
+// it by the remaining fields.
+auto ResultsStore::matchingTests(const ResultsQuery &query) const
+    -> std::vector<gsl::index> {
+    const std::vector<gsl::index> *candidates{};
+    narrowCandidates(candidates, bySubject, query.subjectId);
+    narrowCandidates(candidates, bySession, query.session);
+    narrowCandidates(candidates, byMethod, query.method);
+    std::vector<gsl::index> matching;
+    if (candidates == nullptr) {
+        for (gsl::index i{0}; i < size(tests_); ++i)
+            matching.push_back(i);
+        return matching;
+    }
+    for (const auto i : *candidates)
+        if (matches(query, tests_.at(i)))
+            matching.push_back(i);
+    return matching;
+}
+
+auto ResultsStore::tests(const ResultsQuery &query) const
+    -> std::vector<TestRecord> {
+    std::vector<TestRecord> matching;
+    for (const auto i : matchingTests(query))
+        matching.push_back(tests_.at(i));
+    return matching;
+}
+
+auto ResultsStore::trials(const ResultsQuery &query) const
+    -> std::vector<TrialRecord> {
+    std::vector<TrialRecord> matching;
+    for (const auto i : matchingTests(query))
+        for (const auto j : trialsOfTest.at(i))
+            matching.push_back(trials_.at(j));
+    return matching;
+}
+
+auto ResultsStore::thresholds(const ResultsQuery &query) const
+    -> std::vector<ThresholdRecord> {
+    std::vector<ThresholdRecord> matching;
+    for (const auto i : matchingTests(query))
+        for (const auto j : thresholdsOfTest.at(i))
+            matching.push_back(thresholds_.at(j));
+    return matching;
+}
+
+auto ResultsStore::percentCorrect(const ResultsQuery &query) const -> double {
+    auto evaluated{0};
+    auto correct{0};
+    for (const auto i : matchingTests(query))
+        for (const auto j : trialsOfTest.at(i))
+            if (const auto c{trials_.at(j).correct}) {
+                ++evaluated;
+                if (*c)
+                    ++correct;
+            }
+    return evaluated == 0 ? 0 : correct * 100. / evaluated;
+}
+
+auto ResultsStore::malformed() const -> const std::vector<std::string> & {
+    return malformed_;
+}
+}
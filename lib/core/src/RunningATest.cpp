@@ -1,4 +1,6 @@
 #include "RunningATest.hpp"
+#include "Tracing.hpp"
+#include "TrialPlan.hpp"
 
 #include <gsl/gsl>
 
@@ -10,7 +12,13 @@ class NullTestMethod : public TestMethod {
     auto complete() -> bool override { return {}; }
     auto nextTarget() -> LocalUrl override { return {}; }
     auto currentTarget() -> LocalUrl override { return {}; }
+    auto currentTargetFileName() -> std::string_view override { return {}; }
+    auto currentTargetStem() -> std::string_view override { return {}; }
     auto snr() -> SNR override { return SNR{}; }
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return std::nullopt;
+    }
+    auto trialPlan() -> const TrialPlan * override { return nullptr; }
     void submit(const coordinate_response_measure::Response &) override {}
     void writeLastCoordinateResponse(OutputFile &) override {}
     void writeTestingParameters(OutputFile &) override {}
@@ -37,11 +45,15 @@ static constexpr auto operator+(const Duration &a, const Duration &b)
     return Duration{a.seconds + b.seconds};
 }
 
-static auto steadyLevelDuration(TargetPlayer &player) -> Duration {
-    return player.duration() + RunningATestImpl::targetOnsetFringeDuration +
+static auto steadyLevelDuration(Duration target) -> Duration {
+    return target + RunningATestImpl::targetOnsetFringeDuration +
         RunningATestImpl::targetOffsetFringeDuration;
 }
 
+static auto steadyLevelDuration(TargetPlayer &player) -> Duration {
+    return steadyLevelDuration(player.duration());
+}
+
 auto trialDuration(TargetPlayer &target, MaskerPlayer &masker) -> Duration {
     return totalrampDuration(masker) + steadyLevelDuration(target);
 }
@@ -90,10 +102,12 @@ static void apply(MaskerPlayer &player, LevelAmplification x) {
 
 static void loadFile(
     TargetPlayer &player, const LocalUrl &s, RationalNumber videoScale) {
+    tracing::Span span{"loadTargetFile"};
     player.loadFile(s, videoScale);
 }
 
 static void loadFile(MaskerPlayer &player, const LocalUrl &s) {
+    tracing::Span span{"loadMaskerFile"};
     player.loadFile(s);
 }
 
@@ -101,15 +115,6 @@ static void play(TargetPlayer &player) { player.play(); }
 
 static void play(MaskerPlayer &player) { player.play(); }
 
-static auto currentTarget(TestMethod *testMethod) -> LocalUrl {
-    return testMethod->currentTarget();
-}
-
-static auto targetName(ResponseEvaluator &evaluator, TestMethod *testMethod)
-    -> std::string {
-    return evaluator.fileName(currentTarget(testMethod));
-}
-
 static void save(OutputFile &file) { file.save(); }
 
 static void tryOpening(OutputFile &file, const TestIdentity &p) {
@@ -212,31 +217,82 @@ static auto targetLevelAmplification(
         maskerLevelAmplification(maskerPlayer, test).dB + testMethod->snr().dB};
 }
 
-static void preparePlayersForNextTrial(TestMethod *testMethod,
+// Reading a planned target's level decodes it, so a plan whose target can't
+// be read fails when the test starts rather than partway through it.
+static void measurePlannedTargets(std::map<std::string, Duration> &durations,
+    TestMethod *testMethod, TargetPlayer &targetPlayer, const Test &test) {
+    durations.clear();
+    const auto *plan{testMethod->trialPlan()};
+    if (plan == nullptr)
+        return;
+    for (const auto &trial : plan->trials)
+        if (durations.count(trial.target.path) == 0)
+            throwRequestFailureOnInvalidAudioFile(
+                [&](const LocalUrl &file) {
+                    loadFile(targetPlayer, file, test.videoScale);
+                    targetPlayer.digitalLevel();
+                    durations[file.path] = targetPlayer.duration();
+                },
+                trial.target);
+}
+
+static auto targetDuration(const std::map<std::string, Duration> &planned,
+    const LocalUrl &target, TargetPlayer &player) -> Duration {
+    const auto found{planned.find(target.path)};
+    return found == planned.end() ? player.duration() : found->second;
+}
+
+static auto preparePlayersForNextTrial(TestMethod *testMethod,
     Randomizer &randomizer, TargetPlayer &targetPlayer,
-    MaskerPlayer &maskerPlayer, const Test &test) {
-    loadFile(targetPlayer, testMethod->nextTarget(), test.videoScale);
+    MaskerPlayer &maskerPlayer, const Test &test,
+    const std::map<std::string, Duration> &plannedTargetDurations)
+    -> MaskerSeek {
+    tracing::Span span{"preparePlayersForNextTrial"};
+    const auto target{testMethod->nextTarget()};
+    loadFile(targetPlayer, target, test.videoScale);
     apply(
         targetPlayer, targetLevelAmplification(testMethod, maskerPlayer, test));
-    const auto maskerPlayerSeekTimeUpperLimit{
-        maskerPlayer.duration() - trialDuration(targetPlayer, maskerPlayer)};
-    maskerPlayer.seekSeconds(randomizer.betweenInclusive(
-        0., maskerPlayerSeekTimeUpperLimit.seconds));
-    maskerPlayer.setSteadyLevelFor(steadyLevelDuration(targetPlayer));
+    const auto steadyLevel{steadyLevelDuration(
+        targetDuration(plannedTargetDurations, target, targetPlayer))};
+    const auto maskerPlayerSeekTimeUpperLimit{maskerPlayer.duration() -
+        (totalrampDuration(maskerPlayer) + steadyLevel)};
+    const auto plannedSeekFraction{testMethod->maskerSeekFraction()};
+    const MaskerSeek seek{plannedSeekFraction
+            ? *plannedSeekFraction * maskerPlayerSeekTimeUpperLimit.seconds
+            : randomizer.betweenInclusive(
+                  0., maskerPlayerSeekTimeUpperLimit.seconds)};
+    maskerPlayer.seekSeconds(seek.seconds);
+    maskerPlayer.setSteadyLevelFor(steadyLevel);
+    return seek;
+}
+
+// Trials added to the plan since it was last written, as when a flagged
+// target is played again, are appended so the file still replays the test.
+static void writeTrialPlanAmendments(TestMethod *testMethod,
+    std::size_t &plannedTrialsWritten, OutputFile &outputFile) {
+    const auto *plan{testMethod->trialPlan()};
+    if (plan == nullptr || plannedTrialsWritten >= plan->trials.size())
+        return;
+    for (; plannedTrialsWritten < plan->trials.size(); ++plannedTrialsWritten)
+        outputFile.write(TrialPlanAmendment{
+            gsl::narrow_cast<gsl::index>(plannedTrialsWritten) + 1,
+            plan->trials.at(plannedTrialsWritten)});
+    save(outputFile);
 }
 
 static void prepareNextTrialIfNeeded(TestMethod *testMethod, int &trialNumber_,
-    OutputFile &outputFile, Randomizer &randomizer, TargetPlayer &targetPlayer,
-    MaskerPlayer &maskerPlayer,
+    MaskerSeek &maskerSeek, OutputFile &outputFile, Randomizer &randomizer,
+    TargetPlayer &targetPlayer, MaskerPlayer &maskerPlayer,
     const std::vector<std::reference_wrapper<RunningATest::TestObserver>>
         &observers,
-    const Test &test) {
+    const Test &test,
+    const std::map<std::string, Duration> &plannedTargetDurations) {
     for (auto observer : observers)
         observer.get().notifyThatSubjectHasResponded();
     if (!testMethod->complete()) {
         ++trialNumber_;
-        preparePlayersForNextTrial(
-            testMethod, randomizer, targetPlayer, maskerPlayer, test);
+        maskerSeek = preparePlayersForNextTrial(testMethod, randomizer,
+            targetPlayer, maskerPlayer, test, plannedTargetDurations);
     } else {
         testMethod->writeTestResult(outputFile);
         save(outputFile);
@@ -245,23 +301,25 @@ static void prepareNextTrialIfNeeded(TestMethod *testMethod, int &trialNumber_,
 
 static void saveOutputFileAndPrepareNextTrialAfter(
     const std::function<void()> &f, TestMethod *testMethod, int &trialNumber_,
-    OutputFile &outputFile, Randomizer &randomizer, TargetPlayer &targetPlayer,
-    MaskerPlayer &maskerPlayer,
+    MaskerSeek &maskerSeek, OutputFile &outputFile, Randomizer &randomizer,
+    TargetPlayer &targetPlayer, MaskerPlayer &maskerPlayer,
     const std::vector<std::reference_wrapper<RunningATest::TestObserver>>
         &observer,
-    const Test &test) {
+    const Test &test,
+    const std::map<std::string, Duration> &plannedTargetDurations) {
     f();
     save(outputFile);
-    prepareNextTrialIfNeeded(testMethod, trialNumber_, outputFile, randomizer,
-        targetPlayer, maskerPlayer, observer, test);
+    prepareNextTrialIfNeeded(testMethod, trialNumber_, maskerSeek, outputFile,
+        randomizer, targetPlayer, maskerPlayer, observer, test,
+        plannedTargetDurations);
 }
 
 RunningATestImpl::RunningATestImpl(TargetPlayer &targetPlayer,
-    MaskerPlayer &maskerPlayer, ResponseEvaluator &evaluator,
-    OutputFile &outputFile, Randomizer &randomizer, Clock &clock)
+    MaskerPlayer &maskerPlayer, OutputFile &outputFile, Randomizer &randomizer,
+    Clock &clock)
     : maskerPlayer{maskerPlayer}, targetPlayer{targetPlayer},
-      evaluator{evaluator}, outputFile{outputFile}, randomizer{randomizer},
-      clock{clock}, testMethod{&nullTestMethod} {
+      outputFile{outputFile}, randomizer{randomizer}, clock{clock},
+      testMethod{&nullTestMethod} {
     targetPlayer.attach(this);
     maskerPlayer.attach(this);
 }
@@ -285,14 +343,18 @@ void RunningATestImpl::initialize(TestMethod *testMethod, const Test &test,
     tryOpening(outputFile, test.identity);
     maskerPlayer.stop();
     throwRequestFailureOnInvalidAudioFile(
-        [&](const LocalUrl &file) { maskerPlayer.loadFile(file); },
+        [&](const LocalUrl &file) { loadFile(maskerPlayer, file); },
         maskerFileUrl(test));
 
     hide(targetPlayer);
+    measurePlannedTargets(
+        plannedTargetDurations, testMethod, targetPlayer, test);
     maskerPlayer.apply(maskerLevelAmplification(maskerPlayer, test));
-    preparePlayersForNextTrial(
-        testMethod, randomizer, targetPlayer, maskerPlayer, test);
+    maskerSeek_ = preparePlayersForNextTrial(testMethod, randomizer,
+        targetPlayer, maskerPlayer, test, plannedTargetDurations);
     testMethod->writeTestingParameters(outputFile);
+    const auto *plan{testMethod->trialPlan()};
+    plannedTrialsWritten = plan == nullptr ? 0 : plan->trials.size();
 
     useAllChannels(targetPlayer);
     useAllChannels(maskerPlayer);
@@ -311,10 +373,11 @@ void RunningATestImpl::initialize(TestMethod *testMethod, const Test &test,
         maskerPlayer.disableVibrotactileStimulus();
 
     for (auto observer : testObservers)
-        observer.get().notifyThatNewTestIsReady(test.identity.session);
+        observer.get().notifyThatNewTestIsReady(test);
 }
 
 void RunningATestImpl::playTrial(const AudioSettings &settings) {
+    tracing::Span span{"playTrial"};
     throwRequestFailureIfTrialInProgress(trialInProgress_);
 
     throwRequestFailureOnInvalidAudioDevice(
@@ -324,6 +387,7 @@ void RunningATestImpl::playTrial(const AudioSettings &settings) {
         settings.audioDevice);
 
     playTrialTime_ = clock.time();
+    outputFile.write(maskerSeek_);
     for (auto observer : testObservers)
         observer.get().notifyThatTrialWillBegin(trialNumber_);
     if (test.condition == Condition::audioVisual)
@@ -333,10 +397,14 @@ void RunningATestImpl::playTrial(const AudioSettings &settings) {
 }
 
 void RunningATestImpl::notifyThatPreRollHasCompleted() {
+    tracing::instant("preRollComplete");
+    tracing::Span span{"fadeIn"};
     maskerPlayer.fadeIn();
 }
 
 void RunningATestImpl::fadeInComplete(const AudioSampleTimeWithOffset &t) {
+    tracing::instant("fadeInComplete");
+    tracing::Span span{"playAt"};
     PlayerTimeWithDelay timeToPlayWithDelay{};
     timeToPlayWithDelay.playerTime = t.playerTime;
     timeToPlayWithDelay.delay = Delay{
@@ -348,6 +416,7 @@ void RunningATestImpl::fadeInComplete(const AudioSampleTimeWithOffset &t) {
 }
 
 void RunningATestImpl::fadeOutComplete() {
+    tracing::instant("fadeOutComplete");
     if (!test.keepVideoShown)
         hide(targetPlayer);
     for (auto observer : testObservers)
@@ -362,15 +431,20 @@ void RunningATestImpl::submit(
         [&]() {
             testMethod->submit(response);
             testMethod->writeLastCoordinateResponse(outputFile);
+            writeTrialPlanAmendments(
+                testMethod, plannedTrialsWritten, outputFile);
         },
-        testMethod, trialNumber_, outputFile, randomizer, targetPlayer,
-        maskerPlayer, testObservers, test);
+        testMethod, trialNumber_, maskerSeek_, outputFile, randomizer,
+        targetPlayer, maskerPlayer, testObservers, test,
+        plannedTargetDurations);
 }
 
 void RunningATestImpl::prepareNextTrialIfNeeded() {
+    tracing::Span span{"prepareNextTrialIfNeeded"};
+    writeTrialPlanAmendments(testMethod, plannedTrialsWritten, outputFile);
     av_speech_in_noise::prepareNextTrialIfNeeded(testMethod, trialNumber_,
-        outputFile, randomizer, targetPlayer, maskerPlayer, testObservers,
-        test);
+        maskerSeek_, outputFile, randomizer, targetPlayer, maskerPlayer,
+        testObservers, test, plannedTargetDurations);
 }
 
 void RunningATestImpl::playCalibration(const Calibration &calibration) {
@@ -402,8 +476,10 @@ auto RunningATestImpl::audioDevices() -> AudioDevices {
 auto RunningATestImpl::trialNumber() -> int { return trialNumber_; }
 
 auto RunningATestImpl::targetFileName() -> std::string {
-    return targetName(evaluator, testMethod);
+    return std::string{testMethod->currentTargetFileName()};
 }
 
 auto RunningATestImpl::playTrialTime() -> std::string { return playTrialTime_; }
+
+auto RunningATestImpl::method() -> const TestMethod * { return testMethod; }
 }
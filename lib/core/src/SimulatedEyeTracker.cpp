@@ -0,0 +1,167 @@
+#include "SimulatedEyeTracker.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace av_speech_in_noise {
+static auto microseconds(Duration d) -> std::int_least64_t {
+    return std::llround(d.seconds * 1e6);
+}
+
+static auto interpolate(Point2D from, Point2D to, double fraction)
+    -> Point2D {
+    return {gsl::narrow_cast<float>(from.x + (to.x - from.x) * fraction),
+        gsl::narrow_cast<float>(from.y + (to.y - from.y) * fraction)};
+}
+
+static auto size(const std::vector<BinocularGazeSample> &v) -> gsl::index {
+    return v.size();
+}
+
+SimulatedGaze::SimulatedGaze(const SimulatedGazeSettings &settings)
+    : settings{settings}, engine{settings.seed} {}
+
+auto SimulatedGaze::uniform(double a, double b) -> double {
+    return std::uniform_real_distribution<>{a, b}(engine);
+}
+
+auto SimulatedGaze::microseconds(Duration minimum, Duration maximum)
+    -> std::int_least64_t {
+    return std::llround(uniform(minimum.seconds, maximum.seconds) * 1e6);
+}
+
+auto SimulatedGaze::invalid() -> bool {
+    return std::bernoulli_distribution{settings.invalidSampleProbability}(
+        engine);
+}
+
+void SimulatedGaze::beginNextPhase(std::int_least64_t start) {
+    phaseStartMicroseconds = start;
+    if (phase != Phase::fixation)
+        phase = Phase::fixation;
+    else if (std::bernoulli_distribution{settings.blinkProbability}(engine))
+        phase = Phase::blink;
+    else {
+        phase = Phase::saccade;
+        from = to;
+        to = {gsl::narrow_cast<float>(uniform(0.1, 0.9)),
+            gsl::narrow_cast<float>(uniform(0.1, 0.9))};
+    }
+    switch (phase) {
+    case Phase::fixation:
+        phaseEndMicroseconds = start +
+            microseconds(settings.minimumFixationDuration,
+                settings.maximumFixationDuration);
+        break;
+    case Phase::saccade:
+        phaseEndMicroseconds = start +
+            microseconds(settings.minimumSaccadeDuration,
+                settings.maximumSaccadeDuration);
+        break;
+    case Phase::blink:
+        phaseEndMicroseconds = start +
+            microseconds(
+                settings.minimumBlinkDuration, settings.maximumBlinkDuration);
+        break;
+    }
+}
+
+auto SimulatedGaze::next(EyeTrackerSystemTime t) -> BinocularGazeSample {
+    if (!started) {
+        started = true;
+        phaseStartMicroseconds = t.microseconds;
+        phaseEndMicroseconds = t.microseconds +
+            microseconds(settings.minimumFixationDuration,
+                settings.maximumFixationDuration);
+    }
+    while (t.microseconds >= phaseEndMicroseconds)
+        beginNextPhase(phaseEndMicroseconds);
+    BinocularGazeSample sample{};
+    sample.systemTime = t;
+    Point2D position{to};
+    if (phase == Phase::fixation) {
+        std::normal_distribution<> jitter{0, settings.fixationJitter};
+        position.x += gsl::narrow_cast<float>(jitter(engine));
+        position.y += gsl::narrow_cast<float>(jitter(engine));
+    } else if (phase == Phase::saccade)
+        position = interpolate(from, to,
+            static_cast<double>(t.microseconds - phaseStartMicroseconds) /
+                (phaseEndMicroseconds - phaseStartMicroseconds));
+    sample.left.position.relativeScreen = position;
+    sample.right.position.relativeScreen = position;
+    const auto blinking{phase == Phase::blink};
+    sample.left.origin.valid = !blinking;
+    sample.right.origin.valid = !blinking;
+    sample.left.position.valid = !blinking && !invalid();
+    sample.right.position.valid = !blinking && !invalid();
+    return sample;
+}
+
+SimulatedEyeTracker::SimulatedEyeTracker(
+    const SimulatedGazeSettings &settings)
+    : gaze{settings},
+      periodMicroseconds{
+          1e6 / std::clamp(settings.rateHz, minimumRateHz, maximumRateHz)} {}
+
+SimulatedEyeTracker::~SimulatedEyeTracker() { stop(); }
+
+void SimulatedEyeTracker::allocateRecordingTimeSeconds(double seconds) {
+    buffer.resize(gsl::narrow_cast<std::size_t>(
+        std::ceil(seconds * 1e6 / periodMicroseconds) + 1));
+    head = 0;
+}
+
+void SimulatedEyeTracker::start() {
+    if (running.exchange(true))
+        return;
+    thread = std::thread{[this] { run(); }};
+}
+
+void SimulatedEyeTracker::stop() {
+    if (!running.exchange(false))
+        return;
+    thread.join();
+}
+
+// Samples are timestamped on a fixed schedule. After a stall the schedule
+// has fallen behind the clock, so the missed samples arrive in a burst the
+// way they would from a tracker that buffers on the device.
+void SimulatedEyeTracker::run() {
+    const auto start{currentSystemTime().microseconds};
+    for (std::int_least64_t n{0}; running; ++n) {
+        const auto stall{pendingStallMicroseconds.exchange(0)};
+        if (stall > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds{stall});
+        const EyeTrackerSystemTime t{
+            start + std::llround(static_cast<double>(n) * periodMicroseconds)};
+        std::this_thread::sleep_until(
+            std::chrono::steady_clock::time_point{std::chrono::microseconds{
+                t.microseconds}});
+        const auto sample{gaze.next(t)};
+        const auto i{head.load(std::memory_order_relaxed)};
+        if (i < size(buffer)) {
+            buffer.at(i) = sample;
+            head.store(i + 1, std::memory_order_release);
+        }
+    }
+}
+
+auto SimulatedEyeTracker::gazeSamples() -> BinocularGazeSamples {
+    const auto n{head.load(std::memory_order_acquire)};
+    return {buffer.begin(), buffer.begin() + n};
+}
+
+auto SimulatedEyeTracker::currentSystemTime() -> EyeTrackerSystemTime {
+    return EyeTrackerSystemTime{
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count()};
+}
+
+void SimulatedEyeTracker::injectStall(Duration d) {
+    pendingStallMicroseconds += microseconds(d);
+}
+
+void SimulatedEyeTracker::write(std::ostream &) {}
+}
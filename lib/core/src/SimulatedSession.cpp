@@ -0,0 +1,154 @@
+#include "SimulatedSession.hpp"
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+
+namespace av_speech_in_noise {
+SimulatedListener::SimulatedListener(
+    const PsychometricFunction &function, std::uint64_t seed)
+    : function{function}, engine{seed} {}
+
+auto SimulatedListener::understands(SNR snr) -> bool {
+    return std::bernoulli_distribution{probabilityCorrect(function, snr.dB)}(
+        engine);
+}
+
+auto SimulatedListener::betweenInclusive(int a, int b) -> int {
+    return std::uniform_int_distribution<>{a, b}(engine);
+}
+
+namespace submitting_pass_fail {
+SimulatedResponder::SimulatedResponder(
+    Interactor &interactor, TestMethod &method, SimulatedListener &listener)
+    : interactor{interactor}, method{method}, listener{listener} {}
+
+void SimulatedResponder::respond() {
+    if (listener.understands(method.snr()))
+        interactor.submitCorrectResponse();
+    else
+        interactor.submitIncorrectResponse();
+}
+}
+
+namespace submitting_fixed_pass_fail {
+SimulatedResponder::SimulatedResponder(
+    Interactor &interactor, TestMethod &method, SimulatedListener &listener)
+    : interactor{interactor}, method{method}, listener{listener} {}
+
+void SimulatedResponder::respond() {
+    if (listener.understands(method.snr()))
+        interactor.submitCorrectResponse();
+    else
+        interactor.submitIncorrectResponse();
+}
+}
+
+namespace submitting_number_keywords {
+SimulatedResponder::SimulatedResponder(
+    Interactor &interactor, TestMethod &method, SimulatedListener &listener)
+    : interactor{interactor}, method{method}, listener{listener} {}
+
+void SimulatedResponder::respond() {
+    CorrectKeywords keywords;
+    const auto snr{method.snr()};
+    for (auto i{0}; i < 3; ++i)
+        if (listener.understands(snr))
+            ++keywords.count;
+    interactor.submit(keywords);
+}
+}
+
+namespace submitting_free_response {
+SimulatedResponder::SimulatedResponder(Interactor &interactor,
+    TestMethod &method, SimulatedListener &listener)
+    : interactor{interactor}, method{method}, listener{listener} {}
+
+void SimulatedResponder::respond() {
+    FreeResponse response;
+    if (listener.understands(method.snr()))
+        response.response = method.currentTargetFileName();
+    interactor.submit(response);
+}
+}
+
+namespace coordinate_response_measure {
+// The numbers offered to the subject.
+constexpr std::array<int, 8> numbers{{1, 2, 3, 4, 5, 6, 8, 9}};
+
+constexpr std::array<Color, 4> colors{
+    {Color::green, Color::red, Color::blue, Color::white}};
+
+SimulatedResponder::SimulatedResponder(RunningATest &model, TestMethod &method,
+    ResponseEvaluator &evaluator, SimulatedListener &listener)
+    : model{model}, method{method}, evaluator{evaluator}, listener{listener} {}
+
+static auto differs(const Response &a, const Response &b) -> bool {
+    return a.number != b.number || a.color != b.color;
+}
+
+void SimulatedResponder::respond() {
+    const auto target{method.currentTargetStem()};
+    Response correct;
+    correct.number = evaluator.correctNumber(target);
+    correct.color = evaluator.correctColor(target);
+    if (listener.understands(method.snr())) {
+        model.submit(correct);
+        return;
+    }
+    Response guess;
+    do {
+        guess.number = numbers.at(
+            gsl::narrow_cast<std::size_t>(listener.betweenInclusive(0, 7)));
+        guess.color = colors.at(
+            gsl::narrow_cast<std::size_t>(listener.betweenInclusive(0, 3)));
+    } while (!differs(guess, correct));
+    model.submit(guess);
+}
+}
+
+static auto seconds(std::chrono::steady_clock::duration d) -> double {
+    return std::chrono::duration<double>{d}.count();
+}
+
+SimulatedSession::SimulatedSession(
+    RunningATest &model, VirtualTime &time, SimulatedResponder &responder)
+    : model{model}, time{time}, responder{responder} {
+    model.attach(this);
+}
+
+void SimulatedSession::notifyThatPlayTrialHasCompleted() {
+    trialCompleted = true;
+}
+
+void SimulatedSession::playTrial(const AudioSettings &settings) {
+    trialCompleted = false;
+    model.playTrial(settings);
+}
+
+auto SimulatedSession::run(const AudioSettings &settings,
+    gsl::index maximumTrials) -> SimulatedSessionResult {
+    SimulatedSessionResult result;
+    if (model.testComplete() || maximumTrials < 1)
+        return result;
+    const auto start{time.now()};
+    playTrial(settings);
+    ++result.trials;
+    for (;;) {
+        while (!trialCompleted)
+            if (!time.advance())
+                throw std::runtime_error{"Trial never completed."};
+        const auto trialEnd{std::chrono::steady_clock::now()};
+        responder.respond();
+        if (model.testComplete() || result.trials == maximumTrials)
+            break;
+        playTrial(settings);
+        result.interTrialSeconds.push_back(
+            seconds(std::chrono::steady_clock::now() - trialEnd));
+        ++result.trials;
+    }
+    result.complete = model.testComplete();
+    result.virtualDuration = Duration{time.now().seconds - start.seconds};
+    return result;
+}
+}
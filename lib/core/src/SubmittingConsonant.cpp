@@ -1,7 +1,9 @@
 #include "SubmittingConsonant.hpp"
+#include "Tracing.hpp"
 
 #include <regex>
 #include <string>
+#include <string_view>
 
 namespace av_speech_in_noise::submitting_consonant {
 InteractorImpl::InteractorImpl(
@@ -40,20 +42,19 @@ static auto consonant(const std::string &match) -> Consonant {
     return Consonant::unknown;
 }
 
-static auto correctConsonant(const LocalUrl &url) -> Consonant {
-    const std::string stem{std::filesystem::path{url.path}.stem()};
+static auto correctConsonant(std::string_view stem) -> Consonant {
     std::regex pattern{"choose_(.*?)_.*"};
-    std::smatch match;
-    std::regex_search(stem, match, pattern);
+    std::cmatch match;
+    std::regex_search(stem.data(), stem.data() + stem.size(), match, pattern);
     return match.size() > 1 ? consonant(match[1]) : Consonant::unknown;
 }
 
 void InteractorImpl::submit(const ConsonantResponse &r) {
+    tracing::Span span{"submitResponse"};
     ConsonantTrial trial;
     trial.subjectConsonant = r.consonant;
-    trial.correctConsonant = correctConsonant(method.currentTarget());
-    trial.target =
-        std::filesystem::path{method.currentTarget().path}.filename();
+    trial.correctConsonant = correctConsonant(method.currentTargetStem());
+    trial.target = method.currentTargetFileName();
     trial.correct = trial.correctConsonant == trial.subjectConsonant;
     outputFile.write(trial);
     outputFile.save();
@@ -1,6 +1,5 @@
 #include "SubmittingEmotion.hpp"
-
-#include <filesystem>
+#include "Tracing.hpp"
 
 namespace av_speech_in_noise::submitting_emotion {
 InteractorImpl::InteractorImpl(
@@ -8,11 +7,11 @@ InteractorImpl::InteractorImpl(
     : method{method}, model{model}, outputFile{outputFile} {}
 
 void InteractorImpl::submit(const EmotionResponse &r) {
+    tracing::Span span{"submitResponse"};
     method.submit(r);
     EmotionTrial trial;
     static_cast<EmotionResponse &>(trial) = r;
-    trial.target =
-        std::filesystem::path{method.currentTarget().path}.filename();
+    trial.target = method.currentTargetFileName();
     outputFile.write(trial);
     outputFile.save();
     model.prepareNextTrialIfNeeded();
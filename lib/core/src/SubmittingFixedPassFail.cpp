@@ -1,6 +1,5 @@
 #include "SubmittingFixedPassFail.hpp"
-
-#include <filesystem>
+#include "Tracing.hpp"
 
 namespace av_speech_in_noise::submitting_fixed_pass_fail {
 InteractorImpl::InteractorImpl(
@@ -12,11 +11,11 @@ void InteractorImpl::submitCorrectResponse() { submit(true); }
 void InteractorImpl::submitIncorrectResponse() { submit(false); }
 
 void InteractorImpl::submit(bool correct) {
+    tracing::Span span{"submitResponse"};
     method.submit(Flaggable{false});
     PassFailTrial trial;
     trial.correct = correct;
-    trial.target =
-        std::filesystem::path{method.currentTarget().path}.filename();
+    trial.target = method.currentTargetFileName();
     outputFile.write(trial);
     outputFile.save();
     model.prepareNextTrialIfNeeded();
@@ -1,6 +1,5 @@
 #include "SubmittingFreeResponse.hpp"
-
-#include <filesystem>
+#include "Tracing.hpp"
 
 namespace av_speech_in_noise::submitting_free_response {
 InteractorImpl::InteractorImpl(
@@ -8,11 +7,11 @@ InteractorImpl::InteractorImpl(
     : method{method}, model{model}, outputFile{outputFile} {}
 
 void InteractorImpl::submit(const FreeResponse &response) {
+    tracing::Span span{"submitResponse"};
     method.submit(response);
     FreeResponseTrial trial;
     trial.response = response.response;
-    trial.target =
-        std::filesystem::path{method.currentTarget().path}.filename();
+    trial.target = method.currentTargetFileName();
     trial.flagged = response.flagged;
     trial.time = model.playTrialTime();
     outputFile.write(trial);
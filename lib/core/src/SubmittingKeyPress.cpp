@@ -1,7 +1,6 @@
 #include "SubmittingKeyPress.hpp"
 
 #include <array>
-#include <filesystem>
 #include <limits>
 
 namespace av_speech_in_noise::submitting_keypress {
@@ -86,8 +85,7 @@ void InteractorImpl::forceSubmit(const std::vector<KeyPressResponse> &) {
 
 void InteractorImpl::writeSaveAndReadyNextTrial(KeyPressTrial &trial) {
     trial.vibrotactileStimulus = lastVibrotactileStimulus;
-    trial.target =
-        std::filesystem::path{method.currentTarget().path}.filename();
+    trial.target = method.currentTargetFileName();
     outputFile.write(trial);
     outputFile.save();
     if (!deferringNextTrial) {
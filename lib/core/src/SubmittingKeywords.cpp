@@ -1,5 +1,5 @@
 #include "SubmittingKeywords.hpp"
-#include <filesystem>
+#include "Tracing.hpp"
 
 namespace av_speech_in_noise::submitting_keywords {
 InteractorImpl::InteractorImpl(FixedLevelMethod &method,
@@ -8,13 +8,13 @@ InteractorImpl::InteractorImpl(FixedLevelMethod &method,
       outputFile{outputFile} {}
 
 void InteractorImpl::submit(const ThreeKeywordsResponse &p) {
+    tracing::Span span{"submitResponse"};
     method.submit(p);
     ThreeKeywordsTrial trial;
     trial.firstCorrect = p.firstCorrect;
     trial.secondCorrect = p.secondCorrect;
     trial.thirdCorrect = p.thirdCorrect;
-    trial.target =
-        std::filesystem::path{method.currentTarget().path}.filename();
+    trial.target = method.currentTargetFileName();
     trial.flagged = p.flagged;
     outputFile.write(trial);
     outputFile.save();
@@ -1,4 +1,5 @@
 #include "SubmittingPassFail.hpp"
+#include "Tracing.hpp"
 
 namespace av_speech_in_noise::submitting_pass_fail {
 InteractorImpl::InteractorImpl(
@@ -6,6 +7,7 @@ InteractorImpl::InteractorImpl(
     : adaptiveMethod{adaptiveMethod}, model{model}, outputFile{outputFile} {}
 
 void InteractorImpl::submitCorrectResponse() {
+    tracing::Span span{"submitResponse"};
     adaptiveMethod.submitCorrectResponse();
     adaptiveMethod.writeLastCorrectResponse(outputFile);
     outputFile.save();
@@ -13,6 +15,7 @@ void InteractorImpl::submitCorrectResponse() {
 }
 
 void InteractorImpl::submitIncorrectResponse() {
+    tracing::Span span{"submitResponse"};
     adaptiveMethod.submitIncorrectResponse();
     adaptiveMethod.writeLastIncorrectResponse(outputFile);
     outputFile.save();
@@ -0,0 +1,223 @@
+#include "Tracing.hpp"
+
+#include <gsl/gsl>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace av_speech_in_noise::tracing {
+std::atomic<bool> enabled_{false};
+
+namespace {
+enum class Phase : char { complete = 'X', instant = 'i' };
+
+struct Event {
+    const char *name;
+    std::int64_t start;
+    std::int64_t duration;
+    Phase phase;
+};
+
+constexpr gsl::index bufferCapacity{1 << 16};
+
+// Only its own thread appends. Publishing the count with release lets a
+// writer on another thread read every event below it.
+struct Buffer {
+    explicit Buffer(gsl::index thread)
+        : events(bufferCapacity), thread{thread} {}
+
+    std::vector<Event> events;
+    std::atomic<gsl::index> count{};
+    std::atomic<std::int64_t> dropped{};
+    gsl::index thread;
+    bool inUse{true};
+};
+
+// What an exited thread recorded, moved out of its buffer.
+struct Retired {
+    std::vector<Event> events;
+    gsl::index thread;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    std::vector<Retired> retired;
+    std::int64_t retiredDropped{};
+    gsl::index threads{};
+};
+}
+
+static auto registry() -> Registry & {
+    static Registry registry;
+    return registry;
+}
+
+static const auto processStart{std::chrono::steady_clock::now()};
+
+static auto acquire() -> Buffer * {
+    auto &r{registry()};
+    std::lock_guard<std::mutex> lock{r.mutex};
+    const auto thread{++r.threads};
+    for (const auto &b : r.buffers)
+        if (!b->inUse) {
+            b->inUse = true;
+            b->thread = thread;
+            return b.get();
+        }
+    r.buffers.push_back(std::make_unique<Buffer>(thread));
+    return r.buffers.back().get();
+}
+
+// Keeps only the events, so a thread's events outlive it without its
+// whole buffer, which the next new thread reuses.
+static void release(Buffer &b) {
+    auto &r{registry()};
+    std::lock_guard<std::mutex> lock{r.mutex};
+    const auto n{b.count.load(std::memory_order_relaxed)};
+    if (n != 0)
+        r.retired.push_back(
+            {{b.events.begin(), b.events.begin() + n}, b.thread});
+    r.retiredDropped += b.dropped.load(std::memory_order_relaxed);
+    b.count.store(0, std::memory_order_relaxed);
+    b.dropped.store(0, std::memory_order_relaxed);
+    b.inUse = false;
+}
+
+namespace {
+struct Lease {
+    Lease() = default;
+    ~Lease() {
+        if (buffer != nullptr)
+            release(*buffer);
+    }
+    Lease(const Lease &) = delete;
+    auto operator=(const Lease &) -> Lease & = delete;
+    Lease(Lease &&) = delete;
+    auto operator=(Lease &&) -> Lease & = delete;
+
+    Buffer *buffer{};
+};
+}
+
+static auto buffer() -> Buffer & {
+    thread_local Lease lease;
+    if (lease.buffer == nullptr)
+        lease.buffer = acquire();
+    return *lease.buffer;
+}
+
+static void record(const Event &event) {
+    auto &b{buffer()};
+    const auto n{b.count.load(std::memory_order_relaxed)};
+    if (n == bufferCapacity) {
+        b.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    b.events.at(n) = event;
+    b.count.store(n + 1, std::memory_order_release);
+}
+
+void enable() { enabled_.store(true, std::memory_order_relaxed); }
+
+void disable() { enabled_.store(false, std::memory_order_relaxed); }
+
+auto now() -> std::int64_t {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - processStart)
+        .count();
+}
+
+void instant(const char *name) {
+    if (enabled())
+        record({name, now(), 0, Phase::instant});
+}
+
+void complete(const char *name, std::int64_t start, std::int64_t end) {
+    if (enabled())
+        record({name, start, end - start, Phase::complete});
+}
+
+static auto microseconds(std::int64_t nanoseconds) -> double {
+    return static_cast<double>(nanoseconds) / 1e3;
+}
+
+static void writeEscaped(std::ostream &out, std::string_view s) {
+    for (const auto c : s)
+        if (c == '"' || c == '\\')
+            out << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            std::array<char, 7> escaped{};
+            std::snprintf(escaped.data(), escaped.size(), "\\u%04x",
+                static_cast<unsigned>(c));
+            out << escaped.data();
+        } else
+            out << c;
+}
+
+static void write(std::ostream &out, const Event &event, gsl::index thread) {
+    out << R"({"name":")";
+    writeEscaped(out, event.name);
+    out << R"(","cat":"trial","ph":")"
+        << static_cast<char>(event.phase) << R"(","ts":)"
+        << microseconds(event.start);
+    if (event.phase == Phase::complete)
+        out << R"(,"dur":)" << microseconds(event.duration);
+    else
+        out << R"(,"s":"t")";
+    out << R"(,"pid":1,"tid":)" << thread << '}';
+}
+
+// Holds the registry's lock throughout, so no buffer is released or
+// reused while it is read.
+void write(std::ostream &out) {
+    const auto precision{out.precision()};
+    out << std::fixed << std::setprecision(3) << R"({"traceEvents":[)";
+    auto first{true};
+    const auto writeEvent{[&](const Event &event, gsl::index thread) {
+        if (!first)
+            out << ',';
+        first = false;
+        write(out, event, thread);
+    }};
+    auto &r{registry()};
+    std::lock_guard<std::mutex> lock{r.mutex};
+    for (const auto &retired : r.retired)
+        for (const auto &event : retired.events)
+            writeEvent(event, retired.thread);
+    for (const auto &b : r.buffers) {
+        const auto n{b->count.load(std::memory_order_acquire)};
+        for (gsl::index i{0}; i < n; ++i)
+            writeEvent(b->events.at(i), b->thread);
+    }
+    out << R"(],"displayTimeUnit":"ms"})";
+    out.unsetf(std::ios::floatfield);
+    out.precision(precision);
+}
+
+auto dropped() -> std::int64_t {
+    auto &r{registry()};
+    std::lock_guard<std::mutex> lock{r.mutex};
+    auto total{r.retiredDropped};
+    for (const auto &b : r.buffers)
+        total += b->dropped.load(std::memory_order_relaxed);
+    return total;
+}
+
+void clear() {
+    auto &r{registry()};
+    std::lock_guard<std::mutex> lock{r.mutex};
+    r.retired.clear();
+    r.retiredDropped = 0;
+    for (const auto &b : r.buffers) {
+        b->count.store(0, std::memory_order_relaxed);
+        b->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+}
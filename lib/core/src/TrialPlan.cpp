@@ -0,0 +1,88 @@
+#include "TrialPlan.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace av_speech_in_noise {
+static auto size(const std::vector<PlannedTrial> &v) -> gsl::index {
+    return v.size();
+}
+
+namespace {
+class SeekFractions {
+  public:
+    explicit SeekFractions(std::uint64_t seed) : engine{seed} {}
+
+    auto operator()() -> double { return uniform(engine); }
+
+  private:
+    std::mt19937_64 engine;
+    std::uniform_real_distribution<> uniform;
+};
+}
+
+auto compileTrialPlan(TargetPlaylist &list, gsl::index trials,
+    std::uint64_t seed) -> TrialPlan {
+    TrialPlan plan{seed, {}};
+    plan.trials.reserve(std::max(trials, gsl::index{0}));
+    SeekFractions seekFraction{seed};
+    for (gsl::index i{0}; i < trials; ++i)
+        plan.trials.push_back({list.next(), seekFraction()});
+    return plan;
+}
+
+auto compileTrialPlan(FiniteTargetPlaylist &list, std::uint64_t seed)
+    -> TrialPlan {
+    TrialPlan plan{seed, {}};
+    SeekFractions seekFraction{seed};
+    while (!list.empty())
+        plan.trials.push_back({list.next(), seekFraction()});
+    return plan;
+}
+
+void checkTargetsExist(const TrialPlan &plan) {
+    for (const auto &trial : plan.trials)
+        if (!std::filesystem::is_regular_file(trial.target.path)) {
+            std::stringstream stream;
+            stream << "Planned target does not exist: " << trial.target.path;
+            throw std::runtime_error{stream.str()};
+        }
+}
+
+void TrialPlanPlaylist::assign(TrialPlan plan, LocalUrl directory) {
+    plan_ = std::move(plan);
+    directory_ = std::move(directory);
+    current_ = -1;
+}
+
+auto TrialPlanPlaylist::next() -> LocalUrl {
+    return plan_.trials.at(++current_).target;
+}
+
+auto TrialPlanPlaylist::current() -> LocalUrl {
+    return current_ < 0 ? LocalUrl{} : plan_.trials.at(current_).target;
+}
+
+auto TrialPlanPlaylist::directory() -> LocalUrl { return directory_; }
+
+auto TrialPlanPlaylist::empty() -> bool {
+    return current_ + 1 >= size(plan_.trials);
+}
+
+void TrialPlanPlaylist::reinsertCurrent() {
+    if (current_ < 0)
+        return;
+    auto repeated{plan_.trials.at(current_)};
+    plan_.trials.push_back(std::move(repeated));
+}
+
+auto TrialPlanPlaylist::plan() const -> const TrialPlan & { return plan_; }
+
+auto TrialPlanPlaylist::maskerSeekFraction() const -> double {
+    return current_ < 0 ? 0 : plan_.trials.at(current_).maskerSeekFraction;
+}
+}
@@ -0,0 +1,82 @@
+#include "VirtualTime.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+namespace av_speech_in_noise {
+namespace {
+struct CivilDate {
+    std::int64_t year;
+    unsigned month;
+    unsigned day;
+};
+}
+
+// Howard Hinnant's days_from_civil inverse, so formatting needs neither
+// the C library's time zone nor its shared buffer.
+static auto civil(std::int64_t daysSinceEpoch) -> CivilDate {
+    const auto z{daysSinceEpoch + 719468};
+    const auto era{(z >= 0 ? z : z - 146096) / 146097};
+    const auto dayOfEra{static_cast<unsigned>(z - era * 146097)};
+    const auto yearOfEra{(dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 -
+                             dayOfEra / 146096) /
+        365};
+    const auto dayOfYear{
+        dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100)};
+    const auto shiftedMonth{(5 * dayOfYear + 2) / 153};
+    const auto day{dayOfYear - (153 * shiftedMonth + 2) / 5 + 1};
+    const auto month{shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9};
+    return {static_cast<std::int64_t>(yearOfEra) + era * 400 + (month <= 2),
+        month, day};
+}
+
+VirtualTime::VirtualTime(std::int64_t originSeconds)
+    : originSeconds{originSeconds} {}
+
+void VirtualTime::attach(Timer::Observer *o) { observer = o; }
+
+void VirtualTime::schedule(Duration after, std::function<void()> f) {
+    events.emplace(Key{now_ + after.seconds, scheduled++}, std::move(f));
+}
+
+void VirtualTime::scheduleCallbackAfterSeconds(double seconds) {
+    lastTimerCallback = {now_ + seconds, scheduled};
+    schedule(Duration{seconds}, [this]() {
+        if (observer != nullptr)
+            observer->callback();
+    });
+}
+
+void VirtualTime::cancelLastCallback() { events.erase(lastTimerCallback); }
+
+auto VirtualTime::advance() -> bool {
+    if (events.empty())
+        return false;
+    const auto next{events.begin()};
+    now_ = next->first.first;
+    const auto f{std::move(next->second)};
+    events.erase(next);
+    f();
+    return true;
+}
+
+auto VirtualTime::now() const -> Duration { return Duration{now_}; }
+
+auto VirtualTime::pending() const -> bool { return !events.empty(); }
+
+auto VirtualTime::time() -> std::string {
+    const auto seconds{
+        originSeconds + static_cast<std::int64_t>(std::floor(now_))};
+    const auto days{(seconds >= 0 ? seconds : seconds - 86399) / 86400};
+    const auto secondOfDay{seconds - days * 86400};
+    const auto date{civil(days)};
+    char formatted[64];
+    std::snprintf(formatted, sizeof formatted,
+        "%04lld-%02u-%02u %02lld:%02lld:%02lld",
+        static_cast<long long>(date.year), date.month, date.day,
+        static_cast<long long>(secondOfDay / 3600),
+        static_cast<long long>(secondOfDay / 60 % 60),
+        static_cast<long long>(secondOfDay % 60));
+    return formatted;
+}
+}
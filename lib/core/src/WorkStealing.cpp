@@ -0,0 +1,110 @@
+#include "WorkStealing.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+class Share {
+  public:
+    void assign(gsl::index begin, gsl::index end) {
+        const std::lock_guard<std::mutex> lock{mutex};
+        begin_ = begin;
+        end_ = end;
+    }
+
+    auto take(gsl::index &task) -> bool {
+        const std::lock_guard<std::mutex> lock{mutex};
+        if (begin_ == end_)
+            return false;
+        task = begin_++;
+        return true;
+    }
+
+    // Thieves take from the back so that owners keep walking forward
+    // through contiguous indices.
+    auto stealHalf(gsl::index &begin, gsl::index &end) -> bool {
+        const std::lock_guard<std::mutex> lock{mutex};
+        const auto remaining{end_ - begin_};
+        if (remaining == 0)
+            return false;
+        end = end_;
+        end_ -= (remaining + 1) / 2;
+        begin = end_;
+        return true;
+    }
+
+    auto remaining() -> gsl::index {
+        const std::lock_guard<std::mutex> lock{mutex};
+        return end_ - begin_;
+    }
+
+  private:
+    std::mutex mutex;
+    gsl::index begin_{};
+    gsl::index end_{};
+};
+}
+
+static auto size(const std::vector<Share> &v) -> gsl::index {
+    return v.size();
+}
+
+static auto steal(std::vector<Share> &shares, gsl::index thief) -> bool {
+    for (;;) {
+        gsl::index victim{-1};
+        gsl::index most{0};
+        for (gsl::index i{0}; i < size(shares); ++i)
+            if (i != thief) {
+                const auto remaining{shares.at(i).remaining()};
+                if (remaining > most) {
+                    most = remaining;
+                    victim = i;
+                }
+            }
+        if (victim == -1)
+            return false;
+        gsl::index begin{};
+        gsl::index end{};
+        if (shares.at(victim).stealHalf(begin, end)) {
+            shares.at(thief).assign(begin, end);
+            return true;
+        }
+    }
+}
+
+void runWorkStealing(gsl::index tasks, unsigned threads,
+    const std::function<void(gsl::index)> &task) {
+    const auto workers{std::max<gsl::index>(
+        1, std::min<gsl::index>(gsl::narrow_cast<gsl::index>(threads), tasks))};
+    std::vector<Share> shares(workers);
+    for (gsl::index i{0}; i < workers; ++i)
+        shares.at(i).assign(tasks * i / workers, tasks * (i + 1) / workers);
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+    const auto work{[&](gsl::index worker) {
+        auto &share{shares.at(worker)};
+        do {
+            for (gsl::index i{}; share.take(i);)
+                try {
+                    task(i);
+                } catch (...) {
+                    const std::lock_guard<std::mutex> lock{failureMutex};
+                    if (!failure)
+                        failure = std::current_exception();
+                }
+        } while (steal(shares, worker));
+    }};
+    std::vector<std::thread> threadsStarted;
+    for (gsl::index i{1}; i < workers; ++i)
+        threadsStarted.emplace_back(work, i);
+    work(0);
+    for (auto &thread : threadsStarted)
+        thread.join();
+    if (failure)
+        std::rethrow_exception(failure);
+}
+}
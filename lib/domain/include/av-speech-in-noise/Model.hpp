@@ -135,6 +135,11 @@ struct RationalNumber {
     int denominator;
 };
 
+struct GazeFilterSettings {
+    double outputRateHz{};
+    bool smoothing{};
+};
+
 struct Test {
     TestIdentity identity;
     LocalUrl targetsUrl;
@@ -146,6 +151,7 @@ struct Test {
     AudioChannelOption audioChannelOption{AudioChannelOption::all};
     bool keepVideoShown{};
     bool enableVibrotactileStimulus{};
+    GazeFilterSettings gazeFilter{};
 };
 
 struct TrackingSequence {
@@ -165,6 +171,10 @@ struct SNR : RealLevelDifference {
     explicit constexpr SNR(int dB = {}) : RealLevelDifference{dB} {}
 };
 
+enum class TrackSelection { random, roundRobin, leastPresented };
+
+enum class TrackAlgorithm { staircase, psi };
+
 struct AdaptiveTest : Test {
     TrackingRule trackingRule;
     SNR startingSnr{};
@@ -172,11 +182,28 @@ struct AdaptiveTest : Test {
     SNR floorSnr{};
     int trackBumpLimit{};
     int thresholdReversals{};
+    // When nonzero, a track also stops once the standard error of its last
+    // convergenceReversals reversals falls below this many dB.
+    int convergenceReversals{};
+    double convergenceStandardErrorDb{};
+    TrackSelection trackSelection{};
+    TrackAlgorithm trackAlgorithm{};
+};
+
+enum class TrackStoppingReason {
+    none,
+    completedRule,
+    reachedBumpLimit,
+    converged
 };
 
 struct AdaptiveTestResult {
     LocalUrl targetsUrl;
     double threshold{};
+    TrackStoppingReason stoppingReason{};
+    // Spread of the reversals averaged into the threshold, or the
+    // posterior standard deviation for Psi. NaN when too few to estimate.
+    double thresholdStandardDeviation{};
 };
 
 struct KeywordsTestResults {
@@ -188,6 +215,8 @@ using AdaptiveTestResults = typename std::vector<AdaptiveTestResult>;
 
 struct FixedLevelTest : Test {
     SNR snr{};
+    std::uint64_t trialPlanSeed{};
+    bool compileTrialPlan{};
 };
 
 struct FixedLevelFixedTrialsTest : FixedLevelTest {
@@ -255,6 +284,14 @@ struct EyeTrackerTargetPlayerSynchronization {
     TargetPlayerSystemTime targetPlayerSystemTime;
 };
 
+struct EyeTrackerTargetPlayerClockModel {
+    TargetPlayerSystemTime reference{};
+    EyeTrackerSystemTime eyeTrackerSystemTimeAtReference{};
+    double driftPartsPerMillion{};
+    double residualStandardDeviationMicroseconds{};
+    int samples{};
+};
+
 struct BinocularGazeSample {
     EyeTrackerSystemTime systemTime{};
     Gaze left;
@@ -263,6 +300,20 @@ struct BinocularGazeSample {
 
 using BinocularGazeSamples = typename std::vector<BinocularGazeSample>;
 
+struct EyeGazeStatistics {
+    double percentValid{};
+    Point2D meanRelativeScreen{};
+    Point2D standardDeviationRelativeScreen{};
+};
+
+struct BinocularGazeStatistics {
+    EyeGazeStatistics left;
+    EyeGazeStatistics right;
+    int fixations{};
+    int blinks{};
+    int gaps{};
+};
+
 struct TargetStartTime : TargetPlayerSystemTime {
     explicit constexpr TargetStartTime(std::uintmax_t nanoseconds = 0)
         : TargetPlayerSystemTime{nanoseconds} {}
@@ -276,6 +327,39 @@ constexpr auto name(Condition c) -> const char * {
         return "audio-visual";
     }
 }
+
+constexpr auto name(TrackSelection s) -> const char * {
+    switch (s) {
+    case TrackSelection::random:
+        return "random";
+    case TrackSelection::roundRobin:
+        return "round robin";
+    case TrackSelection::leastPresented:
+        return "least presented";
+    }
+}
+
+constexpr auto name(TrackAlgorithm a) -> const char * {
+    switch (a) {
+    case TrackAlgorithm::staircase:
+        return "staircase";
+    case TrackAlgorithm::psi:
+        return "psi";
+    }
+}
+
+constexpr auto name(TrackStoppingReason r) -> const char * {
+    switch (r) {
+    case TrackStoppingReason::none:
+        return "none";
+    case TrackStoppingReason::completedRule:
+        return "completed rule";
+    case TrackStoppingReason::reachedBumpLimit:
+        return "reached bump limit";
+    case TrackStoppingReason::converged:
+        return "converged";
+    }
+}
 }
 
 #endif
@@ -0,0 +1,22 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_PLAYER_INCLUDE_AVSPEECHINNOISE_PLAYER_AUDIOLEVELSHPP_
+#define AV_SPEECH_IN_NOISE_LIB_PLAYER_INCLUDE_AVSPEECHINNOISE_PLAYER_AUDIOLEVELSHPP_
+
+#include "AudioReader.hpp"
+
+#include <av-speech-in-noise/core/Player.hpp>
+
+namespace av_speech_in_noise {
+// The RMS of the first channel, which the players scale against, and the
+// largest magnitude of any sample. Silence is at minus infinity.
+struct AudioLevels {
+    DigitalLevel rms{};
+    DigitalLevel peak{};
+};
+
+auto levels(const audio_type &) -> AudioLevels;
+
+// What is left below full scale once a peak is amplified; negative clips.
+auto headroom(DigitalLevel peak, LevelAmplification) -> double;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_PLAYER_INCLUDE_AVSPEECHINNOISE_PLAYER_TRIALRENDERERHPP_
+#define AV_SPEECH_IN_NOISE_LIB_PLAYER_INCLUDE_AVSPEECHINNOISE_PLAYER_TRIALRENDERERHPP_
+
+#include "AudioReader.hpp"
+
+#include <av-speech-in-noise/Model.hpp>
+#include <av-speech-in-noise/core/Player.hpp>
+
+namespace av_speech_in_noise {
+struct TrialStimulus {
+    LocalUrl masker;
+    LocalUrl target;
+    double maskerSeekSeconds{};
+    RealLevel maskerLevel{};
+    RealLevel fullScaleLevel{};
+    SNR snr{};
+};
+
+// Mixes a trial offline into two channels. The masker runs through
+// MaskerPlayerImpl with the given ramps, level and seek; the target starts
+// one onset fringe after the fade-in completes, scaled as RunningATestImpl
+// scales it. Both files must share the sample rate. Safe to call
+// concurrently when the reader is.
+auto render(AudioReader &, double sampleRateHz, Duration rampDuration,
+    const TrialStimulus &) -> audio_type;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_PLAYER_INCLUDE_AVSPEECHINNOISE_PLAYER_WAVFILEHPP_
+#define AV_SPEECH_IN_NOISE_LIB_PLAYER_INCLUDE_AVSPEECHINNOISE_PLAYER_WAVFILEHPP_
+
+#include "AudioReader.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace av_speech_in_noise {
+struct WavAudio {
+    audio_type audio;
+    double sampleRateHz{};
+};
+
+// Integer PCM of 8 to 32 bits and 32 or 64 bit IEEE float, with or without
+// the extensible format header. Throws AudioReader::InvalidFile otherwise.
+auto readWav(std::istream &) -> WavAudio;
+
+// Writes 32 bit IEEE float samples. Channels must be the same length.
+void writeWav(std::ostream &, const audio_type &, double sampleRateHz);
+
+class WavFileReader : public AudioReader {
+  public:
+    auto read(std::string filePath) -> audio_type override;
+};
+}
+
+#endif
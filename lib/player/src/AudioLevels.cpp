@@ -0,0 +1,31 @@
+#include "AudioLevels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace av_speech_in_noise {
+static auto decibels(double x) -> DigitalLevel {
+    return DigitalLevel{x == 0 ? -std::numeric_limits<double>::infinity()
+                               : 20 * std::log10(x)};
+}
+
+auto levels(const audio_type &audio) -> AudioLevels {
+    if (audio.empty() || audio.front().empty())
+        return {decibels(0), decibels(0)};
+    auto squares{0.};
+    for (const auto x : audio.front())
+        squares += static_cast<double>(x) * x;
+    auto peak{0.};
+    for (const auto &channel : audio)
+        for (const auto x : channel)
+            peak = std::max(peak, std::abs(static_cast<double>(x)));
+    return {decibels(std::sqrt(
+                squares / static_cast<double>(audio.front().size()))),
+        decibels(peak)};
+}
+
+auto headroom(DigitalLevel peak, LevelAmplification x) -> double {
+    return -(peak.dBov + x.dB);
+}
+}
@@ -0,0 +1,134 @@
+#include "TrialRenderer.hpp"
+#include "MaskerPlayerImpl.hpp"
+
+#include <av-speech-in-noise/core/IRunningATest.hpp>
+
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace av_speech_in_noise {
+namespace {
+class OfflineAudioPlayer : public AudioPlayer {
+  public:
+    explicit OfflineAudioPlayer(double sampleRateHz)
+        : sampleRateHz_{sampleRateHz} {}
+    void attach(Observer *) override {}
+    void play() override {}
+    void stop() override {}
+    auto playing() -> bool override { return false; }
+    void loadFile(std::string) override {}
+    auto deviceCount() -> int override { return 0; }
+    auto deviceDescription(int) -> std::string override { return {}; }
+    auto outputDevice(int) -> bool override { return false; }
+    void setDevice(int) override {}
+    auto sampleRateHz() -> double override { return sampleRateHz_; }
+    auto nanoseconds(PlayerTime t) -> std::uintmax_t override {
+        return t.system;
+    }
+    auto currentSystemTime() -> PlayerTime override { return {}; }
+
+  private:
+    double sampleRateHz_;
+};
+
+class InertTimer : public Timer {
+  public:
+    void attach(Observer *) override {}
+    void scheduleCallbackAfterSeconds(double) override {}
+    void cancelLastCallback() override {}
+};
+
+class FadeInTime : public MaskerPlayer::Observer {
+  public:
+    void fadeInComplete(const AudioSampleTimeWithOffset &t) override {
+        time = t;
+    }
+    void fadeOutComplete() override {}
+
+    std::optional<AudioSampleTimeWithOffset> time;
+};
+}
+
+constexpr gsl::index framesPerBuffer{512};
+
+static auto frames(double seconds, double sampleRateHz) -> gsl::index {
+    return gsl::narrow_cast<gsl::index>(seconds * sampleRateHz);
+}
+
+static auto samples(const channel_type &channel) -> gsl::index {
+    return channel.size();
+}
+
+static auto scalar(LevelAmplification x) -> double {
+    return std::pow(10, x.dB / 20);
+}
+
+static void mix(audio_type &mixed, const audio_type &target,
+    gsl::index start, double scale) {
+    for (gsl::index i{0}; i < gsl::narrow_cast<gsl::index>(mixed.size());
+         ++i) {
+        auto &channel{mixed.at(i)};
+        const auto &source{gsl::narrow_cast<gsl::index>(target.size()) > i
+                ? target.at(i)
+                : target.front()};
+        const auto n{std::min(samples(source), samples(channel) - start)};
+        for (gsl::index j{0}; j < n; ++j)
+            channel.at(start + j) +=
+                gsl::narrow_cast<sample_type>(source.at(j) * scale);
+    }
+}
+
+auto render(AudioReader &reader, double sampleRateHz, Duration rampDuration,
+    const TrialStimulus &stimulus) -> audio_type {
+    OfflineAudioPlayer player{sampleRateHz};
+    InertTimer timer;
+    MaskerPlayerImpl masker{player, reader, timer};
+    FadeInTime fadeIn;
+    masker.attach(&fadeIn);
+    masker.setRampFor(rampDuration);
+    masker.loadFile(stimulus.masker);
+    const LevelAmplification maskerAmplification{
+        stimulus.maskerLevel.dB_SPL - stimulus.fullScaleLevel.dB_SPL -
+        masker.digitalLevel().dBov};
+    masker.apply(maskerAmplification);
+    const auto target{reader.read(stimulus.target.path)};
+    if (target.empty())
+        throw AudioReader::InvalidFile{};
+    const auto fringe{RunningATest::targetOnsetFringeDuration.seconds};
+    const auto steadyLevel{
+        samples(target.front()) / sampleRateHz + 2 * fringe};
+    masker.seekSeconds(stimulus.maskerSeekSeconds);
+    masker.setSteadyLevelFor(Duration{steadyLevel});
+    masker.fadeIn();
+
+    // Past the fade out the ramp holds the masker at zero.
+    const auto totalFrames{2 * frames(rampDuration.seconds, sampleRateHz) +
+        frames(steadyLevel, sampleRateHz) + 3};
+    // The fade out completes at least two fringes after the fade in, so
+    // with buffers no longer than a fringe it never completes before the
+    // fade in is observed. That keeps this from reaching
+    // MaskerPlayerImpl::stop, which waits on the audio thread.
+    const auto bufferFrames{std::max(gsl::index{1},
+        std::min(framesPerBuffer, frames(fringe, sampleRateHz)))};
+    audio_type mixed(2, channel_type(totalFrames));
+    for (gsl::index start{0}; start < totalFrames; start += bufferFrames) {
+        const auto n{std::min(bufferFrames, totalFrames - start)};
+        std::vector<channel_buffer_type> buffers;
+        for (auto &channel : mixed)
+            buffers.emplace_back(channel.data() + start, n);
+        masker.fillAudioBuffer(buffers, start);
+        if (!fadeIn.time)
+            masker.callback();
+    }
+    if (fadeIn.time)
+        mix(mixed, target,
+            gsl::narrow_cast<gsl::index>(fadeIn.time->playerTime.system) +
+                fadeIn.time->sampleOffset + frames(fringe, sampleRateHz),
+            scalar(LevelAmplification{
+                maskerAmplification.dB + stimulus.snr.dB}));
+    return mixed;
+}
+}
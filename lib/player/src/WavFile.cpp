@@ -0,0 +1,173 @@
+#include "WavFile.hpp"
+
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+struct Format {
+    int encoding{};
+    int channels{};
+    std::uint32_t sampleRateHz{};
+    int bitsPerSample{};
+};
+}
+
+constexpr auto pcmEncoding{1};
+constexpr auto floatEncoding{3};
+constexpr auto extensibleEncoding{0xFFFE};
+
+static auto littleEndian(const std::vector<char> &bytes, gsl::index at,
+    int size) -> std::uint32_t {
+    if (at < 0 || at + size > gsl::narrow_cast<gsl::index>(bytes.size()))
+        throw AudioReader::InvalidFile{};
+    std::uint32_t x{0};
+    for (auto i{size - 1}; i >= 0; --i) {
+        const auto byte{bytes.at(gsl::narrow_cast<std::size_t>(at + i))};
+        x = (x << 8U) | static_cast<unsigned char>(byte);
+    }
+    return x;
+}
+
+static auto tagEquals(const std::vector<char> &bytes, gsl::index at,
+    const char *tag) -> bool {
+    return at + 4 <= gsl::narrow_cast<gsl::index>(bytes.size()) &&
+        std::memcmp(bytes.data() + at, tag, 4) == 0;
+}
+
+static auto format(const std::vector<char> &bytes, gsl::index at) -> Format {
+    Format f;
+    f.encoding = gsl::narrow_cast<int>(littleEndian(bytes, at, 2));
+    f.channels = gsl::narrow_cast<int>(littleEndian(bytes, at + 2, 2));
+    f.sampleRateHz = littleEndian(bytes, at + 4, 4);
+    f.bitsPerSample = gsl::narrow_cast<int>(littleEndian(bytes, at + 14, 2));
+    if (f.encoding == extensibleEncoding)
+        f.encoding = gsl::narrow_cast<int>(littleEndian(bytes, at + 24, 2));
+    return f;
+}
+
+static auto sample(const char *p, const Format &f) -> sample_type {
+    if (f.encoding == floatEncoding && f.bitsPerSample == 32) {
+        float x{};
+        std::memcpy(&x, p, sizeof x);
+        return x;
+    }
+    if (f.encoding == floatEncoding) {
+        double x{};
+        std::memcpy(&x, p, sizeof x);
+        return gsl::narrow_cast<sample_type>(x);
+    }
+    const auto bytes{f.bitsPerSample / 8};
+    if (bytes == 1)
+        return gsl::narrow_cast<sample_type>(
+                   static_cast<unsigned char>(*p) - 128) /
+            128;
+    std::uint32_t x{0};
+    for (auto i{bytes - 1}; i >= 0; --i)
+        x = (x << 8U) | static_cast<unsigned char>(p[i]);
+    const auto shift{32U - 8U * gsl::narrow_cast<unsigned>(bytes)};
+    const auto signedValue{static_cast<std::int32_t>(x << shift)};
+    return gsl::narrow_cast<sample_type>(signedValue / 2147483648.);
+}
+
+static auto supported(const Format &f) -> bool {
+    if (f.channels < 1)
+        return false;
+    if (f.encoding == floatEncoding)
+        return f.bitsPerSample == 32 || f.bitsPerSample == 64;
+    return f.encoding == pcmEncoding && f.bitsPerSample % 8 == 0 &&
+        f.bitsPerSample >= 8 && f.bitsPerSample <= 32;
+}
+
+auto readWav(std::istream &stream) -> WavAudio {
+    const std::vector<char> bytes{std::istreambuf_iterator<char>{stream},
+        std::istreambuf_iterator<char>{}};
+    if (!tagEquals(bytes, 0, "RIFF") || !tagEquals(bytes, 8, "WAVE"))
+        throw AudioReader::InvalidFile{};
+    Format f;
+    auto formatFound{false};
+    const auto end{gsl::narrow_cast<gsl::index>(bytes.size())};
+    for (gsl::index chunk{12}; chunk + 8 <= end;) {
+        const auto size{littleEndian(bytes, chunk + 4, 4)};
+        const auto body{chunk + 8};
+        if (tagEquals(bytes, chunk, "fmt ")) {
+            f = format(bytes, body);
+            formatFound = true;
+        } else if (tagEquals(bytes, chunk, "data")) {
+            if (!formatFound || !supported(f))
+                throw AudioReader::InvalidFile{};
+            const auto frameBytes{f.channels * f.bitsPerSample / 8};
+            const auto frames{std::min<gsl::index>(size, end - body) /
+                frameBytes};
+            WavAudio wav;
+            wav.sampleRateHz = f.sampleRateHz;
+            wav.audio.assign(gsl::narrow_cast<std::size_t>(f.channels),
+                channel_type(gsl::narrow_cast<std::size_t>(frames)));
+            const auto *p{bytes.data() + body};
+            for (gsl::index i{0}; i < frames; ++i)
+                for (auto &channel : wav.audio) {
+                    channel.at(gsl::narrow_cast<std::size_t>(i)) =
+                        sample(p, f);
+                    p += f.bitsPerSample / 8;
+                }
+            return wav;
+        }
+        chunk = body + size + (size % 2);
+    }
+    throw AudioReader::InvalidFile{};
+}
+
+static void put(std::ostream &stream, std::uint32_t x, int size) {
+    for (auto i{0U}; i < gsl::narrow_cast<unsigned>(size); ++i)
+        stream.put(static_cast<char>((x >> (8U * i)) & 0xFFU));
+}
+
+void writeWav(
+    std::ostream &stream, const audio_type &audio, double sampleRateHz) {
+    const auto channels{gsl::narrow_cast<std::uint32_t>(audio.size())};
+    const auto frames{audio.empty()
+            ? std::uint32_t{0}
+            : gsl::narrow_cast<std::uint32_t>(audio.front().size())};
+    const auto bytesPerSample{std::uint32_t{sizeof(float)}};
+    const auto dataBytes{frames * channels * bytesPerSample};
+    const auto rate{gsl::narrow_cast<std::uint32_t>(sampleRateHz)};
+    stream.write("RIFF", 4);
+    put(stream, 4 + 26 + 12 + 8 + dataBytes, 4);
+    stream.write("WAVE", 4);
+    stream.write("fmt ", 4);
+    put(stream, 18, 4);
+    put(stream, floatEncoding, 2);
+    put(stream, channels, 2);
+    put(stream, rate, 4);
+    put(stream, rate * channels * bytesPerSample, 4);
+    put(stream, channels * bytesPerSample, 2);
+    put(stream, 8 * bytesPerSample, 2);
+    put(stream, 0, 2);
+    stream.write("fact", 4);
+    put(stream, 4, 4);
+    put(stream, frames, 4);
+    stream.write("data", 4);
+    put(stream, dataBytes, 4);
+    for (std::uint32_t i{0}; i < frames; ++i)
+        for (const auto &channel : audio) {
+            std::array<char, sizeof(float)> buffer{};
+            const auto x{channel.at(i)};
+            std::memcpy(buffer.data(), &x, sizeof x);
+            stream.write(buffer.data(), buffer.size());
+        }
+}
+
+auto WavFileReader::read(std::string filePath) -> audio_type {
+    std::ifstream stream{filePath, std::ios::binary};
+    if (!stream)
+        throw InvalidFile{};
+    return readWav(stream).audio;
+}
+}
@@ -0,0 +1,51 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_CACHINGDIRECTORYREADERHPP_
+#define AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_CACHINGDIRECTORYREADERHPP_
+
+#include "SubdirectoryTargetPlaylistReader.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace av_speech_in_noise {
+// Serves listings from memory for as long as the directory's own
+// modification time is unchanged, so a repeated listing costs one stat.
+// Adding, removing or renaming an entry updates that time. Directories
+// that can't be stat'd, or that were modified too recently for the time
+// to be trusted, are always listed by the decorated reader.
+//
+// With an index path the cache is loaded from it on construction and
+// written back by flush and on destruction, so later runs start warm
+// and a cold start over many directories writes the index once.
+// Safe to share between threads when the decorated reader is.
+class CachingDirectoryReader : public DirectoryReader {
+  public:
+    explicit CachingDirectoryReader(
+        DirectoryReader *, std::filesystem::path index = {});
+    ~CachingDirectoryReader() override;
+    auto subDirectories(const LocalUrl &) -> LocalUrls override;
+    auto filesIn(const LocalUrl &) -> LocalUrls override;
+    void flush();
+
+    enum class Kind { files, subDirectories };
+    struct Listing {
+        std::int64_t modified{};
+        LocalUrls entries;
+    };
+
+  private:
+    auto listing(const LocalUrl &, Kind) -> LocalUrls;
+    auto list(const LocalUrl &, Kind) -> LocalUrls;
+
+    std::map<std::pair<Kind, std::string>, Listing> listings;
+    std::filesystem::path index;
+    std::mutex mutex;
+    DirectoryReader *reader;
+    bool unsaved{};
+};
+}
+
+#endif
@@ -2,8 +2,12 @@
 #define AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_FILEFILTERDECORATORHPP_
 
 #include "RandomizedTargetPlaylists.hpp"
-#include <vector>
+
+#include <av-speech-in-noise/Interface.hpp>
+
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace av_speech_in_noise {
 class FileFilter {
@@ -22,31 +26,59 @@ class FileFilterDecorator : public DirectoryReader {
     auto subDirectories(const LocalUrl &) -> LocalUrls override;
 };
 
-class FileExtensionFilter : public FileFilter {
-    std::vector<std::string> filters;
+// Decides on a single file name without copying it, so several can be
+// combined into one pass over a directory.
+class FileMatcher {
+  public:
+    AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(FileMatcher);
+    [[nodiscard]] virtual auto matches(std::string_view) const -> bool = 0;
+};
+
+// Strings looked up by the end of a name, once per distinct length.
+class SuffixSet {
+  public:
+    explicit SuffixSet(std::vector<std::string>);
+    [[nodiscard]] auto endOf(std::string_view) const -> bool;
+
+  private:
+    std::vector<std::string> suffixes;
+    std::vector<std::size_t> lengths;
+};
+
+// Keeps the files every matcher accepts, in a single pass.
+class FileMatcherPipeline : public FileFilter {
+    std::vector<const FileMatcher *> matchers;
+
+  public:
+    explicit FileMatcherPipeline(std::vector<const FileMatcher *>);
+    auto filter(LocalUrls) -> LocalUrls override;
+};
+
+class FileExtensionFilter : public FileFilter, public FileMatcher {
+    SuffixSet extensions;
 
   public:
     explicit FileExtensionFilter(std::vector<std::string> filters);
     auto filter(LocalUrls) -> LocalUrls override;
+    [[nodiscard]] auto matches(std::string_view) const -> bool override;
 };
 
-class FileIdentifierFilter : public FileFilter {
+class FileIdentifierFilter : public FileFilter, public FileMatcher {
     std::string identifier;
 
   public:
     explicit FileIdentifierFilter(std::string identifier);
     auto filter(LocalUrls) -> LocalUrls override;
-
-  private:
-    auto containsIdentifier(const std::string &) -> bool;
+    [[nodiscard]] auto matches(std::string_view) const -> bool override;
 };
 
-class FileIdentifierExcluderFilter : public FileFilter {
-    std::vector<std::string> identifiers;
+class FileIdentifierExcluderFilter : public FileFilter, public FileMatcher {
+    SuffixSet identifiers;
 
   public:
     explicit FileIdentifierExcluderFilter(std::vector<std::string> identifiers);
     auto filter(LocalUrls) -> LocalUrls override;
+    [[nodiscard]] auto matches(std::string_view) const -> bool override;
 };
 
 class RandomSubsetFiles : public FileFilter {
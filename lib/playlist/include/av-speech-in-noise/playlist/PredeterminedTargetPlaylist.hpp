@@ -1,6 +1,7 @@
 #ifndef AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_PREDETERMINEDTARGETPLAYLISTHPP_
 #define AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_PREDETERMINEDTARGETPLAYLISTHPP_
 
+#include "TargetQueue.hpp"
 #include "av-speech-in-noise/Model.hpp"
 #include <av-speech-in-noise/core/TargetPlaylist.hpp>
 #include <av-speech-in-noise/core/TextFileReader.hpp>
@@ -27,7 +28,7 @@ class PredeterminedTargetPlaylist : public FiniteTargetPlaylistWithRepeatables {
   private:
     TextFileReader &fileReader;
     TargetValidator &targetValidator;
-    std::vector<LocalUrl> targets;
+    TargetQueue targets;
     LocalUrl current_;
 };
 }
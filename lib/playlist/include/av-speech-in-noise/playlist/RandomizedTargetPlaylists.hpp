@@ -2,14 +2,18 @@
 #define AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_RANDOMIZEDTARGETPLAYLISTSHPP_
 
 #include "SubdirectoryTargetPlaylistReader.hpp"
+#include "TargetQueue.hpp"
 
 #include <av-speech-in-noise/Interface.hpp>
+#include <av-speech-in-noise/core/PathTable.hpp>
 #include <av-speech-in-noise/core/TargetPlaylist.hpp>
 
 #include <gsl/gsl>
 
-#include <vector>
+#include <cstdint>
 #include <memory>
+#include <random>
+#include <vector>
 
 namespace av_speech_in_noise {
 namespace target_list {
@@ -18,39 +22,68 @@ class Randomizer {
     AV_SPEECH_IN_NOISE_INTERFACE_SPECIAL_MEMBER_FUNCTIONS(Randomizer);
     virtual void shuffle(gsl::span<LocalUrl>) = 0;
     virtual void shuffle(gsl::span<int>) = 0;
+    virtual auto betweenInclusive(int, int) -> int = 0;
+};
+
+// One of many independent streams from a seed. Lists that each own one
+// shuffle the same way however their loads are scheduled.
+class SeededRandomizer : public Randomizer {
+  public:
+    SeededRandomizer(std::uint64_t seed, std::uint64_t stream);
+    void shuffle(gsl::span<LocalUrl>) override;
+    void shuffle(gsl::span<int>) override;
+    auto betweenInclusive(int, int) -> int override;
+
+  private:
+    std::mt19937_64 engine;
 };
 }
 
-class RandomizedTargetPlaylistWithReplacement : public TargetPlaylist {
+class RandomizedTargetPlaylistWithReplacement : public SeedableTargetPlaylist {
   public:
     class Factory : public TargetPlaylistFactory {
       public:
         Factory(DirectoryReader *reader, target_list::Randomizer *randomizer)
             : reader{reader}, randomizer{randomizer} {}
 
+        // Each list made gets its own stream of the seed.
+        Factory(DirectoryReader *reader, std::uint64_t seed)
+            : reader{reader}, seed{seed} {}
+
         auto make() -> std::shared_ptr<TargetPlaylist> override {
+            if (randomizer == nullptr)
+                return std::make_shared<
+                    RandomizedTargetPlaylistWithReplacement>(reader,
+                    std::make_unique<target_list::SeededRandomizer>(
+                        seed, made++));
             return std::make_shared<RandomizedTargetPlaylistWithReplacement>(
                 reader, randomizer);
         }
 
       private:
         DirectoryReader *reader;
-        target_list::Randomizer *randomizer;
+        target_list::Randomizer *randomizer{};
+        std::uint64_t seed{};
+        std::uint64_t made{};
     };
 
+    RandomizedTargetPlaylistWithReplacement(
+        DirectoryReader *, std::unique_ptr<target_list::Randomizer>);
     RandomizedTargetPlaylistWithReplacement(
         DirectoryReader *, target_list::Randomizer *);
     void load(const LocalUrl &) override;
     auto next() -> LocalUrl override;
     auto current() -> LocalUrl override;
     auto directory() -> LocalUrl override;
+    void seed(std::uint64_t) override;
 
   private:
-    LocalUrls files{};
+    PathTable paths;
     LocalUrl directory_{};
-    LocalUrl currentFile{};
+    std::unique_ptr<target_list::Randomizer> ownedRandomizer;
     DirectoryReader *reader;
     target_list::Randomizer *randomizer;
+    gsl::index currentPath{};
 };
 
 class RandomizedTargetPlaylistWithoutReplacement
@@ -66,7 +99,7 @@ class RandomizedTargetPlaylistWithoutReplacement
     auto directory() -> LocalUrl override;
 
   private:
-    LocalUrls files{};
+    TargetQueue files;
     LocalUrl directory_{};
     LocalUrl currentFile{};
     DirectoryReader *reader;
@@ -80,16 +113,29 @@ class CyclicRandomizedTargetPlaylist : public TargetPlaylist {
         Factory(DirectoryReader *reader, target_list::Randomizer *randomizer)
             : reader{reader}, randomizer{randomizer} {}
 
+        // Each list made gets its own stream of the seed.
+        Factory(DirectoryReader *reader, std::uint64_t seed)
+            : reader{reader}, seed{seed} {}
+
         auto make() -> std::shared_ptr<TargetPlaylist> override {
+            if (randomizer == nullptr)
+                return std::make_shared<CyclicRandomizedTargetPlaylist>(
+                    reader,
+                    std::make_unique<target_list::SeededRandomizer>(
+                        seed, made++));
             return std::make_shared<CyclicRandomizedTargetPlaylist>(
                 reader, randomizer);
         }
 
       private:
         DirectoryReader *reader;
-        target_list::Randomizer *randomizer;
+        target_list::Randomizer *randomizer{};
+        std::uint64_t seed{};
+        std::uint64_t made{};
     };
 
+    CyclicRandomizedTargetPlaylist(
+        DirectoryReader *, std::unique_ptr<target_list::Randomizer>);
     CyclicRandomizedTargetPlaylist(
         DirectoryReader *, target_list::Randomizer *);
     void load(const LocalUrl &directory) override;
@@ -98,10 +144,12 @@ class CyclicRandomizedTargetPlaylist : public TargetPlaylist {
     auto directory() -> LocalUrl override;
 
   private:
-    LocalUrls files{};
+    PathTable paths;
     LocalUrl directory_{};
+    std::unique_ptr<target_list::Randomizer> ownedRandomizer;
     DirectoryReader *reader;
     target_list::Randomizer *randomizer;
+    gsl::index currentPath{};
 };
 
 class EachTargetPlayedOnceThenShuffleAndRepeat
@@ -31,13 +31,17 @@ class DirectoryReader {
     virtual auto filesIn(const LocalUrl &directory) -> LocalUrls = 0;
 };
 
+// Lists are made in order on the calling thread and then loaded on up to
+// `threads` workers, which requires the directory reader to be safe to
+// share and each list to have its own randomizer.
 class SubdirectoryTargetPlaylistReader : public TargetPlaylistReader {
     TargetPlaylistFactory *targetListFactory;
     DirectoryReader *directoryReader;
+    unsigned threads;
 
   public:
     SubdirectoryTargetPlaylistReader(
-        TargetPlaylistFactory *, DirectoryReader *);
+        TargetPlaylistFactory *, DirectoryReader *, unsigned threads = 1);
     auto read(const LocalUrl &) -> lists_type override;
 };
 }
@@ -0,0 +1,29 @@
+#ifndef AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_TARGETQUEUEHPP_
+#define AV_SPEECH_IN_NOISE_LIB_PLAYLIST_INCLUDE_AVSPEECHINNOISE_PLAYLIST_TARGETQUEUEHPP_
+
+#include <av-speech-in-noise/core/TargetPlaylist.hpp>
+
+#include <gsl/gsl>
+
+#include <vector>
+
+namespace av_speech_in_noise {
+// A cursor over the targets still to be played. Reinserted targets are
+// appended at the back. Once at least half the storage has been played,
+// a reinsert first drops the played prefix, so a test that keeps
+// reinserting does not grow the queue without bound.
+class TargetQueue {
+  public:
+    void assign(std::vector<LocalUrl>);
+    [[nodiscard]] auto empty() const -> bool;
+    // Requires !empty().
+    auto next() -> const LocalUrl &;
+    void reinsert(const LocalUrl &);
+
+  private:
+    std::vector<LocalUrl> targets;
+    gsl::index cursor{};
+};
+}
+
+#endif
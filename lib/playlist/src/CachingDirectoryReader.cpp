@@ -0,0 +1,145 @@
+#include "CachingDirectoryReader.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <system_error>
+
+namespace av_speech_in_noise {
+constexpr auto indexHeader{"av-speech-in-noise directory index 1"};
+
+// Changes within the file system's timestamp resolution of a listing
+// would go unnoticed.
+constexpr std::chrono::seconds untrustedModificationAge{2};
+
+static auto modificationTime(const std::string &path)
+    -> std::optional<std::filesystem::file_time_type> {
+    std::error_code error;
+    const auto time{std::filesystem::last_write_time(path, error)};
+    if (error)
+        return std::nullopt;
+    return time;
+}
+
+static auto count(std::filesystem::file_time_type t) -> std::int64_t {
+    return t.time_since_epoch().count();
+}
+
+static void write(std::ostream &stream, const std::string &s) {
+    stream << s.size() << ' ' << s << '\n';
+}
+
+static auto read(std::istream &stream, std::string &s) -> bool {
+    std::size_t size{};
+    if (!(stream >> size) || stream.get() != ' ')
+        return false;
+    s.resize(size);
+    return static_cast<bool>(stream.read(s.data(), size)) &&
+        stream.get() == '\n';
+}
+
+using Listings = std::map<std::pair<CachingDirectoryReader::Kind, std::string>,
+    CachingDirectoryReader::Listing>;
+
+static auto read(std::istream &stream, Listings &listings) -> bool {
+    int kind{};
+    CachingDirectoryReader::Listing listing;
+    std::size_t entries{};
+    std::string directory;
+    if (!(stream >> kind >> listing.modified >> entries) ||
+        !read(stream, directory))
+        return false;
+    listing.entries.resize(entries);
+    for (auto &entry : listing.entries)
+        if (!read(stream, entry.path))
+            return false;
+    listings[{static_cast<CachingDirectoryReader::Kind>(kind), directory}] =
+        std::move(listing);
+    return true;
+}
+
+static auto load(const std::filesystem::path &index) -> Listings {
+    Listings listings;
+    std::ifstream stream{index, std::ios::binary};
+    std::string header;
+    if (!std::getline(stream, header) || header != indexHeader)
+        return {};
+    while (stream.peek() != std::ifstream::traits_type::eof())
+        if (!read(stream, listings))
+            return {};
+    return listings;
+}
+
+CachingDirectoryReader::CachingDirectoryReader(
+    DirectoryReader *reader, std::filesystem::path index)
+    : index{std::move(index)}, reader{reader} {
+    if (!this->index.empty())
+        listings = load(this->index);
+}
+
+CachingDirectoryReader::~CachingDirectoryReader() { flush(); }
+
+auto CachingDirectoryReader::subDirectories(const LocalUrl &directory)
+    -> LocalUrls {
+    return listing(directory, Kind::subDirectories);
+}
+
+auto CachingDirectoryReader::filesIn(const LocalUrl &directory) -> LocalUrls {
+    return listing(directory, Kind::files);
+}
+
+auto CachingDirectoryReader::list(const LocalUrl &directory, Kind kind)
+    -> LocalUrls {
+    return kind == Kind::files ? reader->filesIn(directory)
+                               : reader->subDirectories(directory);
+}
+
+auto CachingDirectoryReader::listing(const LocalUrl &directory, Kind kind)
+    -> LocalUrls {
+    const auto modified{modificationTime(directory.path)};
+    if (!modified)
+        return list(directory, kind);
+    const std::pair key{kind, directory.path};
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        const auto found{listings.find(key)};
+        if (found != listings.end() &&
+            found->second.modified == count(*modified))
+            return found->second.entries;
+    }
+    auto entries{list(directory, kind)};
+    if (std::filesystem::file_time_type::clock::now() - *modified <
+        untrustedModificationAge)
+        return entries;
+    std::lock_guard<std::mutex> lock{mutex};
+    listings[key] = Listing{count(*modified), entries};
+    unsaved = true;
+    return entries;
+}
+
+// Written aside and renamed over the index so a reader never sees half of
+// one. A failure only costs the next run its warm start.
+void CachingDirectoryReader::flush() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (index.empty() || !unsaved)
+        return;
+    unsaved = false;
+    auto written{index};
+    written += ".tmp";
+    {
+        std::ofstream stream{written, std::ios::binary};
+        stream << indexHeader << '\n';
+        for (const auto &[key, listing] : listings) {
+            stream << static_cast<int>(key.first) << ' ' << listing.modified
+                   << ' ' << listing.entries.size() << ' ';
+            write(stream, key.second);
+            for (const auto &entry : listing.entries)
+                write(stream, entry.path);
+        }
+        if (!stream)
+            return;
+    }
+    std::error_code error;
+    std::filesystem::rename(written, index, error);
+}
+}
@@ -2,14 +2,13 @@
 #include <gsl/gsl>
 #include <numeric>
 #include <algorithm>
+#include <utility>
 
 namespace av_speech_in_noise {
 static auto at(const std::vector<int> &x, gsl::index n) -> int {
     return x.at(n);
 }
 
-static auto at(const LocalUrls &x, gsl::index n) -> LocalUrl { return x.at(n); }
-
 static auto vectorOfStrings(gsl::index size) -> LocalUrls {
     return LocalUrls(size);
 }
@@ -29,62 +28,87 @@ auto FileFilterDecorator::subDirectories(const LocalUrl &directory)
     return reader->subDirectories(directory);
 }
 
-FileExtensionFilter::FileExtensionFilter(std::vector<std::string> filters)
-    : filters{std::move(filters)} {}
+static auto bySizeThenContents(std::string_view a, std::string_view b)
+    -> bool {
+    return a.size() != b.size() ? a.size() < b.size() : a < b;
+}
+
+SuffixSet::SuffixSet(std::vector<std::string> v) : suffixes{std::move(v)} {
+    std::sort(suffixes.begin(), suffixes.end(), bySizeThenContents);
+    suffixes.erase(
+        std::unique(suffixes.begin(), suffixes.end()), suffixes.end());
+    for (const auto &suffix : suffixes)
+        if (lengths.empty() || lengths.back() != suffix.size())
+            lengths.push_back(suffix.size());
+}
 
-static auto endingMatchesFilter(
-    const std::string &file, const std::string &filter) -> bool {
-    return file.length() >= filter.length() &&
-        0 ==
-        file.compare(file.length() - filter.length(), filter.length(), filter);
+auto SuffixSet::endOf(std::string_view s) const -> bool {
+    for (const auto length : lengths) {
+        if (length > s.size())
+            return false;
+        const auto end{s.substr(s.size() - length)};
+        if (std::binary_search(
+                suffixes.begin(), suffixes.end(), end, bySizeThenContents))
+            return true;
+    }
+    return false;
 }
 
+// Compacts in place, so the only allocation is the one the caller made.
+static auto keepMatching(LocalUrls files,
+    const std::vector<const FileMatcher *> &matchers) -> LocalUrls {
+    files.erase(std::remove_if(files.begin(), files.end(),
+                    [&](const LocalUrl &file) {
+                        return !std::all_of(matchers.begin(), matchers.end(),
+                            [&](const FileMatcher *m) {
+                                return m->matches(file.path);
+                            });
+                    }),
+        files.end());
+    return files;
+}
+
+FileMatcherPipeline::FileMatcherPipeline(
+    std::vector<const FileMatcher *> matchers)
+    : matchers{std::move(matchers)} {}
+
+auto FileMatcherPipeline::filter(LocalUrls files) -> LocalUrls {
+    return keepMatching(std::move(files), matchers);
+}
+
+FileExtensionFilter::FileExtensionFilter(std::vector<std::string> filters)
+    : extensions{std::move(filters)} {}
+
 auto FileExtensionFilter::filter(LocalUrls files) -> LocalUrls {
-    LocalUrls filtered_{};
-    for (const auto &file : files)
-        for (const auto &filter : filters)
-            if (endingMatchesFilter(file.path, filter))
-                filtered_.push_back(file);
-    return filtered_;
+    return keepMatching(std::move(files), {this});
+}
+
+auto FileExtensionFilter::matches(std::string_view file) const -> bool {
+    return extensions.endOf(file);
 }
 
 FileIdentifierExcluderFilter::FileIdentifierExcluderFilter(
     std::vector<std::string> identifiers)
     : identifiers{std::move(identifiers)} {}
 
-static auto endsWith(const std::string &s, const std::string &what) -> bool {
-    auto withoutExtension = s.substr(0, s.find('.'));
-    return endingMatchesFilter(withoutExtension, what);
+auto FileIdentifierExcluderFilter::filter(LocalUrls files) -> LocalUrls {
+    return keepMatching(std::move(files), {this});
 }
 
-auto FileIdentifierExcluderFilter::filter(LocalUrls files) -> LocalUrls {
-    LocalUrls filtered_{};
-    for (const auto &file : files) {
-        bool exclude = false;
-        for (const auto &identifier : identifiers)
-            if (endsWith(file.path, identifier)) {
-                exclude = true;
-                break;
-            }
-        if (!exclude)
-            filtered_.push_back(file);
-    }
-    return filtered_;
+auto FileIdentifierExcluderFilter::matches(std::string_view file) const
+    -> bool {
+    return !identifiers.endOf(file.substr(0, file.find('.')));
 }
 
 FileIdentifierFilter::FileIdentifierFilter(std::string identifier)
     : identifier{std::move(identifier)} {}
 
 auto FileIdentifierFilter::filter(LocalUrls files) -> LocalUrls {
-    LocalUrls filtered_{};
-    for (const auto &file : files)
-        if (containsIdentifier(file.path))
-            filtered_.push_back(file);
-    return filtered_;
+    return keepMatching(std::move(files), {this});
 }
 
-auto FileIdentifierFilter::containsIdentifier(const std::string &file) -> bool {
-    return file.find(identifier) != std::string::npos;
+auto FileIdentifierFilter::matches(std::string_view file) const -> bool {
+    return file.find(identifier) != std::string_view::npos;
 }
 
 RandomSubsetFiles::RandomSubsetFiles(target_list::Randomizer *randomizer, int N)
@@ -97,8 +121,9 @@ auto RandomSubsetFiles::filter(LocalUrls files) -> LocalUrls {
     std::iota(indices.begin(), indices.end(), 0);
     randomizer->shuffle(indices);
     auto subset = vectorOfStrings(N);
-    std::generate(subset.begin(), subset.end(),
-        [&, n = 0]() mutable { return at(files, at(indices, n++)); });
+    std::generate(subset.begin(), subset.end(), [&, n = 0]() mutable {
+        return std::move(files.at(at(indices, n++)));
+    });
     return subset;
 }
 
@@ -1,7 +1,9 @@
 #include "PredeterminedTargetPlaylist.hpp"
 
-#include <filesystem>
+#include <av-speech-in-noise/core/PathTable.hpp>
+
 #include <sstream>
+#include <utility>
 
 namespace av_speech_in_noise {
 PredeterminedTargetPlaylist::PredeterminedTargetPlaylist(
@@ -18,37 +20,40 @@ static auto trim(std::string s) -> std::string {
 }
 
 void PredeterminedTargetPlaylist::load(const LocalUrl &url) {
-    targets.clear();
+    std::vector<LocalUrl> loaded;
+    targets.assign({});
     try {
         std::stringstream stream{fileReader.read(url)};
         for (std::string line; std::getline(stream, line);) {
             const auto trimmed = trim(line);
             if (!trimmed.empty())
-                targets.push_back(LocalUrl{trimmed});
+                loaded.push_back(LocalUrl{trimmed});
         }
     } catch (const TextFileReader::FileDoesNotExist &) {
         throw LoadFailure{};
     }
-    for (const auto &target : targets)
+    for (const auto &target : loaded)
         if (!targetValidator.isValid(target))
             throw LoadFailure{};
+    targets.assign(std::move(loaded));
 }
 
 auto PredeterminedTargetPlaylist::next() -> LocalUrl {
-    current_ = targets.front();
-    targets.erase(targets.begin());
-    return current_;
+    if (targets.empty())
+        return {};
+
+    return current_ = targets.next();
 }
 
 auto PredeterminedTargetPlaylist::current() -> LocalUrl { return current_; }
 
 auto PredeterminedTargetPlaylist::directory() -> LocalUrl {
-    return LocalUrl{std::filesystem::path{current_.path}.parent_path()};
+    return LocalUrl{std::string{parentPath(current_.path)}};
 }
 
 auto PredeterminedTargetPlaylist::empty() -> bool { return targets.empty(); }
 
 void PredeterminedTargetPlaylist::reinsertCurrent() {
-    targets.push_back(current_);
+    targets.reinsert(current_);
 }
 }
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <utility>
 
 namespace av_speech_in_noise {
 static auto filesIn(DirectoryReader *reader, const LocalUrl &s) -> LocalUrls {
@@ -20,28 +21,50 @@ static auto shuffle(target_list::Randomizer *randomizer,
 
 static auto empty(const LocalUrls &files) -> bool { return files.empty(); }
 
-static auto currentFile(const LocalUrls &v) -> LocalUrl {
-    return empty(v) ? av_speech_in_noise::LocalUrl{""} : v.back();
-}
-
 static auto joinPaths(const LocalUrl &directory, const LocalUrl &file)
     -> LocalUrl {
     return {std::filesystem::path{directory.path} / file.path};
 }
 
-static auto fullPathToLastFile(
-    const LocalUrl &directory, const LocalUrls &files) -> LocalUrl {
-    return empty(files) ? av_speech_in_noise::LocalUrl{""}
-                        : joinPaths(directory, currentFile(files));
+static auto joinPaths(const LocalUrl &directory, LocalUrls files)
+    -> LocalUrls {
+    for (auto &file : files)
+        file = joinPaths(directory, file);
+    return files;
+}
+
+static void assign(PathTable &table, const LocalUrl &directory,
+    const LocalUrls &files) {
+    table.clear();
+    for (const auto &file : files)
+        table.add(directory.path, file.path);
+}
+
+static auto url(const PathTable &table, PathTable::Handle h) -> LocalUrl {
+    return table.empty() ? LocalUrl{""} : LocalUrl{std::string{table.path(h)}};
+}
+
+namespace target_list {
+SeededRandomizer::SeededRandomizer(std::uint64_t seed, std::uint64_t stream) {
+    std::seed_seq sequence{static_cast<std::uint32_t>(seed),
+        static_cast<std::uint32_t>(seed >> 32U),
+        static_cast<std::uint32_t>(stream),
+        static_cast<std::uint32_t>(stream >> 32U)};
+    engine.seed(sequence);
+}
+
+void SeededRandomizer::shuffle(gsl::span<LocalUrl> s) {
+    std::shuffle(s.begin(), s.end(), engine);
 }
 
-static void moveFrontToBack(LocalUrls &files) {
-    std::rotate(files.begin(), files.begin() + 1, files.end());
+void SeededRandomizer::shuffle(gsl::span<int> s) {
+    std::shuffle(s.begin(), s.end(), engine);
 }
 
-static auto allButLast(gsl::span<av_speech_in_noise::LocalUrl> s)
-    -> gsl::span<av_speech_in_noise::LocalUrl> {
-    return s.first(s.size() - 1);
+auto SeededRandomizer::betweenInclusive(int a, int b) -> int {
+    std::uniform_int_distribution<> distribution{a, b};
+    return distribution(engine);
+}
 }
 
 RandomizedTargetPlaylistWithReplacement::
@@ -49,52 +72,70 @@ RandomizedTargetPlaylistWithReplacement::
         DirectoryReader *reader, target_list::Randomizer *randomizer)
     : reader{reader}, randomizer{randomizer} {}
 
+RandomizedTargetPlaylistWithReplacement::
+    RandomizedTargetPlaylistWithReplacement(DirectoryReader *reader,
+        std::unique_ptr<target_list::Randomizer> randomizer)
+    : ownedRandomizer{std::move(randomizer)}, reader{reader},
+      randomizer{ownedRandomizer.get()} {}
+
 void RandomizedTargetPlaylistWithReplacement::load(const LocalUrl &d) {
-    shuffle(randomizer, files = filesIn(reader, directory_ = d));
+    auto files{filesIn(reader, directory_ = d)};
+    shuffle(randomizer, files);
+    assign(paths, directory_, files);
+    currentPath = paths.size() - 1;
 }
 
+// Uniform over every file but the current one, as reshuffling all but the
+// current file and taking the front would be.
 auto RandomizedTargetPlaylistWithReplacement::next() -> LocalUrl {
-    if (empty(files))
+    if (paths.empty())
         return {""};
 
-    moveFrontToBack(files);
-    shuffle(randomizer, allButLast(files));
-    return fullPathToLastFile(directory_, files);
+    if (paths.size() > 1)
+        currentPath = (currentPath + 1 +
+                          randomizer->betweenInclusive(
+                              0, gsl::narrow<int>(paths.size() - 2))) %
+            paths.size();
+    return url(paths, currentPath);
 }
 
 auto RandomizedTargetPlaylistWithReplacement::current() -> LocalUrl {
-    return fullPathToLastFile(directory_, files);
+    return url(paths, currentPath);
 }
 
 auto RandomizedTargetPlaylistWithReplacement::directory() -> LocalUrl {
     return directory_;
 }
 
+void RandomizedTargetPlaylistWithReplacement::seed(std::uint64_t s) {
+    ownedRandomizer = std::make_unique<target_list::SeededRandomizer>(s, 0);
+    randomizer = ownedRandomizer.get();
+}
+
 RandomizedTargetPlaylistWithoutReplacement::
     RandomizedTargetPlaylistWithoutReplacement(
         DirectoryReader *reader, target_list::Randomizer *randomizer)
     : reader{reader}, randomizer{randomizer} {}
 
 void RandomizedTargetPlaylistWithoutReplacement::load(const LocalUrl &d) {
-    shuffle(randomizer, files = filesIn(reader, directory_ = d));
+    auto loaded{filesIn(reader, directory_ = d)};
+    shuffle(randomizer, loaded);
+    files.assign(joinPaths(directory_, std::move(loaded)));
 }
 
 auto RandomizedTargetPlaylistWithoutReplacement::empty() -> bool {
-    return av_speech_in_noise::empty(files);
+    return files.empty();
 }
 
 auto RandomizedTargetPlaylistWithoutReplacement::next() -> LocalUrl {
-    if (av_speech_in_noise::empty(files))
+    if (files.empty())
         return {""};
 
-    currentFile = files.front();
-    files.erase(files.begin());
-    return joinPaths(directory_, currentFile);
+    return currentFile = files.next();
 }
 
 auto RandomizedTargetPlaylistWithoutReplacement::current() -> LocalUrl {
-    return currentFile.path.empty() ? av_speech_in_noise::LocalUrl{""}
-                                    : joinPaths(directory_, currentFile);
+    return currentFile;
 }
 
 auto RandomizedTargetPlaylistWithoutReplacement::directory() -> LocalUrl {
@@ -102,27 +143,36 @@ auto RandomizedTargetPlaylistWithoutReplacement::directory() -> LocalUrl {
 }
 
 void RandomizedTargetPlaylistWithoutReplacement::reinsertCurrent() {
-    files.push_back(currentFile);
+    files.reinsert(currentFile);
 }
 
 CyclicRandomizedTargetPlaylist::CyclicRandomizedTargetPlaylist(
     DirectoryReader *reader, target_list::Randomizer *randomizer)
     : reader{reader}, randomizer{randomizer} {}
 
+CyclicRandomizedTargetPlaylist::CyclicRandomizedTargetPlaylist(
+    DirectoryReader *reader,
+    std::unique_ptr<target_list::Randomizer> randomizer)
+    : ownedRandomizer{std::move(randomizer)}, reader{reader},
+      randomizer{ownedRandomizer.get()} {}
+
 void CyclicRandomizedTargetPlaylist::load(const LocalUrl &d) {
-    shuffle(randomizer, files = filesIn(reader, directory_ = d));
+    auto files{filesIn(reader, directory_ = d)};
+    shuffle(randomizer, files);
+    assign(paths, directory_, files);
+    currentPath = paths.size() - 1;
 }
 
 auto CyclicRandomizedTargetPlaylist::next() -> LocalUrl {
-    if (empty(files))
+    if (paths.empty())
         return {""};
 
-    moveFrontToBack(files);
-    return fullPathToLastFile(directory_, files);
+    currentPath = (currentPath + 1) % paths.size();
+    return url(paths, currentPath);
 }
 
 auto CyclicRandomizedTargetPlaylist::current() -> LocalUrl {
-    return fullPathToLastFile(directory_, files);
+    return url(paths, currentPath);
 }
 
 auto CyclicRandomizedTargetPlaylist::directory() -> LocalUrl {
@@ -135,7 +185,9 @@ EachTargetPlayedOnceThenShuffleAndRepeat::
     : reader{reader}, randomizer{randomizer} {}
 
 void EachTargetPlayedOnceThenShuffleAndRepeat::load(const LocalUrl &d) {
-    shuffle(randomizer, files = filesIn(reader, directory_ = d));
+    files = filesIn(reader, directory_ = d);
+    shuffle(randomizer, files);
+    files = joinPaths(directory_, std::move(files));
     endOfPlaylistCount = 0;
     currentFileIt = files.begin();
 }
@@ -150,12 +202,11 @@ auto EachTargetPlayedOnceThenShuffleAndRepeat::next() -> LocalUrl {
         shuffle(randomizer, files);
         currentFileIt = files.begin();
     }
-    return joinPaths(directory_, currentFile);
+    return currentFile;
 }
 
 auto EachTargetPlayedOnceThenShuffleAndRepeat::current() -> LocalUrl {
-    return currentFile.path.empty() ? av_speech_in_noise::LocalUrl{""}
-                                    : joinPaths(directory_, currentFile);
+    return currentFile;
 }
 
 auto EachTargetPlayedOnceThenShuffleAndRepeat::directory() -> LocalUrl {
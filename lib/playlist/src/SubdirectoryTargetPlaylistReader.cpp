@@ -1,32 +1,35 @@
 #include "SubdirectoryTargetPlaylistReader.hpp"
 
+#include <av-speech-in-noise/core/WorkStealing.hpp>
+
+#include <gsl/gsl>
+
 #include <filesystem>
 
 namespace av_speech_in_noise {
 SubdirectoryTargetPlaylistReader::SubdirectoryTargetPlaylistReader(
-    TargetPlaylistFactory *targetListFactory, DirectoryReader *directoryReader)
-    : targetListFactory{targetListFactory}, directoryReader{directoryReader} {}
-
-static void add(TargetPlaylistReader::lists_type &lists,
-    TargetPlaylistFactory *factory, const LocalUrl &url) {
-    auto list{factory->make()};
-    list->load(url);
-    lists.push_back(std::move(list));
-}
+    TargetPlaylistFactory *targetListFactory, DirectoryReader *directoryReader,
+    unsigned threads)
+    : targetListFactory{targetListFactory}, directoryReader{directoryReader},
+      threads{threads} {}
 
 auto SubdirectoryTargetPlaylistReader::read(const LocalUrl &directory)
     -> lists_type {
     lists_type lists{};
     try {
         const auto subDirectories = directoryReader->subDirectories(directory);
+        std::vector<LocalUrl> urls;
         for (const auto &subDirectory : subDirectories)
-            add(lists, targetListFactory,
-                LocalUrl{
-                    std::filesystem::path{directory.path} / subDirectory.path});
+            urls.push_back(LocalUrl{
+                std::filesystem::path{directory.path} / subDirectory.path});
         if (subDirectories.empty())
-            add(lists, targetListFactory, directory);
-
+            urls.push_back(directory);
+        for (std::size_t i{0}; i < urls.size(); ++i)
+            lists.push_back(targetListFactory->make());
+        runWorkStealing(gsl::narrow<gsl::index>(urls.size()), threads,
+            [&](gsl::index i) { lists.at(i)->load(urls.at(i)); });
     } catch (const DirectoryReader::CannotRead &) {
+        lists.clear();
     }
     return lists;
 }
@@ -0,0 +1,26 @@
+#include "TargetQueue.hpp"
+
+#include <utility>
+
+namespace av_speech_in_noise {
+static auto size(const std::vector<LocalUrl> &v) -> gsl::index {
+    return v.size();
+}
+
+void TargetQueue::assign(std::vector<LocalUrl> v) {
+    targets = std::move(v);
+    cursor = 0;
+}
+
+auto TargetQueue::empty() const -> bool { return cursor == size(targets); }
+
+auto TargetQueue::next() -> const LocalUrl & { return targets.at(cursor++); }
+
+void TargetQueue::reinsert(const LocalUrl &target) {
+    if (cursor > 0 && 2 * cursor >= size(targets)) {
+        targets.erase(targets.begin(), targets.begin() + cursor);
+        cursor = 0;
+    }
+    targets.push_back(target);
+}
+}
@@ -10,6 +10,9 @@
 #include <av-speech-in-noise/core/IRunningATest.hpp>
 #include <av-speech-in-noise/core/TargetPlaylist.hpp>
 
+#include <string>
+#include <vector>
+
 namespace av_speech_in_noise {
 enum class Method {
     adaptivePassFail, // <-- this one should be first...
@@ -97,7 +100,15 @@ enum class TestSetting {
     videoScaleNumerator,
     videoScaleDenominator,
     keepVideoShown,
-    puzzle
+    puzzle,
+    gazeOutputRate,
+    gazeSmoothing,
+    convergenceReversals,
+    convergenceStandardError,
+    trackSelection,
+    track,
+    trialPlan,
+    trialPlanSeed
 };
 
 constexpr auto name(TestSetting p) -> const char * {
@@ -148,13 +159,30 @@ constexpr auto name(TestSetting p) -> const char * {
         return "video scale numerator";
     case TestSetting::videoScaleDenominator:
         return "video scale denominator";
+    case TestSetting::gazeOutputRate:
+        return "gaze output rate (Hz)";
+    case TestSetting::gazeSmoothing:
+        return "gaze smoothing";
+    case TestSetting::convergenceReversals:
+        return "convergence reversals";
+    case TestSetting::convergenceStandardError:
+        return "convergence standard error (dB)";
+    case TestSetting::trackSelection:
+        return "track selection";
+    case TestSetting::track:
+        return "track";
+    case TestSetting::trialPlan:
+        return "trial plan";
+    case TestSetting::trialPlanSeed:
+        return "trial plan seed";
     }
 }
 
 class TestSettingsInterpreterImpl : public TestSettingsInterpreter {
   public:
     TestSettingsInterpreterImpl(RunningATest &runningATest,
-        AdaptiveMethod &adaptiveMethod, FixedLevelMethod &fixedLevelMethod,
+        AdaptiveMethod &adaptiveMethod, Track::Factory &staircaseTrackFactory,
+        Track::Factory &psiTrackFactory, FixedLevelMethod &fixedLevelMethod,
         RunningATest::TestObserver &eyeTracking,
         RunningATest::TestObserver &audioRecording,
         TargetPlaylistReader &cyclicTargetsReader,
@@ -163,7 +191,7 @@ class TestSettingsInterpreterImpl : public TestSettingsInterpreter {
         FiniteTargetPlaylistWithRepeatables &everyTargetOnce,
         FiniteTargetPlaylistWithRepeatables &silentIntervalTargets,
         RepeatableFiniteTargetPlaylist &eachTargetNTimes,
-        TargetPlaylist &targetsWithReplacement,
+        SeedableTargetPlaylist &targetsWithReplacement,
         submitting_free_response::Puzzle &puzzle,
         FreeResponseController &freeResponseController,
         SessionController &sessionController,
@@ -177,14 +205,27 @@ class TestSettingsInterpreterImpl : public TestSettingsInterpreter {
         RunningATest::TestObserver &submittingKeyPressResponse,
         TaskPresenter &emotionPresenter, TaskPresenter &childEmotionPresenter,
         TaskPresenter &fixedPassFailPresenter);
+    // Throws std::runtime_error listing every error in the settings
+    // before anything is initialized.
     void initializeTest(
         const std::string &, const TestIdentity &, SNR) override;
     static auto meta(const std::string &) -> std::string;
+    static auto method(const std::string &) -> Method;
+    static auto adaptiveTest(const std::string &) -> AdaptiveTest;
+    // A fixed-level test without a starting SNR entry is at 0 dB.
+    static auto fixedLevelTest(const std::string &) -> FixedLevelTest;
+    // Everything wrong with the settings, each with its line number. An
+    // empty result means every line names a setting with a valid value.
+    static auto errors(const std::string &) -> std::vector<std::string>;
     auto calibration(const std::string &) -> Calibration override;
 
   private:
+    auto trackFactory(const AdaptiveTest &) -> Track::Factory &;
+
     RunningATest &runningATest;
     AdaptiveMethod &adaptiveMethod;
+    Track::Factory &staircaseTrackFactory;
+    Track::Factory &psiTrackFactory;
     FixedLevelMethod &fixedLevelMethod;
     RunningATest::TestObserver &eyeTracking;
     RunningATest::TestObserver &audioRecording;
@@ -194,7 +235,7 @@ class TestSettingsInterpreterImpl : public TestSettingsInterpreter {
     FiniteTargetPlaylistWithRepeatables &everyTargetOnce;
     FiniteTargetPlaylistWithRepeatables &silentIntervalTargets;
     RepeatableFiniteTargetPlaylist &eachTargetNTimes;
-    TargetPlaylist &targetsWithReplacement;
+    SeedableTargetPlaylist &targetsWithReplacement;
     submitting_free_response::Puzzle &puzzle;
     FreeResponseController &freeResponseController;
     SessionController &sessionController;
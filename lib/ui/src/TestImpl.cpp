@@ -1,5 +1,6 @@
 #include "TestImpl.hpp"
 
+#include <cmath>
 #include <sstream>
 #include <functional>
 
@@ -137,6 +138,13 @@ void TestPresenterImpl::notifyThatNextTrialIsReady() {
 void TestPresenterImpl::updateTrialInformation() {
     std::stringstream stream;
     stream << "Trial " << runningATest.trialNumber();
+    if (runningATest.method() == &adaptiveMethod)
+        if (const auto result{adaptiveMethod.currentTrackResult()}) {
+            stream << " (threshold " << result->threshold << " dB SNR";
+            if (!std::isnan(result->thresholdStandardDeviation))
+                stream << ", SD " << result->thresholdStandardDeviation;
+            stream << ')';
+        }
     view.display(stream.str());
     view.secondaryDisplay(runningATest.targetFileName());
 }
@@ -145,9 +153,12 @@ void TestPresenterImpl::updateAdaptiveTestResults() {
     view.showContinueTestingDialog();
     std::stringstream thresholds;
     thresholds << "thresholds (targets: dB SNR)";
-    for (const auto &result : adaptiveMethod.testResults())
+    for (const auto &result : adaptiveMethod.testResults()) {
         thresholds << '\n'
                    << result.targetsUrl.path << ": " << result.threshold;
+        if (!std::isnan(result.thresholdStandardDeviation))
+            thresholds << " (SD " << result.thresholdStandardDeviation << ')';
+    }
     view.setContinueTestingDialogMessage(thresholds.str());
 }
 
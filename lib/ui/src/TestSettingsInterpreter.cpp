@@ -3,174 +3,214 @@
 
 #include <gsl/gsl>
 
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
+#include <optional>
+#include <random>
 #include <stdexcept>
 #include <string>
-#include <cstddef>
 #include <string_view>
+#include <system_error>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace av_speech_in_noise {
-static auto entryDelimiter(const std::string &s) -> gsl::index {
-    return s.find(':');
-}
+namespace {
+struct TestSettingEntry {
+    TestSetting setting;
+    std::string_view value;
+};
 
-static auto vectorOfInts(const std::string &s) -> std::vector<int> {
-    std::vector<int> v;
-    std::stringstream stream{s};
-    int x{};
-    while (stream >> x)
-        v.push_back(x);
-    return v;
-}
+using TestSettingEntries = std::vector<TestSettingEntry>;
 
-static auto trackingRule(AdaptiveTest &test) -> TrackingRule & {
-    return test.trackingRule;
-}
+struct ParsedTestSettings {
+    TestSettingEntries entries;
+    std::vector<std::string> errors;
+};
 
-static void resizeTrackingRuleEnough(
-    AdaptiveTest &test, const std::vector<int> &v) {
-    if (trackingRule(test).size() < v.size())
-        trackingRule(test).resize(v.size());
-}
+template <typename T> struct Parsed {
+    T value{};
+    bool complete{};
+};
 
-static auto up(TrackingSequence &sequence) -> int & { return sequence.up; }
+enum class ValueKind {
+    text,
+    method,
+    integer,
+    unsignedInteger,
+    real,
+    integers,
+    boolean,
+    condition,
+    trackSelection,
+    trackAlgorithm
+};
+}
 
-static auto down(TrackingSequence &sequence) -> int & { return sequence.down; }
+constexpr auto testSettings{static_cast<int>(TestSetting::trialPlanSeed) + 1};
 
-static auto runCount(TrackingSequence &sequence) -> int & {
-    return sequence.runCount;
+constexpr auto testSetting(int i) -> TestSetting {
+    return static_cast<TestSetting>(i);
 }
 
-static auto stepSize(TrackingSequence &sequence) -> int & {
-    return sequence.stepSize;
+// FNV-1a
+constexpr auto hash(std::string_view s) -> std::uint32_t {
+    std::uint32_t h{2166136261U};
+    for (const auto c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619U;
+    }
+    return h;
 }
 
-// https://stackoverflow.com/a/217605
-static auto trim(std::string s) -> std::string {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char ch) {
-        return std::isspace(ch) == 0;
-    }));
-    s.erase(std::find_if(s.rbegin(), s.rend(),
-                [](unsigned char ch) { return std::isspace(ch) == 0; })
-                .base(),
-        s.end());
-    return s;
+constexpr auto collides(std::uint32_t tableSize) -> bool {
+    for (auto i{0}; i < testSettings; ++i)
+        for (auto j{0}; j < i; ++j)
+            if (hash(name(testSetting(i))) % tableSize ==
+                hash(name(testSetting(j))) % tableSize)
+                return true;
+    return false;
 }
 
-static void assignToEachElementOfTrackingRule(AdaptiveTest &test,
-    const std::function<int &(TrackingSequence &)> &elementRef,
-    const std::string &entry) {
-    auto v{vectorOfInts(entry)};
-    resizeTrackingRuleEnough(test, v);
-    for (std::size_t i{0}; i < v.size(); ++i)
-        elementRef(trackingRule(test).at(i)) = v.at(i);
+// The smallest table where each setting name hashes to its own slot.
+constexpr auto perfectHashTableSize() -> std::uint32_t {
+    for (std::uint32_t size{testSettings}; size < 4096; ++size)
+        if (!collides(size))
+            return size;
+    return 0;
+}
+
+constexpr auto testSettingTableSize{perfectHashTableSize()};
+static_assert(testSettingTableSize != 0, "no perfect hash for setting names");
+
+constexpr auto makeTestSettingTable()
+    -> std::array<int, testSettingTableSize> {
+    std::array<int, testSettingTableSize> table{};
+    for (std::uint32_t slot{0}; slot < testSettingTableSize; ++slot)
+        table[slot] = -1;
+    for (auto i{0}; i < testSettings; ++i)
+        table[hash(name(testSetting(i))) % testSettingTableSize] = i;
+    return table;
+}
+
+constexpr auto testSettingTable{makeTestSettingTable()};
+
+static auto testSetting(std::string_view s) -> std::optional<TestSetting> {
+    const auto slot{testSettingTable.at(hash(s) % testSettingTableSize)};
+    if (slot < 0 || s != name(testSetting(slot)))
+        return std::nullopt;
+    return testSetting(slot);
+}
+
+constexpr auto valueKind(TestSetting s) -> ValueKind {
+    switch (s) {
+    case TestSetting::method:
+        return ValueKind::method;
+    case TestSetting::maskerLevel:
+    case TestSetting::startingSnr:
+    case TestSetting::thresholdReversals:
+    case TestSetting::targetRepetitions:
+    case TestSetting::videoScaleNumerator:
+    case TestSetting::videoScaleDenominator:
+    case TestSetting::gazeOutputRate:
+    case TestSetting::convergenceReversals:
+        return ValueKind::integer;
+    case TestSetting::trialPlanSeed:
+        return ValueKind::unsignedInteger;
+    case TestSetting::convergenceStandardError:
+        return ValueKind::real;
+    case TestSetting::up:
+    case TestSetting::down:
+    case TestSetting::reversalsPerStepSize:
+    case TestSetting::stepSizes:
+        return ValueKind::integers;
+    case TestSetting::keepVideoShown:
+    case TestSetting::gazeSmoothing:
+    case TestSetting::trialPlan:
+        return ValueKind::boolean;
+    case TestSetting::condition:
+        return ValueKind::condition;
+    case TestSetting::trackSelection:
+        return ValueKind::trackSelection;
+    case TestSetting::track:
+        return ValueKind::trackAlgorithm;
+    default:
+        return ValueKind::text;
+    }
 }
 
-static auto entryName(const std::string &line) -> std::string {
-    return trim(line.substr(0, entryDelimiter(line)));
+static auto isSpace(char c) -> bool {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
 }
 
-static auto size(const std::string &s) -> gsl::index { return s.size(); }
+static auto trim(std::string_view s) -> std::string_view {
+    while (!s.empty() && isSpace(s.front()))
+        s.remove_prefix(1);
+    while (!s.empty() && isSpace(s.back()))
+        s.remove_suffix(1);
+    return s;
+}
 
-static auto entry(const std::string &line) -> std::string {
-    return entryDelimiter(line) >= size(line) - 1
-        ? ""
-        : trim(line.substr(entryDelimiter(line) + 1));
+// Like std::stoi, reads the longest leading number and ignores the rest.
+template <typename T>
+static auto leadingNumber(const char *begin, const char *end, T &value)
+    -> const char * {
+    if (begin != end && *begin == '+')
+        ++begin;
+    const auto [last, error]{std::from_chars(begin, end, value)};
+    return error == std::errc{} ? last : nullptr;
 }
 
-static void applyToEachEntry(
-    const std::function<void(const std::string &, const std::string &)> &f,
-    const std::string &contents) {
-    std::stringstream stream{contents};
-    for (std::string line; std::getline(stream, line);)
-        f(entryName(line), entry(line));
+template <typename T> static auto number(std::string_view s) -> Parsed<T> {
+    Parsed<T> parsed;
+    const auto *const end{s.data() + s.size()};
+    const auto *const last{leadingNumber(s.data(), end, parsed.value)};
+    if (last == nullptr)
+        parsed.value = {};
+    parsed.complete = last == end;
+    return parsed;
 }
 
-static auto integer(const std::string &s) -> int {
-    try {
-        return std::stoi(s);
-    } catch (const std::invalid_argument &) {
-        return 0;
-    }
+static auto integer(std::string_view s) -> int { return number<int>(s).value; }
+
+static auto unsignedInteger(std::string_view s) -> std::uint64_t {
+    return number<std::uint64_t>(s).value;
 }
 
-static void assign(
-    Test &test, const std::string &entryName, const std::string &entry) {
-    if (entryName == name(TestSetting::targets))
-        test.targetsUrl.path = entry;
-    else if (entryName == name(TestSetting::masker))
-        test.maskerFileUrl.path = entry;
-    else if (entryName == name(TestSetting::maskerLevel))
-        test.maskerLevel.dB_SPL = integer(entry);
-    else if (entryName == name(TestSetting::subjectId))
-        test.identity.subjectId = entry;
-    else if (entryName == name(TestSetting::testerId))
-        test.identity.testerId = entry;
-    else if (entryName == name(TestSetting::session))
-        test.identity.session = entry;
-    else if (entryName == name(TestSetting::rmeSetting))
-        test.identity.rmeSetting = entry;
-    else if (entryName == name(TestSetting::transducer))
-        test.identity.transducer = entry;
-    else if (entryName == name(TestSetting::meta))
-        test.identity.meta = entry;
-    else if (entryName == name(TestSetting::relativeOutputPath))
-        test.identity.relativeOutputUrl.path = entry;
-    else if (entryName == name(TestSetting::videoScaleNumerator))
-        test.videoScale.numerator = integer(entry);
-    else if (entryName == name(TestSetting::videoScaleDenominator))
-        test.videoScale.denominator = integer(entry);
-    else if (entryName == name(TestSetting::keepVideoShown))
-        test.keepVideoShown = entry == "true";
-    else if (entryName == name(TestSetting::condition))
-        for (auto c : {Condition::auditoryOnly, Condition::audioVisual})
-            if (entry == name(c))
-                test.condition = c;
-}
-
-static void assign(FixedLevelTest &test, const std::string &entryName,
-    const std::string &entry) {
-    if (entryName == name(TestSetting::startingSnr))
-        test.snr.dB = integer(entry);
-    else
-        assign(static_cast<Test &>(test), entryName, entry);
+static auto parsedReal(std::string_view s) -> Parsed<double> {
+    const std::string copy{s};
+    char *end{};
+    Parsed<double> parsed;
+    parsed.value = std::strtod(copy.c_str(), &end);
+    parsed.complete = !copy.empty() && *end == '\0';
+    return parsed;
 }
 
-static void assign(FixedLevelTestWithEachTargetNTimes &test,
-    const std::string &entryName, const std::string &entry) {
-    if (entryName == name(TestSetting::targetRepetitions))
-        test.timesEachTargetIsPlayed = integer(entry);
-    else
-        assign(static_cast<FixedLevelTest &>(test), entryName, entry);
-}
-
-static void assign(Calibration &calibration, const std::string &entryName,
-    const std::string &entry) {
-    if (entryName == name(TestSetting::masker))
-        calibration.fileUrl.path = entry;
-    else if (entryName == name(TestSetting::maskerLevel))
-        calibration.level.dB_SPL = integer(entry);
-}
-
-static void assign(AdaptiveTest &test, const std::string &entryName,
-    const std::string &entry) {
-    if (entryName == name(TestSetting::up))
-        assignToEachElementOfTrackingRule(test, up, entry);
-    else if (entryName == name(TestSetting::down))
-        assignToEachElementOfTrackingRule(test, down, entry);
-    else if (entryName == name(TestSetting::reversalsPerStepSize))
-        assignToEachElementOfTrackingRule(test, runCount, entry);
-    else if (entryName == name(TestSetting::stepSizes))
-        assignToEachElementOfTrackingRule(test, stepSize, entry);
-    else if (entryName == name(TestSetting::thresholdReversals))
-        test.thresholdReversals = integer(entry);
-    else if (entryName == name(TestSetting::startingSnr))
-        test.startingSnr.dB = integer(entry);
-    else
-        assign(static_cast<Test &>(test), entryName, entry);
+static auto real(std::string_view s) -> double { return parsedReal(s).value; }
+
+// Like reading ints from a stream, stops at the first that doesn't parse.
+static auto parsedIntegers(std::string_view s) -> Parsed<std::vector<int>> {
+    Parsed<std::vector<int>> parsed;
+    const auto *next{s.data()};
+    const auto *const end{s.data() + s.size()};
+    for (;;) {
+        while (next != end && isSpace(*next))
+            ++next;
+        if (next == end) {
+            parsed.complete = true;
+            return parsed;
+        }
+        int x{};
+        next = leadingNumber(next, end, x);
+        if (next == nullptr)
+            return parsed;
+        parsed.value.push_back(x);
+    }
 }
 
 // https://stackoverflow.com/a/31836401
@@ -194,43 +234,332 @@ template <typename C, C beginVal, C endVal> class EnumIterator {
     auto operator!=(const EnumIterator &i) -> bool { return val != i.val; }
 };
 
-static auto matches(const std::string_view &s, gsl::index position,
-    const std::string_view &other) -> bool {
-    return 0 == s.compare(position, other.length(), other);
+static auto startsWith(std::string_view s, std::string_view what) -> bool {
+    return s.substr(0, what.size()) == what;
+}
+
+static auto method(std::string_view s) -> Method {
+    for (const auto e : EnumIterator<Method, Method::adaptivePassFail,
+             Method::fixedLevelSyllablesWithAllTargets>{})
+        if (startsWith(s, name(e)))
+            return e;
+    return Method::unknown;
+}
+
+static auto condition(std::string_view s) -> std::optional<Condition> {
+    for (auto c : {Condition::auditoryOnly, Condition::audioVisual})
+        if (s == name(c))
+            return c;
+    return std::nullopt;
+}
+
+static auto trackSelection(std::string_view s)
+    -> std::optional<TrackSelection> {
+    for (auto c : {TrackSelection::random, TrackSelection::roundRobin,
+             TrackSelection::leastPresented})
+        if (s == name(c))
+            return c;
+    return std::nullopt;
+}
+
+static auto trackAlgorithm(std::string_view s)
+    -> std::optional<TrackAlgorithm> {
+    for (auto c : {TrackAlgorithm::staircase, TrackAlgorithm::psi})
+        if (s == name(c))
+            return c;
+    return std::nullopt;
+}
+
+static auto valid(ValueKind kind, std::string_view value) -> bool {
+    switch (kind) {
+    case ValueKind::text:
+        return true;
+    case ValueKind::method:
+        return method(value) != Method::unknown;
+    case ValueKind::integer:
+        return number<int>(value).complete;
+    case ValueKind::unsignedInteger:
+        return number<std::uint64_t>(value).complete;
+    case ValueKind::real:
+        return parsedReal(value).complete;
+    case ValueKind::integers:
+        return parsedIntegers(value).complete;
+    case ValueKind::boolean:
+        return value == "true" || value == "false";
+    case ValueKind::condition:
+        return condition(value).has_value();
+    case ValueKind::trackSelection:
+        return trackSelection(value).has_value();
+    case ValueKind::trackAlgorithm:
+        return trackAlgorithm(value).has_value();
+    }
+    return true;
+}
+
+static auto expected(ValueKind kind) -> const char * {
+    switch (kind) {
+    case ValueKind::text:
+        return "text";
+    case ValueKind::method:
+        return "a test method";
+    case ValueKind::integer:
+    case ValueKind::unsignedInteger:
+        return "an integer";
+    case ValueKind::real:
+        return "a number";
+    case ValueKind::integers:
+        return "a list of integers";
+    case ValueKind::boolean:
+        return "true or false";
+    case ValueKind::condition:
+        return "a condition";
+    case ValueKind::trackSelection:
+        return "a track selection";
+    case ValueKind::trackAlgorithm:
+        return "staircase or psi";
+    }
+    return "";
 }
 
-static auto startsWith(const std::string_view &s, const std::string_view &what)
-    -> bool {
-    if (s.length() >= what.length())
-        return matches(s, 0, what);
-    return false;
+static auto atLine(gsl::index line, std::string_view message) -> std::string {
+    return "line " + std::to_string(line) + ": " + std::string{message};
+}
+
+static auto quoted(std::string_view s) -> std::string {
+    return '"' + std::string{s} + '"';
+}
+
+// One pass over the lines. Entries that aren't settings are left out,
+// and values that don't parse are kept (they read as zero or false, as
+// they always have) but reported.
+static auto parse(std::string_view contents) -> ParsedTestSettings {
+    ParsedTestSettings parsed;
+    gsl::index lineNumber{0};
+    while (!contents.empty()) {
+        const auto lineEnd{contents.find('\n')};
+        const auto line{contents.substr(0, lineEnd)};
+        contents.remove_prefix(
+            lineEnd == std::string_view::npos ? contents.size() : lineEnd + 1);
+        ++lineNumber;
+        if (trim(line).empty())
+            continue;
+        const auto delimiter{line.find(':')};
+        if (delimiter == std::string_view::npos) {
+            parsed.errors.push_back(atLine(lineNumber,
+                "expected \"setting: value\" but found " +
+                    quoted(trim(line))));
+            continue;
+        }
+        const auto settingName{trim(line.substr(0, delimiter))};
+        const auto value{trim(line.substr(delimiter + 1))};
+        const auto setting{testSetting(settingName)};
+        if (!setting) {
+            parsed.errors.push_back(atLine(
+                lineNumber, "unknown setting " + quoted(settingName)));
+            continue;
+        }
+        const auto kind{valueKind(*setting)};
+        if (!valid(kind, value))
+            parsed.errors.push_back(
+                atLine(lineNumber,
+                    quoted(settingName) + " expects " + expected(kind) +
+                        " but found " + quoted(value)));
+        parsed.entries.push_back({*setting, value});
+    }
+    return parsed;
+}
+
+static auto trackingRule(AdaptiveTest &test) -> TrackingRule & {
+    return test.trackingRule;
+}
+
+static void resizeTrackingRuleEnough(
+    AdaptiveTest &test, const std::vector<int> &v) {
+    if (trackingRule(test).size() < v.size())
+        trackingRule(test).resize(v.size());
+}
+
+static auto up(TrackingSequence &sequence) -> int & { return sequence.up; }
+
+static auto down(TrackingSequence &sequence) -> int & { return sequence.down; }
+
+static auto runCount(TrackingSequence &sequence) -> int & {
+    return sequence.runCount;
+}
+
+static auto stepSize(TrackingSequence &sequence) -> int & {
+    return sequence.stepSize;
+}
+
+static void assignToEachElementOfTrackingRule(AdaptiveTest &test,
+    int &(*elementRef)(TrackingSequence &), std::string_view entry) {
+    const auto v{parsedIntegers(entry).value};
+    resizeTrackingRuleEnough(test, v);
+    for (std::size_t i{0}; i < v.size(); ++i)
+        elementRef(trackingRule(test).at(i)) = v.at(i);
+}
+
+static void assign(Test &test, const TestSettingEntry &entry) {
+    const auto value{entry.value};
+    switch (entry.setting) {
+    case TestSetting::targets:
+        test.targetsUrl.path = value;
+        break;
+    case TestSetting::masker:
+        test.maskerFileUrl.path = value;
+        break;
+    case TestSetting::maskerLevel:
+        test.maskerLevel.dB_SPL = integer(value);
+        break;
+    case TestSetting::subjectId:
+        test.identity.subjectId = value;
+        break;
+    case TestSetting::testerId:
+        test.identity.testerId = value;
+        break;
+    case TestSetting::session:
+        test.identity.session = value;
+        break;
+    case TestSetting::rmeSetting:
+        test.identity.rmeSetting = value;
+        break;
+    case TestSetting::transducer:
+        test.identity.transducer = value;
+        break;
+    case TestSetting::meta:
+        test.identity.meta = value;
+        break;
+    case TestSetting::relativeOutputPath:
+        test.identity.relativeOutputUrl.path = value;
+        break;
+    case TestSetting::videoScaleNumerator:
+        test.videoScale.numerator = integer(value);
+        break;
+    case TestSetting::videoScaleDenominator:
+        test.videoScale.denominator = integer(value);
+        break;
+    case TestSetting::keepVideoShown:
+        test.keepVideoShown = value == "true";
+        break;
+    case TestSetting::gazeOutputRate:
+        test.gazeFilter.outputRateHz = integer(value);
+        break;
+    case TestSetting::gazeSmoothing:
+        test.gazeFilter.smoothing = value == "true";
+        break;
+    case TestSetting::condition:
+        test.condition = condition(value).value_or(test.condition);
+        break;
+    default:
+        break;
+    }
+}
+
+static void assign(FixedLevelTest &test, const TestSettingEntry &entry) {
+    switch (entry.setting) {
+    case TestSetting::startingSnr:
+        test.snr.dB = integer(entry.value);
+        break;
+    case TestSetting::trialPlanSeed:
+        test.compileTrialPlan = true;
+        test.trialPlanSeed = unsignedInteger(entry.value);
+        break;
+    case TestSetting::trialPlan:
+        test.compileTrialPlan = entry.value == "true";
+        if (test.compileTrialPlan && test.trialPlanSeed == 0)
+            test.trialPlanSeed = std::random_device{}();
+        break;
+    default:
+        assign(static_cast<Test &>(test), entry);
+    }
+}
+
+static void assign(
+    FixedLevelTestWithEachTargetNTimes &test, const TestSettingEntry &entry) {
+    if (entry.setting == TestSetting::targetRepetitions)
+        test.timesEachTargetIsPlayed = integer(entry.value);
+    else
+        assign(static_cast<FixedLevelTest &>(test), entry);
 }
 
-static auto methodWithName(const std::string &contents)
+static void assign(Calibration &calibration, const TestSettingEntry &entry) {
+    if (entry.setting == TestSetting::masker)
+        calibration.fileUrl.path = entry.value;
+    else if (entry.setting == TestSetting::maskerLevel)
+        calibration.level.dB_SPL = integer(entry.value);
+}
+
+static void assign(AdaptiveTest &test, const TestSettingEntry &entry) {
+    const auto value{entry.value};
+    switch (entry.setting) {
+    case TestSetting::up:
+        assignToEachElementOfTrackingRule(test, up, value);
+        break;
+    case TestSetting::down:
+        assignToEachElementOfTrackingRule(test, down, value);
+        break;
+    case TestSetting::reversalsPerStepSize:
+        assignToEachElementOfTrackingRule(test, runCount, value);
+        break;
+    case TestSetting::stepSizes:
+        assignToEachElementOfTrackingRule(test, stepSize, value);
+        break;
+    case TestSetting::thresholdReversals:
+        test.thresholdReversals = integer(value);
+        break;
+    case TestSetting::convergenceReversals:
+        test.convergenceReversals = integer(value);
+        break;
+    case TestSetting::convergenceStandardError:
+        test.convergenceStandardErrorDb = real(value);
+        break;
+    case TestSetting::trackSelection:
+        test.trackSelection =
+            trackSelection(value).value_or(test.trackSelection);
+        break;
+    case TestSetting::track:
+        test.trackAlgorithm =
+            trackAlgorithm(value).value_or(test.trackAlgorithm);
+        break;
+    case TestSetting::startingSnr:
+        test.startingSnr.dB = integer(value);
+        break;
+    default:
+        assign(static_cast<Test &>(test), entry);
+    }
+}
+
+template <typename T>
+static void assignEach(T &test, const TestSettingEntries &entries) {
+    for (const auto &entry : entries)
+        assign(test, entry);
+}
+
+static auto find(const TestSettingEntries &entries, TestSetting setting)
+    -> const TestSettingEntry * {
+    const auto found{std::find_if(entries.begin(), entries.end(),
+        [=](const TestSettingEntry &e) { return e.setting == setting; })};
+    return found == entries.end() ? nullptr : &*found;
+}
+
+static auto methodWithName(const TestSettingEntries &entries)
     -> std::tuple<Method, std::string> {
-    std::stringstream stream{contents};
-    for (std::string line; std::getline(stream, line);)
-        if (entryName(line) == name(TestSetting::method)) {
-            const auto actual{entry(line)};
-            for (const auto e : EnumIterator<Method, Method::adaptivePassFail,
-                     Method::fixedLevelSyllablesWithAllTargets>{})
-                if (startsWith(actual, name(e)))
-                    return std::make_tuple(e, actual);
-            std::stringstream stream;
-            stream << "Test method not recognized: " << actual;
-            throw std::runtime_error{stream.str()};
-        }
-    throw std::runtime_error{"Test method not found"};
+    const auto *const entry{find(entries, TestSetting::method)};
+    if (entry == nullptr)
+        throw std::runtime_error{"Test method not found"};
+    const auto e{method(entry->value)};
+    if (e == Method::unknown)
+        throw std::runtime_error{
+            "Test method not recognized: " + std::string{entry->value}};
+    return std::make_tuple(e, std::string{entry->value});
 }
 
-static void initialize(AdaptiveTest &test, const std::string &contents,
+static void initialize(AdaptiveTest &test, const TestSettingEntries &entries,
     const std::string &methodName, const TestIdentity &identity,
     SNR startingSnr) {
     test.identity = identity;
     test.startingSnr = startingSnr;
-    applyToEachEntry(
-        [&](auto entryName, auto entry) { assign(test, entryName, entry); },
-        contents);
+    assignEach(test, entries);
     test.ceilingSnr = SessionControllerImpl::ceilingSnr;
     test.floorSnr = SessionControllerImpl::floorSnr;
     test.trackBumpLimit = SessionControllerImpl::trackBumpLimit;
@@ -238,70 +567,69 @@ static void initialize(AdaptiveTest &test, const std::string &contents,
     test.identity.method = methodName;
 }
 
-static void initialize(FixedLevelTest &test, const std::string &contents,
+template <typename T>
+static void initializeFixedLevel(T &test, const TestSettingEntries &entries,
     const std::string &methodName, const TestIdentity &identity,
-    SNR startingSnr,
-    const std::function<void(const std::string &, const std::string &)> &f) {
+    SNR startingSnr) {
     test.snr = startingSnr;
     test.fullScaleLevel = SessionControllerImpl::fullScaleLevel;
     test.identity = identity;
     test.identity.method = methodName;
-    applyToEachEntry(f, contents);
+    assignEach(test, entries);
 }
 
-static void initialize(FixedLevelTest &test, const std::string &contents,
+static void initialize(FixedLevelTest &test, const TestSettingEntries &entries,
     const std::string &method, const TestIdentity &identity, SNR startingSnr) {
-    initialize(test, contents, method, identity, startingSnr,
-        [&](auto entryName, auto entry) { assign(test, entryName, entry); });
+    initializeFixedLevel(test, entries, method, identity, startingSnr);
 }
 
 static void initialize(FixedLevelTestWithEachTargetNTimes &test,
-    const std::string &contents, const std::string &method,
+    const TestSettingEntries &entries, const std::string &method,
     const TestIdentity &identity, SNR startingSnr) {
-    initialize(test, contents, method, identity, startingSnr,
-        [&](auto entryName, auto entry) { assign(test, entryName, entry); });
+    initializeFixedLevel(test, entries, method, identity, startingSnr);
 }
 
-static void initialize(const std::string &method, const std::string &contents,
-    const TestIdentity &identity, SNR startingSnr,
-    const std::function<void(AdaptiveTest &)> &f) {
+static void initialize(const std::string &method,
+    const TestSettingEntries &entries, const TestIdentity &identity,
+    SNR startingSnr, const std::function<void(AdaptiveTest &)> &f) {
     AdaptiveTest test;
     av_speech_in_noise::initialize(
-        test, contents, method, identity, startingSnr);
+        test, entries, method, identity, startingSnr);
     f(test);
 }
 
-static void initialize(const std::string &method, const std::string &contents,
-    const TestIdentity &identity, SNR startingSnr,
-    const std::function<void(FixedLevelTest &)> &f) {
+static void initialize(const std::string &method,
+    const TestSettingEntries &entries, const TestIdentity &identity,
+    SNR startingSnr, const std::function<void(FixedLevelTest &)> &f) {
     FixedLevelTest test;
     av_speech_in_noise::initialize(
-        test, contents, method, identity, startingSnr);
+        test, entries, method, identity, startingSnr);
     f(test);
 }
 
 static void initializeFixedLevelFixedTrialsTest(const std::string &method,
-    const std::string &contents, const TestIdentity &identity, SNR startingSnr,
+    const TestSettingEntries &entries, const TestIdentity &identity,
+    SNR startingSnr,
     const std::function<void(const FixedLevelFixedTrialsTest &)> &f) {
     FixedLevelFixedTrialsTest test;
     av_speech_in_noise::initialize(
-        test, contents, method, identity, startingSnr);
+        test, entries, method, identity, startingSnr);
     f(test);
 }
 
 static void initializeFixedLevelTestWithEachTargetNTimes(
-    const std::string &method, const std::string &contents,
+    const std::string &method, const TestSettingEntries &entries,
     const TestIdentity &identity, SNR startingSnr,
     const std::function<void(const FixedLevelTestWithEachTargetNTimes &)> &f) {
     FixedLevelTestWithEachTargetNTimes test;
     av_speech_in_noise::initialize(
-        test, contents, method, identity, startingSnr);
+        test, entries, method, identity, startingSnr);
     f(test);
 }
 
 static void initialize(AdaptiveMethod &method, const AdaptiveTest &test,
-    TargetPlaylistReader &reader) {
-    method.initialize(test, &reader);
+    TargetPlaylistReader &reader, Track::Factory &trackFactory) {
+    method.initialize(test, &reader, trackFactory);
 }
 
 static void initialize(RunningATest &model, TestMethod &method,
@@ -332,22 +660,35 @@ static auto contains(const std::string_view &s, const std::string &what)
     return s.find(what) != std::string::npos;
 }
 
+auto TestSettingsInterpreterImpl::trackFactory(const AdaptiveTest &test)
+    -> Track::Factory & {
+    return test.trackAlgorithm == TrackAlgorithm::psi ? psiTrackFactory
+                                                      : staircaseTrackFactory;
+}
+
+static void throwOnErrors(const std::vector<std::string> &errors) {
+    if (errors.empty())
+        return;
+    std::string message{"Invalid test settings:"};
+    for (const auto &error : errors)
+        message.append("\n").append(error);
+    throw std::runtime_error{message};
+}
+
 void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
     const TestIdentity &identity, SNR startingSnr) {
-    std::stringstream stream{contents};
+    throwOnErrors(errors(contents));
+    const auto entries{parse(contents).entries};
     auto usingPuzzle = false;
-    for (std::string line; std::getline(stream, line);) {
-        const auto key{entryName(line)};
-        const auto value{entry(line)};
-        if (key == name(TestSetting::puzzle)) {
-            puzzle.initialize(localUrlFromPath(value));
+    for (const auto &entry : entries)
+        if (entry.setting == TestSetting::puzzle) {
+            puzzle.initialize(localUrlFromPath(std::string{entry.value}));
             usingPuzzle = true;
         }
-    }
     freeResponseController.initialize(usingPuzzle);
 
     const auto [method, methodName] =
-        av_speech_in_noise::methodWithName(contents);
+        av_speech_in_noise::methodWithName(entries);
 
     std::vector<std::reference_wrapper<RunningATest::TestObserver>>
         testObservers;
@@ -411,28 +752,28 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
 
     switch (method) {
     case Method::adaptiveCorrectKeywords:
-        av_speech_in_noise::initialize(methodName, contents, identity,
+        av_speech_in_noise::initialize(methodName, entries, identity,
             startingSnr, [&](const AdaptiveTest &test) {
-                av_speech_in_noise::initialize(
-                    adaptiveMethod, test, cyclicTargetsReader);
+                av_speech_in_noise::initialize(adaptiveMethod, test,
+                    cyclicTargetsReader, trackFactory(test));
                 av_speech_in_noise::initialize(
                     runningATest, adaptiveMethod, test, testObservers);
             });
         break;
     case Method::adaptiveCoordinateResponseMeasure:
     case Method::adaptivePassFail:
-        av_speech_in_noise::initialize(methodName, contents, identity,
+        av_speech_in_noise::initialize(methodName, entries, identity,
             startingSnr, [&](AdaptiveTest &test) {
                 test.audioChannelOption = audioChannelOption;
-                av_speech_in_noise::initialize(
-                    adaptiveMethod, test, targetsWithReplacementReader);
+                av_speech_in_noise::initialize(adaptiveMethod, test,
+                    targetsWithReplacementReader, trackFactory(test));
                 av_speech_in_noise::initialize(
                     runningATest, adaptiveMethod, test, testObservers);
             });
         break;
     case Method::fixedLevelCoordinateResponseMeasureWithSilentIntervalTargets:
     case Method::fixedLevelFreeResponseWithSilentIntervalTargets:
-        av_speech_in_noise::initialize(methodName, contents, identity,
+        av_speech_in_noise::initialize(methodName, entries, identity,
             startingSnr, [&](const FixedLevelTest &test) {
                 av_speech_in_noise::initialize(
                     fixedLevelMethod, test, silentIntervalTargets);
@@ -443,7 +784,7 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
     case Method::fixedLevelFreeResponseWithAllTargets:
     case Method::fixedLevelChooseKeywordsWithAllTargets:
     case Method::fixedLevelSyllablesWithAllTargets:
-        av_speech_in_noise::initialize(methodName, contents, identity,
+        av_speech_in_noise::initialize(methodName, entries, identity,
             startingSnr, [&](const FixedLevelTest &test) {
                 av_speech_in_noise::initialize(
                     fixedLevelMethod, test, everyTargetOnce);
@@ -453,7 +794,7 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
         break;
     case Method::fixedLevelConsonants:
         av_speech_in_noise::initializeFixedLevelTestWithEachTargetNTimes(
-            methodName, contents, identity, startingSnr,
+            methodName, entries, identity, startingSnr,
             [&](const FixedLevelTestWithEachTargetNTimes &test) {
                 eachTargetNTimes.setRepeats(test.timesEachTargetIsPlayed - 1);
                 fixedLevelMethod.initialize(test, &eachTargetNTimes);
@@ -465,7 +806,7 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
     case Method::fixedLevelChildEmotionsWithPredeterminedTargets:
     case Method::fixedLevelFreeResponseWithPredeterminedTargets:
     case Method::fixedLevelPassFailWithPredeterminedTargets:
-        av_speech_in_noise::initialize(methodName, contents, identity,
+        av_speech_in_noise::initialize(methodName, entries, identity,
             startingSnr, [&](const FixedLevelTest &test) {
                 av_speech_in_noise::initialize(
                     fixedLevelMethod, test, predeterminedTargets);
@@ -475,7 +816,7 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
         break;
     case Method::fixedLevelButtonResponseWithPredeterminedTargets:
     case Method::fixedLevelButtonThenPassFailResponseWithPredeterminedTargets:
-        av_speech_in_noise::initialize(methodName, contents, identity,
+        av_speech_in_noise::initialize(methodName, entries, identity,
             startingSnr, [&](FixedLevelTest &test) {
                 test.enableVibrotactileStimulus = true;
                 av_speech_in_noise::initialize(
@@ -487,8 +828,10 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
     case Method::fixedLevelFreeResponseWithTargetReplacement:
     case Method::fixedLevelCoordinateResponseMeasureWithTargetReplacement:
         av_speech_in_noise::initializeFixedLevelFixedTrialsTest(methodName,
-            contents, identity, startingSnr,
+            entries, identity, startingSnr,
             [&](const FixedLevelFixedTrialsTest &test) {
+                if (test.compileTrialPlan)
+                    targetsWithReplacement.seed(test.trialPlanSeed);
                 av_speech_in_noise::initialize(
                     fixedLevelMethod, test, targetsWithReplacement);
                 av_speech_in_noise::initialize(
@@ -506,24 +849,75 @@ void TestSettingsInterpreterImpl::initializeTest(const std::string &contents,
 auto TestSettingsInterpreterImpl::calibration(const std::string &contents)
     -> Calibration {
     Calibration calibration;
-    applyToEachEntry([&](auto entryName,
-                         auto entry) { assign(calibration, entryName, entry); },
-        contents);
+    assignEach(calibration, parse(contents).entries);
     calibration.fullScaleLevel = SessionControllerImpl::fullScaleLevel;
     return calibration;
 }
 
 auto TestSettingsInterpreterImpl::meta(const std::string &contents)
     -> std::string {
-    std::stringstream stream{contents};
-    for (std::string line; std::getline(stream, line);)
-        if (entryName(line) == name(TestSetting::meta))
-            return entry(line);
-    return "";
+    const auto entries{parse(contents).entries};
+    const auto *const entry{find(entries, TestSetting::meta)};
+    return entry == nullptr ? "" : std::string{entry->value};
+}
+
+static auto adaptive(Method method) -> bool {
+    switch (method) {
+    case Method::adaptivePassFail:
+    case Method::adaptiveCorrectKeywords:
+    case Method::adaptiveCoordinateResponseMeasure:
+        return true;
+    default:
+        return false;
+    }
+}
+
+auto TestSettingsInterpreterImpl::adaptiveTest(const std::string &contents)
+    -> AdaptiveTest {
+    const auto entries{parse(contents).entries};
+    const auto [method, methodName] =
+        av_speech_in_noise::methodWithName(entries);
+    if (!adaptive(method))
+        throw std::runtime_error{"Test method is not adaptive: " + methodName};
+    AdaptiveTest test;
+    av_speech_in_noise::initialize(test, entries, methodName, {}, SNR{});
+    return test;
+}
+
+auto TestSettingsInterpreterImpl::fixedLevelTest(const std::string &contents)
+    -> FixedLevelTest {
+    const auto entries{parse(contents).entries};
+    const auto [method, methodName] =
+        av_speech_in_noise::methodWithName(entries);
+    if (adaptive(method))
+        throw std::runtime_error{"Test method is adaptive: " + methodName};
+    FixedLevelTest test;
+    av_speech_in_noise::initialize(test, entries, methodName, {}, SNR{});
+    return test;
+}
+
+auto TestSettingsInterpreterImpl::method(const std::string &contents)
+    -> Method {
+    return std::get<Method>(methodWithName(parse(contents).entries));
+}
+
+auto TestSettingsInterpreterImpl::errors(const std::string &contents)
+    -> std::vector<std::string> {
+    auto parsed{parse(contents)};
+    const auto *const methodEntry{find(parsed.entries, TestSetting::method)};
+    if (methodEntry == nullptr)
+        parsed.errors.emplace_back("Test method not found");
+    else if (adaptive(av_speech_in_noise::method(methodEntry->value)) &&
+        (find(parsed.entries, TestSetting::trialPlan) != nullptr ||
+            find(parsed.entries, TestSetting::trialPlanSeed) != nullptr))
+        parsed.errors.emplace_back(
+            "Adaptive methods can't follow a trial plan");
+    return parsed.errors;
 }
 
 TestSettingsInterpreterImpl::TestSettingsInterpreterImpl(
     RunningATest &runningATest, AdaptiveMethod &adaptiveMethod,
+    Track::Factory &staircaseTrackFactory, Track::Factory &psiTrackFactory,
     FixedLevelMethod &fixedLevelMethod, RunningATest::TestObserver &eyeTracking,
     RunningATest::TestObserver &audioRecording,
     TargetPlaylistReader &cyclicTargetsReader,
@@ -532,7 +926,7 @@ TestSettingsInterpreterImpl::TestSettingsInterpreterImpl(
     FiniteTargetPlaylistWithRepeatables &everyTargetOnce,
     FiniteTargetPlaylistWithRepeatables &silentIntervalTargets,
     RepeatableFiniteTargetPlaylist &eachTargetNTimes,
-    TargetPlaylist &targetsWithReplacement,
+    SeedableTargetPlaylist &targetsWithReplacement,
     submitting_free_response::Puzzle &puzzle,
     FreeResponseController &freeResponseController,
     SessionController &sessionController,
@@ -545,7 +939,9 @@ TestSettingsInterpreterImpl::TestSettingsInterpreterImpl(
     TaskPresenter &emotionPresenter, TaskPresenter &childEmotionPresenter,
     TaskPresenter &fixedPassFailPresenter)
     : runningATest{runningATest}, adaptiveMethod{adaptiveMethod},
-      fixedLevelMethod{fixedLevelMethod}, eyeTracking{eyeTracking},
+      staircaseTrackFactory{staircaseTrackFactory},
+      psiTrackFactory{psiTrackFactory}, fixedLevelMethod{fixedLevelMethod},
+      eyeTracking{eyeTracking},
       audioRecording{audioRecording}, cyclicTargetsReader{cyclicTargetsReader},
       targetsWithReplacementReader{targetsWithReplacementReader},
       predeterminedTargets{predeterminedTargets},
@@ -28,21 +28,31 @@
 #include <av-speech-in-noise/core/AdaptiveMethod.hpp>
 #include <av-speech-in-noise/core/FixedLevelMethod.hpp>
 #include <av-speech-in-noise/core/OutputFile.hpp>
+#include <av-speech-in-noise/core/IndexedOutputFile.hpp>
 #include <av-speech-in-noise/core/OutputFilePath.hpp>
 #include <av-speech-in-noise/core/ResponseEvaluator.hpp>
 #include <av-speech-in-noise/core/AdaptiveTrack.hpp>
+#include <av-speech-in-noise/core/PsiTrack.hpp>
 #include <av-speech-in-noise/core/SubmittingFreeResponse.hpp>
 #include <av-speech-in-noise/core/SubmittingPassFail.hpp>
 #include <av-speech-in-noise/core/SubmittingKeywords.hpp>
 #include <av-speech-in-noise/core/SubmittingNumberKeywords.hpp>
 #include <av-speech-in-noise/core/SubmittingSyllable.hpp>
+#include <av-speech-in-noise/core/Tracing.hpp>
 #include <av-speech-in-noise/player/MaskerPlayerImpl.hpp>
 #include <av-speech-in-noise/player/TargetPlayerImpl.hpp>
 #include <av-speech-in-noise/player/AudioReaderSimplified.hpp>
 #include <av-speech-in-noise/playlist/RandomizedTargetPlaylists.hpp>
 #include <av-speech-in-noise/playlist/FileFilterDecorator.hpp>
+#include <av-speech-in-noise/playlist/CachingDirectoryReader.hpp>
 
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
 #include <fstream>
+#include <random>
+#include <thread>
 #include <sstream>
 #include <utility>
 #include <string_view>
@@ -103,6 +113,48 @@ static auto isDirectory(NSString *path) -> bool {
 
 static auto notADirectory(NSString *path) -> bool { return !isDirectory(path); }
 
+static auto directoryIndexPath() -> std::filesystem::path {
+    NSString *caches{NSSearchPathForDirectoriesInDomains(
+        NSCachesDirectory, NSUserDomainMask, YES)
+                         .firstObject};
+    if (caches == nil)
+        return {};
+    const auto directory{
+        std::filesystem::path{string(caches)} / "av-speech-in-noise"};
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    return error ? std::filesystem::path{} : directory / "directory-index";
+}
+
+static auto randomSeed() -> std::uint64_t {
+    std::random_device device;
+    return (std::uint64_t{device()} << 32U) | device();
+}
+
+static auto loadingThreads() -> unsigned {
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+// With AV_SPEECH_IN_NOISE_TRACE set to a file path, tracing is on from
+// launch and each SIGUSR1 (kill -USR1 <pid>) writes the trace so far to
+// that file.
+static void writeTraceOnSignal() {
+    const auto *path{std::getenv("AV_SPEECH_IN_NOISE_TRACE")};
+    if (path == nullptr)
+        return;
+    tracing::enable();
+    std::signal(SIGUSR1, SIG_IGN);
+    static const auto source{dispatch_source_create(
+        DISPATCH_SOURCE_TYPE_SIGNAL, SIGUSR1, 0, dispatch_get_main_queue())};
+    const std::string file{path};
+    dispatch_source_set_event_handler(source, ^(void) {
+      std::ofstream stream{file};
+      tracing::write(stream);
+      NSLog(@"Wrote trace to %s", file.c_str());
+    });
+    dispatch_resume(source);
+}
+
 namespace {
 class MacOsDirectoryReader : public DirectoryReader {
     auto filesIn(const LocalUrl &directory) -> std::vector<LocalUrl> override {
@@ -249,6 +301,7 @@ void initializeAppAndRunEventLoop(EyeTracker &eyeTracker,
     submitting_pass_fail::UI &passFailUI, SubjectPresenter &subjectPresenter,
     KeyableSubjectWindow *subjectNSWindow,
     SessionController::Observer *sessionControllerObserver) {
+    writeTraceOnSignal();
     const auto videoNSView{
         [[NSView alloc] initWithFrame:NSMakeRect(0, 0, 0, 0)]};
     addAutolayoutEnabledSubview(subjectNSWindow.contentView, videoNSView);
@@ -272,16 +325,19 @@ void initializeAppAndRunEventLoop(EyeTracker &eyeTracker,
     static UnixFileSystemPath systemPath;
     static const auto outputFileName{outputFileNameFactory.make(timeStamp)};
     static OutputFilePathImpl outputFilePath{*outputFileName, systemPath};
-    static OutputFileImpl outputFile{fileWriter, outputFilePath};
+    static OutputFileImpl textOutputFile{fileWriter, outputFilePath};
+    static IndexedOutputFile outputFile{textOutputFile};
     NSLog(@"Initializing adaptive method...");
-    static adaptive_track::AdaptiveTrack::Factory snrTrackFactory;
+    static adaptive_track::AdaptiveTrack::Factory staircaseTrackFactory;
+    static PsiTrack::Factory psiTrackFactory;
     static ResponseEvaluatorImpl responseEvaluator;
     static TextFileReaderImpl textFileReader;
     static MersenneTwisterRandomizer randomizer;
-    static AdaptiveMethodImpl adaptiveMethod{
-        snrTrackFactory, responseEvaluator, randomizer};
+    static AdaptiveMethodImpl adaptiveMethod{responseEvaluator, randomizer};
     NSLog(@"Initializing target playlists...");
-    static MacOsDirectoryReader directoryReader;
+    static MacOsDirectoryReader macOsDirectoryReader;
+    static CachingDirectoryReader directoryReader{
+        &macOsDirectoryReader, directoryIndexPath()};
     static FileExtensionFilter targetFileExtensionFilter{
         {".mov", ".avi", ".wav", ".mp4"}};
     static FileFilterDecorator onlyIncludesTargetFileExtensions{
@@ -295,17 +351,27 @@ void initializeAppAndRunEventLoop(EyeTracker &eyeTracker,
     static FileIdentifierFilter targetsThatHave200InTheirName{"200"};
     static FileIdentifierFilter targetsThatHave300InTheirName{"300"};
     static FileIdentifierFilter targetsThatHave400InTheirName{"400"};
+    static FileMatcherPipeline targetsWithoutSilentIntervals{
+        {&targetFileExtensionFilter,
+            &excludesTargetsThatHave100_200_300Or400InTheirName}};
+    static FileMatcherPipeline oneHundred_ms_SilentIntervalTargetFiles{
+        {&targetFileExtensionFilter, &targetsThatHave100InTheirName}};
+    static FileMatcherPipeline twoHundred_ms_SilentIntervalTargetFiles{
+        {&targetFileExtensionFilter, &targetsThatHave200InTheirName}};
+    static FileMatcherPipeline threeHundred_ms_SilentIntervalTargetFiles{
+        {&targetFileExtensionFilter, &targetsThatHave300InTheirName}};
+    static FileMatcherPipeline fourHundred_ms_SilentIntervalTargetFiles{
+        {&targetFileExtensionFilter, &targetsThatHave400InTheirName}};
     static FileFilterDecorator allButSilentIntervalTargets{
-        &onlyIncludesTargetFileExtensions,
-        &excludesTargetsThatHave100_200_300Or400InTheirName};
+        &directoryReader, &targetsWithoutSilentIntervals};
     static FileFilterDecorator oneHundred_ms_SilentIntervalTargets{
-        &onlyIncludesTargetFileExtensions, &targetsThatHave100InTheirName};
+        &directoryReader, &oneHundred_ms_SilentIntervalTargetFiles};
     static FileFilterDecorator twoHundred_ms_SilentIntervalTargets{
-        &onlyIncludesTargetFileExtensions, &targetsThatHave200InTheirName};
+        &directoryReader, &twoHundred_ms_SilentIntervalTargetFiles};
     static FileFilterDecorator threeHundred_ms_SilentIntervalTargets{
-        &onlyIncludesTargetFileExtensions, &targetsThatHave300InTheirName};
+        &directoryReader, &threeHundred_ms_SilentIntervalTargetFiles};
     static FileFilterDecorator fourHundred_ms_SilentIntervalTargets{
-        &onlyIncludesTargetFileExtensions, &targetsThatHave400InTheirName};
+        &directoryReader, &fourHundred_ms_SilentIntervalTargetFiles};
     static RandomSubsetFiles passesThirtyRandomFiles{&randomizer, 30};
     static FileFilterDecorator thirtyRandomAllButSilentIntervalTargets{
         &allButSilentIntervalTargets, &passesThirtyRandomFiles};
@@ -335,25 +401,27 @@ void initializeAppAndRunEventLoop(EyeTracker &eyeTracker,
     static LocalTimeClock localTimeClock;
     NSLog(@"Initializing audio recorder...");
     static AvFoundationAudioRecorder audioRecorder;
-    static RunningATestImpl runningATest{targetPlayer, maskerPlayer,
-        responseEvaluator, outputFile, randomizer, localTimeClock};
+    static RunningATestImpl runningATest{
+        targetPlayer, maskerPlayer, outputFile, randomizer, localTimeClock};
     static RandomizedTargetPlaylistWithReplacement::Factory
         targetsWithReplacementFactory{
-            &onlyIncludesTargetFileExtensions, &randomizer};
+            &onlyIncludesTargetFileExtensions, randomSeed()};
     static SubdirectoryTargetPlaylistReader targetsWithReplacementReader{
-        &targetsWithReplacementFactory, &directoryReader};
+        &targetsWithReplacementFactory, &directoryReader, loadingThreads()};
     static CyclicRandomizedTargetPlaylist::Factory cyclicTargetsFactory{
-        &onlyIncludesTargetFileExtensions, &randomizer};
+        &onlyIncludesTargetFileExtensions, randomSeed()};
     static SubdirectoryTargetPlaylistReader cyclicTargetsReader{
-        &cyclicTargetsFactory, &directoryReader};
+        &cyclicTargetsFactory, &directoryReader, loadingThreads()};
     static MacOsTargetValidator targetValidator;
     static PredeterminedTargetPlaylist predeterminedTargetPlaylist{
         textFileReader, targetValidator};
     NSLog(@"Initializing audio recording...");
     static AudioRecording audioRecording{audioRecorder, outputFile, timeStamp};
     NSLog(@"Initializing eye tracking...");
-    static EyeTracking eyeTracking{
-        eyeTracker, maskerPlayer, targetPlayer, outputFile};
+    static ClockSynchronizationImpl clockSynchronization{
+        eyeTracker, maskerPlayer};
+    static EyeTracking eyeTracking{eyeTracker, maskerPlayer, targetPlayer,
+        outputFile, clockSynchronization};
     NSLog(@"Initializing test setup UI...");
     static const auto testSetupUI{testSetupUIFactory.make(nil)};
     NSLog(@"Initializing consonant UI...");
@@ -522,7 +590,8 @@ void initializeAppAndRunEventLoop(EyeTracker &eyeTracker,
     coordinateResponseMeasureController.attach(
         &coordinateResponseMeasurePresenter);
     static TestSettingsInterpreterImpl testSettingsInterpreter{runningATest,
-        adaptiveMethod, fixedLevelMethod, eyeTracking, audioRecording,
+        adaptiveMethod, staircaseTrackFactory, psiTrackFactory,
+        fixedLevelMethod, eyeTracking, audioRecording,
         cyclicTargetsReader, targetsWithReplacementReader,
         predeterminedTargetPlaylist, everyTargetOnce, silentIntervalTargets,
         allTargetsNTimes, targetsWithReplacement, revealImagePuzzle,
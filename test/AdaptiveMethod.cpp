@@ -10,11 +10,13 @@
 #include <gsl/gsl>
 #include <algorithm>
 #include <functional>
+#include <limits>
 
 namespace av_speech_in_noise {
 static auto operator==(const AdaptiveTestResult &a, const AdaptiveTestResult &b)
     -> bool {
-    return a.targetsUrl.path == b.targetsUrl.path && a.threshold == b.threshold;
+    return a.targetsUrl.path == b.targetsUrl.path &&
+        a.threshold == b.threshold && a.stoppingReason == b.stoppingReason;
 }
 
 namespace {
@@ -25,21 +27,23 @@ class UseCase {
 };
 
 void initialize(AdaptiveMethodImpl &method, const AdaptiveTest &test,
-    TargetPlaylistReader &targetListReader) {
-    method.initialize(test, &targetListReader);
+    TargetPlaylistReader &targetListReader, Track::Factory &trackFactory) {
+    method.initialize(test, &targetListReader, trackFactory);
 }
 
 class Initializing : public UseCase {
   public:
-    explicit Initializing(TargetPlaylistReader &reader) : reader{reader} {}
+    Initializing(TargetPlaylistReader &reader, Track::Factory &trackFactory)
+        : reader{reader}, trackFactory{trackFactory} {}
 
     void run(AdaptiveMethodImpl &method) override {
-        initialize(method, test, reader);
+        initialize(method, test, reader, trackFactory);
     }
 
   private:
     AdaptiveTest test{};
     TargetPlaylistReader &reader;
+    Track::Factory &trackFactory;
 };
 
 void submit(AdaptiveMethodImpl &method,
@@ -385,10 +389,10 @@ class AdaptiveMethodTests : public ::testing::Test {
     TrackFactoryStub snrTrackFactory;
     ResponseEvaluatorStub evaluator;
     RandomizerStub randomizer;
-    AdaptiveMethodImpl method{snrTrackFactory, evaluator, randomizer};
+    AdaptiveMethodImpl method{evaluator, randomizer};
     OutputFileStub outputFile;
     TargetPlaylistSetReaderStub targetListReader;
-    Initializing initializing{targetListReader};
+    Initializing initializing{targetListReader, snrTrackFactory};
     SubmittingCoordinateResponse submittingCoordinateResponse;
     SubmittingCorrectCoordinateResponse submittingCorrectCoordinateResponse{
         evaluator};
@@ -422,7 +426,7 @@ class AdaptiveMethodTests : public ::testing::Test {
   public:
     void assertWritesUpdatedReversals(WritingResponseUseCase &useCase) {
         selectNextList(randomizer, 1);
-        initialize(method, test, targetListReader);
+        initialize(method, test, targetListReader, snrTrackFactory);
         at(tracks, 1)->setReversalsWhenUpdated(3);
         selectNextList(randomizer, 2);
         run(useCase);
@@ -431,7 +435,7 @@ class AdaptiveMethodTests : public ::testing::Test {
 
     void assertWritesPreUpdatedSnr(WritingResponseUseCase &useCase) {
         selectNextList(randomizer, 1);
-        initialize(method, test, targetListReader);
+        initialize(method, test, targetListReader, snrTrackFactory);
         at(tracks, 1)->setX(4);
         at(tracks, 1)->setXWhenUpdated(3);
         selectNextList(randomizer, 2);
@@ -456,7 +460,9 @@ class AdaptiveMethodTests : public ::testing::Test {
     void run(UseCase &useCase) { useCase.run(method); }
 
     void assertSelectsListInRangeAfterRemovingCompleteTracks(UseCase &useCase) {
-        initialize(method, test, targetListReader);
+        selectNextList(randomizer, 2);
+        initialize(method, test, targetListReader, snrTrackFactory);
+        selectNextList(randomizer, 0);
         setComplete(tracks, 2);
         run(useCase);
         assertPassedIntegerBounds(randomizer, 0, 1);
@@ -472,7 +478,7 @@ class AdaptiveMethodTests : public ::testing::Test {
 
     void assertPushesSnrTrackDown(UseCase &useCase) {
         selectNextList(randomizer, 1);
-        initialize(method, test, targetListReader);
+        initialize(method, test, targetListReader, snrTrackFactory);
         selectNextList(randomizer, 2);
         run(useCase);
         AV_SPEECH_IN_NOISE_EXPECT_TRUE(pushedDown(tracks, 1));
@@ -481,7 +487,7 @@ class AdaptiveMethodTests : public ::testing::Test {
 
     void assertPushesSnrTrackUp(UseCase &useCase) {
         selectNextList(randomizer, 1);
-        initialize(method, test, targetListReader);
+        initialize(method, test, targetListReader, snrTrackFactory);
         selectNextList(randomizer, 2);
         run(useCase);
         AV_SPEECH_IN_NOISE_EXPECT_FALSE(pushedDown(tracks, 1));
@@ -489,7 +495,7 @@ class AdaptiveMethodTests : public ::testing::Test {
     }
 
     void assertSelectsListAmongThoseWithIncompleteTracks(UseCase &useCase) {
-        initialize(method, test, targetListReader);
+        initialize(method, test, targetListReader, snrTrackFactory);
         setNext(targetLists, 2, "a");
         setComplete(tracks, 1);
         selectNextList(randomizer, 1);
@@ -498,64 +504,74 @@ class AdaptiveMethodTests : public ::testing::Test {
     }
 
     void assertWritesTarget(WritingTargetUseCase &useCase) {
-        initialize(method, test, targetListReader);
-        evaluator.setFileName("a");
-        run(useCase);
-        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-            std::string{"a"}, useCase.target(outputFile));
-    }
-
-    void assertPassesCurrentTargetToEvaluatorForFileName(UseCase &useCase) {
         selectNextList(randomizer, 1);
-        initialize(method, test, targetListReader);
-        setCurrent(targetLists, 1, "a");
+        setCurrent(targetLists, 1, "b/a.wav");
+        initialize(method, test, targetListReader, snrTrackFactory);
         selectNextList(randomizer, 2);
         run(useCase);
         AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-            std::string{"a"}, evaluator.filePathForFileName());
+            std::string{"a.wav"}, useCase.target(outputFile));
     }
 };
 
 #define ADAPTIVE_METHOD_TEST(a) TEST_F(AdaptiveMethodTests, a)
 
 ADAPTIVE_METHOD_TEST(initializeCreatesSnrTrackForEachList) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
         std::size_t{3}, settings(snrTrackFactory).size());
 }
 
+ADAPTIVE_METHOD_TEST(initializeWithoutListsCompletesTest) {
+    initialize(method, test, targetListReader, snrTrackFactory);
+    targetListReader.setTargetPlaylists({});
+    initialize(method, test, targetListReader, snrTrackFactory);
+    assertComplete(method);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(method.testResults().empty());
+}
+
 ADAPTIVE_METHOD_TEST(initializeCreatesEachSnrTrackWithTargetLevelRule) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     forEachSettings(snrTrackFactory,
         [&](auto s) { assertTargetLevelRuleEquals(test.trackingRule, s); });
 }
 
 ADAPTIVE_METHOD_TEST(initializeCreatesEachSnrTrackWithSnr) {
     test.startingSnr.dB = 1;
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     forEachSettings(snrTrackFactory, assertStartingXEqualsOne);
 }
 
 ADAPTIVE_METHOD_TEST(initializeCreatesEachSnrTrackWithCeiling) {
     test.ceilingSnr.dB = 1;
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     forEachSettings(snrTrackFactory, assertCeilingEqualsOne);
 }
 
 ADAPTIVE_METHOD_TEST(initializeCreatesEachSnrTrackWithFloor) {
     test.floorSnr.dB = 1;
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     forEachSettings(snrTrackFactory, assertFloorEqualsOne);
 }
 
 ADAPTIVE_METHOD_TEST(initializeCreatesEachSnrTrackWithBumpLimit) {
     test.trackBumpLimit = 1;
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     forEachSettings(snrTrackFactory, assertBumpLimitEqualsOne);
 }
 
+ADAPTIVE_METHOD_TEST(initializeCreatesEachSnrTrackWithConvergenceRule) {
+    test.convergenceReversals = 6;
+    test.convergenceStandardErrorDb = 0.5;
+    initialize(method, test, targetListReader, snrTrackFactory);
+    forEachSettings(snrTrackFactory, [](const Track::Settings &s) {
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(6, s.convergenceReversals);
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0.5, s.convergenceStandardErrorDb);
+    });
+}
+
 ADAPTIVE_METHOD_TEST(writeTestParametersPassesToOutputFile) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     method.writeTestingParameters(outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
         &std::as_const(test), outputFile.adaptiveTest());
@@ -563,7 +579,7 @@ ADAPTIVE_METHOD_TEST(writeTestParametersPassesToOutputFile) {
 
 ADAPTIVE_METHOD_TEST(initializePassesTargetPlaylistDirectory) {
     test.targetsUrl.path = "a";
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
         std::string{"a"}, targetListReader.directory());
 }
@@ -573,32 +589,32 @@ ADAPTIVE_METHOD_TEST(nextReturnsNextFilePathAfterInitialize) {
 }
 
 ADAPTIVE_METHOD_TEST(nextReturnsNextFilePathAfterCoordinateResponse) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     assertNextTargetEqualsNextFromSelectedTargetPlaylistAfter(
         submittingCoordinateResponse);
 }
 
 ADAPTIVE_METHOD_TEST(nextReturnsNextFilePathAfterCorrectResponse) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     assertNextTargetEqualsNextFromSelectedTargetPlaylistAfter(
         submittingCorrectResponse);
 }
 
 ADAPTIVE_METHOD_TEST(nextReturnsNextFilePathAfterIncorrectResponse) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     assertNextTargetEqualsNextFromSelectedTargetPlaylistAfter(
         submittingIncorrectResponse);
 }
 
 ADAPTIVE_METHOD_TEST(nextReturnsNextFilePathAfterCorrectKeywords) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     assertNextTargetEqualsNextFromSelectedTargetPlaylistAfter(
         submittingCorrectKeywords);
 }
 
 ADAPTIVE_METHOD_TEST(
     randomizerPassedIntegerBoundsOfListsForSelectingListInRange) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     assertPassedIntegerBounds(randomizer, 0, 2);
 }
 
@@ -627,7 +643,7 @@ ADAPTIVE_METHOD_TEST(
 }
 
 ADAPTIVE_METHOD_TEST(resetTracksResetsEachTrack) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     resetTracks(method);
     for (auto &track : tracks)
         AV_SPEECH_IN_NOISE_EXPECT_TRUE(track->resetted());
@@ -636,41 +652,41 @@ ADAPTIVE_METHOD_TEST(resetTracksResetsEachTrack) {
 ADAPTIVE_METHOD_TEST(snrReturnsThatOfCurrentTrack) {
     at(tracks, 0)->setX(1);
     selectNextList(randomizer, 0);
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, method.snr().dB);
 }
 
-ADAPTIVE_METHOD_TEST(submitCoordinateResponsePassesCurrentTargetToEvaluator) {
+ADAPTIVE_METHOD_TEST(submitCoordinateResponsePassesTargetStemToEvaluator) {
     selectNextList(randomizer, 1);
-    initialize(method, test, targetListReader);
-    setCurrent(targetLists, 1, "a");
+    setCurrent(targetLists, 1, "b/a.wav");
+    initialize(method, test, targetListReader, snrTrackFactory);
     selectNextList(randomizer, 2);
     submit(method, coordinateResponse);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.correctColorFilePath());
+        std::string{"a"}, evaluator.correctColorStem());
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.correctNumberFilePath());
+        std::string{"a"}, evaluator.correctNumberStem());
 }
 
-ADAPTIVE_METHOD_TEST(submitCoordinateResponsePassesCorrectFilePathToEvaluator) {
+ADAPTIVE_METHOD_TEST(submitCoordinateResponsePassesStemToEvaluator) {
     selectNextList(randomizer, 1);
-    initialize(method, test, targetListReader);
-    setCurrent(targetLists, 1, "a");
+    setCurrent(targetLists, 1, "b/a.wav");
+    initialize(method, test, targetListReader, snrTrackFactory);
     selectNextList(randomizer, 2);
     submit(method, coordinateResponse);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.correctFilePath());
+        std::string{"a"}, evaluator.correctStem());
 }
 
 ADAPTIVE_METHOD_TEST(submitCoordinateResponsePassesResponseToEvaluator) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     submit(method, coordinateResponse);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
         &std::as_const(coordinateResponse), evaluator.response());
 }
 
 ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesSubjectColor) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     coordinateResponse.color = blue;
     write(method, coordinateResponse, outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
@@ -678,7 +694,7 @@ ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesSubjectColor) {
 }
 
 ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesCorrectColor) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     evaluator.setCorrectColor(blue);
     write(method, coordinateResponse, outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
@@ -686,7 +702,7 @@ ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesCorrectColor) {
 }
 
 ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesSubjectNumber) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     coordinateResponse.number = 1;
     write(method, coordinateResponse, outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
@@ -694,7 +710,7 @@ ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesSubjectNumber) {
 }
 
 ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesCorrectNumber) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     evaluator.setCorrectNumber(1);
     write(method, coordinateResponse, outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
@@ -702,7 +718,7 @@ ADAPTIVE_METHOD_TEST(writeCoordinateResponsePassesCorrectNumber) {
 }
 
 ADAPTIVE_METHOD_TEST(writeCorrectKeywordsPassesCorrectKeywords) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     correctKeywords.count = 1;
     method.submit(correctKeywords);
     method.writeLastCorrectKeywords(outputFile);
@@ -742,42 +758,42 @@ ADAPTIVE_METHOD_TEST(writeCorrectKeywordsPassesSnrBeforeUpdatingTrack) {
 }
 
 ADAPTIVE_METHOD_TEST(writeCorrectCoordinateResponseIsCorrect) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     setCorrectCoordinateResponse();
     write(method, coordinateResponse, outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_TRUE(coordinateResponseTrialCorrect(outputFile));
 }
 
 ADAPTIVE_METHOD_TEST(writeCorrectResponseIsCorrect) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     submitCorrectResponse(method);
     method.writeLastCorrectResponse(outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_TRUE(outputFile.openSetAdaptiveTrial().correct);
 }
 
 ADAPTIVE_METHOD_TEST(writeSufficientCorrectKeywordsIsCorrect) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     run(submittingSufficientCorrectKeywords);
     method.writeLastCorrectKeywords(outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_TRUE(correctKeywordsTrial(outputFile).correct);
 }
 
 ADAPTIVE_METHOD_TEST(writeIncorrectCoordinateResponseIsIncorrect) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     setIncorrectCoordinateResponse();
     write(method, coordinateResponse, outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_FALSE(coordinateResponseTrialCorrect(outputFile));
 }
 
 ADAPTIVE_METHOD_TEST(writeIncorrectResponseIsIncorrect) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     submitIncorrectResponse(method);
     method.writeLastIncorrectResponse(outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_FALSE(outputFile.openSetAdaptiveTrial().correct);
 }
 
 ADAPTIVE_METHOD_TEST(writeInsufficientCorrectKeywordsIsIncorrect) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     run(submittingInsufficientCorrectKeywords);
     method.writeLastCorrectKeywords(outputFile);
     AV_SPEECH_IN_NOISE_EXPECT_FALSE(correctKeywordsTrial(outputFile).correct);
@@ -796,7 +812,7 @@ ADAPTIVE_METHOD_TEST(writeCorrectKeywordsWritesTarget) {
 }
 
 ADAPTIVE_METHOD_TEST(writeTestResult) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     at(tracks, 0)->setThreshold(11.);
     targetLists.at(0)->setDirectory("a");
     at(tracks, 1)->setThreshold(22.);
@@ -819,7 +835,7 @@ ADAPTIVE_METHOD_TEST(writeTestResult) {
 }
 
 ADAPTIVE_METHOD_TEST(testResults) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     at(tracks, 0)->setThreshold(11.);
     targetLists.at(0)->setDirectory("a");
     at(tracks, 1)->setThreshold(22.);
@@ -830,26 +846,47 @@ ADAPTIVE_METHOD_TEST(testResults) {
         {{{"a"}, 11.}, {{"b"}, 22.}, {{"c"}, 33.}}, method.testResults());
 }
 
-ADAPTIVE_METHOD_TEST(writeTestResultPassThresholdReversals) {
-    test.thresholdReversals = 1;
-    initialize(method, test, targetListReader);
-    method.writeTestResult(outputFile);
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, at(tracks, 0)->thresholdReversals());
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, at(tracks, 1)->thresholdReversals());
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, at(tracks, 2)->thresholdReversals());
+ADAPTIVE_METHOD_TEST(testResultsIncludeThresholdStandardDeviation) {
+    initialize(method, test, targetListReader, snrTrackFactory);
+    at(tracks, 1)->setThresholdStandardDeviation(1.5);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        1.5, method.testResults().at(1).thresholdStandardDeviation);
 }
 
-ADAPTIVE_METHOD_TEST(submitCorrectResponsePassesCurrentToEvaluator) {
-    assertPassesCurrentTargetToEvaluatorForFileName(submittingCorrectResponse);
+ADAPTIVE_METHOD_TEST(testResultsIncludeStoppingReason) {
+    initialize(method, test, targetListReader, snrTrackFactory);
+    at(tracks, 1)->setStoppingReason(TrackStoppingReason::converged);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(TrackStoppingReason::converged,
+        method.testResults().at(1).stoppingReason);
 }
 
-ADAPTIVE_METHOD_TEST(submitIncorrectResponsePassesCurrentToEvaluator) {
-    assertPassesCurrentTargetToEvaluatorForFileName(
-        submittingIncorrectResponse);
+ADAPTIVE_METHOD_TEST(currentTrackResultIsOfSelectedTrack) {
+    selectNextList(randomizer, 1);
+    initialize(method, test, targetListReader, snrTrackFactory);
+    at(tracks, 1)->setThreshold(22.);
+    at(tracks, 1)->setThresholdStandardDeviation(1.5);
+    targetLists.at(1)->setDirectory("b");
+    const auto result{method.currentTrackResult()};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(result.has_value());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"b"}, result->targetsUrl.path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(22., result->threshold);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1.5, result->thresholdStandardDeviation);
 }
 
-ADAPTIVE_METHOD_TEST(submitCorrectKeywordsPassesCurrentToEvaluator) {
-    assertPassesCurrentTargetToEvaluatorForFileName(submittingCorrectKeywords);
+ADAPTIVE_METHOD_TEST(noCurrentTrackResultWithoutThreshold) {
+    selectNextList(randomizer, 1);
+    initialize(method, test, targetListReader, snrTrackFactory);
+    at(tracks, 1)->setThreshold(std::numeric_limits<double>::quiet_NaN());
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(method.currentTrackResult().has_value());
+}
+
+ADAPTIVE_METHOD_TEST(writeTestResultPassThresholdReversals) {
+    test.thresholdReversals = 1;
+    initialize(method, test, targetListReader, snrTrackFactory);
+    method.writeTestResult(outputFile);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, at(tracks, 0)->thresholdReversals());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, at(tracks, 1)->thresholdReversals());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, at(tracks, 2)->thresholdReversals());
 }
 
 ADAPTIVE_METHOD_TEST(submitCorrectCoordinateResponsePushesSnrTrackDown) {
@@ -879,10 +916,11 @@ ADAPTIVE_METHOD_TEST(submitInsufficientCorrectKeywordsPushesSnrTrackDown) {
 ADAPTIVE_METHOD_TEST(resettingTracksSelectsListAmongThoseWithIncompleteTracks) {
     setComplete(tracks, 0);
     at(tracks, 0)->incompleteOnReset();
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     setNext(targetLists, 0, "a");
     setComplete(tracks, 1);
-    selectNextList(randomizer, 1);
+    setComplete(tracks, 2);
+    selectNextList(randomizer, 0);
     method.resetTracks();
     assertNextTargetEquals(method, "a");
 }
@@ -910,7 +948,7 @@ ADAPTIVE_METHOD_TEST(
 }
 
 ADAPTIVE_METHOD_TEST(completeWhenAllTracksComplete) {
-    initialize(method, test, targetListReader);
+    initialize(method, test, targetListReader, snrTrackFactory);
     setComplete(tracks, 0);
     assertTestIncompleteAfterCoordinateResponse();
     setComplete(tracks, 1);
@@ -918,5 +956,62 @@ ADAPTIVE_METHOD_TEST(completeWhenAllTracksComplete) {
     setComplete(tracks, 2);
     assertTestCompleteAfterCoordinateResponse();
 }
+
+ADAPTIVE_METHOD_TEST(roundRobinSelectsListsInTurn) {
+    test.trackSelection = TrackSelection::roundRobin;
+    setNext(targetLists, 0, "a");
+    setNext(targetLists, 1, "b");
+    setNext(targetLists, 2, "c");
+    initialize(method, test, targetListReader, snrTrackFactory);
+    assertNextTargetEquals(method, "a");
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "b");
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "c");
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "a");
+}
+
+ADAPTIVE_METHOD_TEST(roundRobinSkipsListsWithCompleteTracks) {
+    test.trackSelection = TrackSelection::roundRobin;
+    setNext(targetLists, 2, "c");
+    initialize(method, test, targetListReader, snrTrackFactory);
+    setComplete(tracks, 1);
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "c");
+}
+
+ADAPTIVE_METHOD_TEST(leastPresentedSelectsListPresentedFewestTimes) {
+    test.trackSelection = TrackSelection::leastPresented;
+    setNext(targetLists, 0, "a");
+    setNext(targetLists, 1, "b");
+    setNext(targetLists, 2, "c");
+    initialize(method, test, targetListReader, snrTrackFactory);
+    run(submittingCorrectResponse);
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "c");
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "a");
+}
+
+ADAPTIVE_METHOD_TEST(leastPresentedSkipsListsWithCompleteTracks) {
+    test.trackSelection = TrackSelection::leastPresented;
+    setNext(targetLists, 2, "c");
+    initialize(method, test, targetListReader, snrTrackFactory);
+    setComplete(tracks, 0);
+    setComplete(tracks, 1);
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "c");
+}
+
+ADAPTIVE_METHOD_TEST(selectsListsAsTheTestSpecifiedWhenInitialized) {
+    test.trackSelection = TrackSelection::roundRobin;
+    setNext(targetLists, 0, "a");
+    setNext(targetLists, 1, "b");
+    initialize(method, test, targetListReader, snrTrackFactory);
+    test.trackSelection = TrackSelection::random;
+    run(submittingCorrectResponse);
+    assertNextTargetEquals(method, "b");
+}
 }
 }
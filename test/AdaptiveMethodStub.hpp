@@ -6,17 +6,27 @@
 namespace av_speech_in_noise {
 class AdaptiveMethodStub : public AdaptiveMethod {
   public:
-    void initialize(
-        const AdaptiveTest &t, TargetPlaylistReader *reader) override {
+    void initialize(const AdaptiveTest &t, TargetPlaylistReader *reader,
+        Track::Factory &factory) override {
         test = t;
         targetListReader = reader;
+        trackFactory = &factory;
     }
     auto testResults() -> AdaptiveTestResults override { return testResults_; }
+    auto currentTrackResult() -> std::optional<AdaptiveTestResult> override {
+        return currentTrackResult_;
+    }
     void resetTracks() override { tracksResetted = true; }
     auto complete() -> bool override { return {}; }
     auto nextTarget() -> LocalUrl override { return {}; }
     auto currentTarget() -> LocalUrl override { return {}; }
+    auto currentTargetFileName() -> std::string_view override { return {}; }
+    auto currentTargetStem() -> std::string_view override { return {}; }
     auto snr() -> SNR override { return SNR{}; }
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return std::nullopt;
+    }
+    auto trialPlan() -> const TrialPlan * override { return nullptr; }
     void submitCorrectResponse() override {}
     void submitIncorrectResponse() override {}
     void submit(const CorrectKeywords &) override {}
@@ -29,8 +39,10 @@ class AdaptiveMethodStub : public AdaptiveMethod {
     void submit(const coordinate_response_measure::Response &) override {}
 
     AdaptiveTestResults testResults_;
+    std::optional<AdaptiveTestResult> currentTrackResult_;
     AdaptiveTest test{};
     TargetPlaylistReader *targetListReader{};
+    Track::Factory *trackFactory{};
     bool tracksResetted{};
 };
 }
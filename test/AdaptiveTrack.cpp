@@ -329,6 +329,61 @@ ADAPTIVE_TRACK_TEST(incompleteIfPushedDownBumpLimitNonconsecutiveTimesAtFloor) {
     assertIncomplete(track);
 }
 
+ADAPTIVE_TRACK_TEST(stoppingReasonBumpLimit) {
+    setStartingX(-5);
+    setFloor(-5);
+    setBumpLimit(2);
+    auto track{construct(settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        av_speech_in_noise::TrackStoppingReason::none, track.stoppingReason());
+    update(track, "dd");
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        av_speech_in_noise::TrackStoppingReason::reachedBumpLimit,
+        track.stoppingReason());
+}
+
+ADAPTIVE_TRACK_TEST(stoppingReasonCompletedRule) {
+    setFirstSequenceRunCount(1);
+    setFirstSequenceUp(1);
+    setFirstSequenceDown(1);
+    auto track{construct(settings)};
+    update(track, "du");
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        av_speech_in_noise::TrackStoppingReason::completedRule,
+        track.stoppingReason());
+}
+
+ADAPTIVE_TRACK_TEST(completeWhenLastReversalsConverge) {
+    setStartingX(0);
+    setFirstSequenceRunCount(20);
+    setFirstSequenceStepSize(2);
+    setFirstSequenceUp(1);
+    setFirstSequenceDown(1);
+    settings.convergenceReversals = 4;
+    settings.convergenceStandardErrorDb = 0.6;
+    auto track{construct(settings)};
+    update(track, "dudu");
+    assertIncomplete(track);
+    down(track);
+    assertComplete(track);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        av_speech_in_noise::TrackStoppingReason::converged,
+        track.stoppingReason());
+}
+
+ADAPTIVE_TRACK_TEST(incompleteWhileLastReversalsVaryTooMuch) {
+    setStartingX(0);
+    setFirstSequenceRunCount(20);
+    setFirstSequenceStepSize(2);
+    setFirstSequenceUp(1);
+    setFirstSequenceDown(1);
+    settings.convergenceReversals = 4;
+    settings.convergenceStandardErrorDb = 0.5;
+    auto track{construct(settings)};
+    update(track, "dududu");
+    assertIncomplete(track);
+}
+
 ADAPTIVE_TRACK_TEST(incompleteIfPushedUpBumpLimitNonconsecutiveTimesAtCeiling) {
     setStartingX(5);
     setCeiling(5);
@@ -415,6 +470,57 @@ ADAPTIVE_TRACK_TEST(thresholdNegativeReversals) {
     AV_SPEECH_IN_NOISE_EXPECT_TRUE(std::isnan(track.threshold(-1)));
 }
 
+ADAPTIVE_TRACK_TEST(thresholdStandardDeviation) {
+    setStartingX(0);
+    setFirstSequenceRunCount(7);
+    setFirstSequenceStepSize(3);
+    setFirstSequenceDown(2);
+    setFirstSequenceUp(1);
+    auto track{construct(settings)};
+    update(track, "dduudduuuudddduddddu");
+    assertEqual(std::sqrt(45 / 3.), track.thresholdStandardDeviation(4), 1e-12);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        std::isnan(track.thresholdStandardDeviation(1)));
+}
+
+ADAPTIVE_TRACK_TEST(currentRunStatistics) {
+    setStartingX(0);
+    setFirstSequenceRunCount(2);
+    setFirstSequenceStepSize(4);
+    setFirstSequenceDown(1);
+    setFirstSequenceUp(1);
+    secondSequence().runCount = 3;
+    secondSequence().stepSize = 2;
+    secondSequence().down = 1;
+    secondSequence().up = 1;
+    auto track{construct(settings)};
+    update(track, "dud");
+    auto run{track.currentRun()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, run.stepSize);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, run.reversals);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(3, run.reversalsRemaining);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(std::isnan(run.mean));
+    update(track, "ud");
+    run = track.currentRun();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, run.reversals);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, run.reversalsRemaining);
+    assertEqual(-1., run.mean, 1e-12);
+    assertEqual(std::sqrt(2.), run.standardDeviation, 1e-12);
+}
+
+ADAPTIVE_TRACK_TEST(resetClearsThresholdReversals) {
+    setStartingX(0);
+    setFirstSequenceRunCount(4);
+    setFirstSequenceStepSize(3);
+    setFirstSequenceDown(1);
+    setFirstSequenceUp(1);
+    auto track{construct(settings)};
+    update(track, "ddduuu");
+    reset(track);
+    update(track, "du");
+    assertThresholdEquals(track, 4, -3);
+}
+
 // https://doi.org/10.1121/1.1912375
 ADAPTIVE_TRACK_TEST(LevittFigure4) {
     setStartingX(0);
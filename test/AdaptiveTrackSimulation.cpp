@@ -0,0 +1,106 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/AdaptiveTrack.hpp>
+#include <av-speech-in-noise/core/AdaptiveTrackSimulation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace av_speech_in_noise {
+namespace {
+class AdaptiveTrackSimulationTests : public ::testing::Test {
+  protected:
+    adaptive_track::AdaptiveTrack::Factory factory;
+    AdaptiveTrackSimulationSettings settings;
+
+    AdaptiveTrackSimulationTests() {
+        settings.test.trackingRule = {{2, 4, 2, 1}, {8, 2, 2, 1}};
+        settings.test.startingSnr.dB = 0;
+        settings.test.ceilingSnr.dB = 20;
+        settings.test.floorSnr.dB = -40;
+        settings.test.trackBumpLimit = 10;
+        settings.test.thresholdReversals = 6;
+        settings.listener.threshold = -10;
+        settings.tracks = 3000;
+    }
+};
+
+#define ADAPTIVE_TRACK_SIMULATION_TEST(a)                                      \
+    TEST_F(AdaptiveTrackSimulationTests, a)
+
+ADAPTIVE_TRACK_SIMULATION_TEST(probabilityCorrectIsHalfwayAtThreshold) {
+    PsychometricFunction f;
+    f.threshold = 3;
+    f.guessRate = 0.25;
+    f.lapseRate = 0.05;
+    assertEqual(0.25 + 0.7 / 2, probabilityCorrect(f, 3), 1e-12);
+    assertEqual(0.95, probabilityCorrect(f, 1000), 1e-12);
+    assertEqual(0.25, probabilityCorrect(f, -1000), 1e-12);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(oneUpTwoDownConvergesNearSeventyOnePercent) {
+    PsychometricFunction f;
+    f.threshold = -10;
+    const auto level{convergenceLevel(f, {1, 2, 2, 1})};
+    assertEqual(std::sqrt(0.5), probabilityCorrect(f, level), 1e-9);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(convergenceLevelIsNaNWhenUnreachable) {
+    PsychometricFunction f;
+    f.guessRate = 0.8;
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        std::isnan(convergenceLevel(f, {1, 2, 2, 1})));
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(resultsDoNotDependOnThreadCount) {
+    settings.threads = 1;
+    const auto one{simulate(factory, settings)};
+    settings.threads = 4;
+    const auto four{simulate(factory, settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(one.meanThreshold, four.meanThreshold);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        one.thresholdVariance, four.thresholdVariance);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(one.meanTrials, four.meanTrials);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(one.maximumTrials, four.maximumTrials);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(differentSeedsGiveDifferentResults) {
+    const auto first{simulate(factory, settings)};
+    settings.seed = 1;
+    const auto second{simulate(factory, settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        first.meanThreshold != second.meanThreshold);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(thresholdsConvergeForSteepListener) {
+    settings.listener.slope = 2;
+    const auto result{simulate(factory, settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{0}, result.incompleteTracks);
+    assertEqual(0., result.bias, 1.);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(result.thresholdVariance > 0);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(biasIsAgainstConvergenceLevelByDefault) {
+    const auto result{simulate(factory, settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        result.convergenceLevel, result.expectedThreshold);
+    assertEqual(result.meanThreshold - result.convergenceLevel, result.bias,
+        1e-12);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(biasIsAgainstListenerThresholdWhenEstimated) {
+    settings.estimates = SimulatedThreshold::listenerThreshold;
+    const auto result{simulate(factory, settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(-10., result.expectedThreshold);
+    assertEqual(result.meanThreshold + 10, result.bias, 1e-12);
+}
+
+ADAPTIVE_TRACK_SIMULATION_TEST(countsTracksCutShortAsIncomplete) {
+    settings.maximumTrialsPerTrack = 3;
+    const auto result{simulate(factory, settings)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(settings.tracks, result.incompleteTracks);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(3, result.maximumTrials);
+}
+}
+}
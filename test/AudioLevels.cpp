@@ -0,0 +1,41 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/player/AudioLevels.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+namespace av_speech_in_noise {
+namespace {
+class AudioLevelsTests : public ::testing::Test {};
+
+#define AUDIO_LEVELS_TEST(a) TEST_F(AudioLevelsTests, a)
+
+AUDIO_LEVELS_TEST(rmsIsOfFirstChannel) {
+    const auto actual{levels({{0.5F, -0.5F}, {1, 1}})};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(20 * std::log10(0.5), actual.rms.dBov);
+}
+
+AUDIO_LEVELS_TEST(peakIsLargestMagnitudeOfAnyChannel) {
+    const auto actual{levels({{0.5F, -0.25F}, {0.125F, -1}})};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0., actual.peak.dBov);
+}
+
+AUDIO_LEVELS_TEST(silenceIsMinusInfinity) {
+    const auto actual{levels({{0, 0}})};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        -std::numeric_limits<double>::infinity(), actual.rms.dBov);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        -std::numeric_limits<double>::infinity(), levels({}).peak.dBov);
+}
+
+AUDIO_LEVELS_TEST(headroomIsNegativeWhenAmplifiedPeakClips) {
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        3., headroom(DigitalLevel{-10}, LevelAmplification{7}));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        -2., headroom(DigitalLevel{-10}, LevelAmplification{12}));
+}
+}
+}
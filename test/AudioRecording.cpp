@@ -20,7 +20,9 @@ class AudioRecordingTests : public ::testing::Test {
 
 AUDIO_RECORDING_TEST(initializesRecorderWhenTrialWillBegin) {
     outputFile.setParentPath("/Users/user/data");
-    audioRecording.notifyThatNewTestIsReady("smile");
+    av_speech_in_noise::Test test;
+    test.identity.session = "smile";
+    audioRecording.notifyThatNewTestIsReady(test);
     timeStamp.setYear(1);
     timeStamp.setMonth(2);
     timeStamp.setDayOfMonth(7);
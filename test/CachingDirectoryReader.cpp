@@ -0,0 +1,138 @@
+#include "TemporaryDirectory.hpp"
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/playlist/CachingDirectoryReader.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace av_speech_in_noise {
+static auto operator==(const LocalUrl &a, const LocalUrl &b) -> bool {
+    return a.path == b.path;
+}
+
+namespace {
+class CountingDirectoryReader : public DirectoryReader {
+  public:
+    auto filesIn(const LocalUrl &) -> LocalUrls override {
+        ++filesListed;
+        return files;
+    }
+
+    auto subDirectories(const LocalUrl &) -> LocalUrls override {
+        ++subDirectoriesListed;
+        return subDirectories_;
+    }
+
+    LocalUrls files;
+    LocalUrls subDirectories_;
+    int filesListed{};
+    int subDirectoriesListed{};
+};
+
+class CachingDirectoryReaderTests : public ::testing::Test {
+  protected:
+    std::filesystem::path root{temporaryDirectory()};
+    std::filesystem::path targets{root / "targets"};
+    std::filesystem::path index{root / "index"};
+    CountingDirectoryReader decorated;
+    CachingDirectoryReader reader{&decorated};
+
+    CachingDirectoryReaderTests() {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(targets);
+        age(std::chrono::hours{1});
+        decorated.files = {{"a.wav"}, {"b.wav"}};
+    }
+
+    ~CachingDirectoryReaderTests() override {
+        std::filesystem::remove_all(root);
+    }
+
+    void age(std::chrono::seconds s) {
+        std::filesystem::last_write_time(
+            targets, std::filesystem::file_time_type::clock::now() - s);
+    }
+
+    auto targetsUrl() -> LocalUrl { return {targets.string()}; }
+};
+
+#define CACHING_DIRECTORY_READER_TEST(a) TEST_F(CachingDirectoryReaderTests, a)
+
+CACHING_DIRECTORY_READER_TEST(servesUnchangedDirectoryFromMemory) {
+    reader.filesIn(targetsUrl());
+    assertEqual({{"a.wav"}, {"b.wav"}}, reader.filesIn(targetsUrl()));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, decorated.filesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(listsAgainWhenDirectoryChanges) {
+    reader.filesIn(targetsUrl());
+    age(std::chrono::minutes{30});
+    decorated.files = {{"c.wav"}};
+    assertEqual({{"c.wav"}}, reader.filesIn(targetsUrl()));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, decorated.filesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(cachesSubdirectoriesSeparately) {
+    decorated.subDirectories_ = {{"x"}};
+    reader.filesIn(targetsUrl());
+    reader.subDirectories(targetsUrl());
+    assertEqual({{"x"}}, reader.subDirectories(targetsUrl()));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, decorated.filesListed);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, decorated.subDirectoriesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(doesNotCacheRecentlyModifiedDirectory) {
+    age(std::chrono::seconds{0});
+    reader.filesIn(targetsUrl());
+    reader.filesIn(targetsUrl());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, decorated.filesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(passesThroughDirectoryItCannotStat) {
+    reader.filesIn({(root / "missing").string()});
+    reader.filesIn({(root / "missing").string()});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, decorated.filesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(laterReaderStartsFromSavedIndex) {
+    {
+        CachingDirectoryReader first{&decorated, index};
+        first.filesIn(targetsUrl());
+    }
+    CountingDirectoryReader fresh;
+    CachingDirectoryReader second{&fresh, index};
+    assertEqual({{"a.wav"}, {"b.wav"}}, second.filesIn(targetsUrl()));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, fresh.filesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(writesIndexOnlyWhenFlushed) {
+    CachingDirectoryReader first{&decorated, index};
+    first.filesIn(targetsUrl());
+    first.subDirectories(targetsUrl());
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(std::filesystem::exists(index));
+    first.flush();
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(std::filesystem::exists(index));
+    CountingDirectoryReader fresh;
+    CachingDirectoryReader second{&fresh, index};
+    second.filesIn(targetsUrl());
+    second.subDirectories(targetsUrl());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, fresh.filesListed);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, fresh.subDirectoriesListed);
+}
+
+CACHING_DIRECTORY_READER_TEST(ignoresUnreadableIndex) {
+    {
+        std::ofstream stream{index};
+        stream << "something else\n";
+    }
+    CachingDirectoryReader second{&decorated, index};
+    second.filesIn(targetsUrl());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, decorated.filesListed);
+}
+}
+}
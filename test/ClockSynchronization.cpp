@@ -0,0 +1,151 @@
+#include "EyeTrackerStub.hpp"
+#include "MaskerPlayerStub.hpp"
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/ClockSynchronization.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+constexpr std::uintmax_t targetPlayerStart{1000000000000};
+constexpr std::int_least64_t eyeTrackerStart{5000000000};
+constexpr std::uintmax_t samplingPeriodNanoseconds{5000000};
+
+auto eyeTrackerMicroseconds(std::uintmax_t targetPlayerNanoseconds,
+    double driftPartsPerMillion) -> std::int_least64_t {
+    return eyeTrackerStart +
+        std::llround(
+            static_cast<double>(targetPlayerNanoseconds - targetPlayerStart) *
+            1e-3 * (1 + driftPartsPerMillion / 1e6));
+}
+
+auto sample(std::uintmax_t targetPlayerNanoseconds,
+    std::int_least64_t eyeTrackerMicroseconds,
+    std::int_least64_t roundTripMicroseconds = 0)
+    -> EyeTrackerTargetPlayerClockSample {
+    EyeTrackerTargetPlayerClockSample s;
+    s.eyeTrackerSystemTimeBefore.microseconds =
+        eyeTrackerMicroseconds - roundTripMicroseconds / 2;
+    s.targetPlayerSystemTime.nanoseconds = targetPlayerNanoseconds;
+    s.eyeTrackerSystemTimeAfter.microseconds =
+        s.eyeTrackerSystemTimeBefore.microseconds + roundTripMicroseconds;
+    return s;
+}
+
+auto targetPlayerNanoseconds(int i) -> std::uintmax_t {
+    return targetPlayerStart + i * samplingPeriodNanoseconds;
+}
+
+class ClockSynchronizationTests : public ::testing::Test {
+  protected:
+    std::vector<EyeTrackerTargetPlayerClockSample> samples;
+};
+
+class ClockSynchronizationImplTests : public ::testing::Test {
+  protected:
+    EyeTrackerStub eyeTracker;
+    MaskerPlayerStub maskerPlayer;
+};
+
+#define CLOCK_SYNCHRONIZATION_TEST(a) TEST_F(ClockSynchronizationTests, a)
+
+#define CLOCK_SYNCHRONIZATION_IMPL_TEST(a)                                     \
+    TEST_F(ClockSynchronizationImplTests, a)
+
+CLOCK_SYNCHRONIZATION_TEST(fitsOffsetAndDrift) {
+    for (int i{0}; i < 1000; ++i)
+        samples.push_back(sample(targetPlayerNanoseconds(i),
+            eyeTrackerMicroseconds(targetPlayerNanoseconds(i), 20)));
+    const auto model{fit(samples)};
+    assertEqual(20., model.driftPartsPerMillion, 0.1);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        targetPlayerStart, model.reference.nanoseconds);
+    assertEqual(static_cast<double>(eyeTrackerStart),
+        static_cast<double>(model.eyeTrackerSystemTimeAtReference.microseconds),
+        1.);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1000, model.samples);
+}
+
+CLOCK_SYNCHRONIZATION_TEST(rejectsPairsWithLongRoundTrips) {
+    for (int i{0}; i < 300; ++i)
+        samples.push_back(i % 3 == 0
+                ? sample(targetPlayerNanoseconds(i),
+                      eyeTrackerMicroseconds(targetPlayerNanoseconds(i), 0) +
+                          500,
+                      1000)
+                : sample(targetPlayerNanoseconds(i),
+                      eyeTrackerMicroseconds(targetPlayerNanoseconds(i), 0)));
+    const auto model{fit(samples)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(200, model.samples);
+    assertEqual(0., model.residualStandardDeviationMicroseconds, 1e-6);
+}
+
+CLOCK_SYNCHRONIZATION_TEST(rejectsPairsThatDoNotFitTheLine) {
+    for (int i{0}; i < 200; ++i)
+        samples.push_back(sample(targetPlayerNanoseconds(i),
+            eyeTrackerMicroseconds(targetPlayerNanoseconds(i), 0) +
+                (i % 40 == 5 ? 1000 : 0),
+            2));
+    const auto model{fit(samples)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(195, model.samples);
+    assertEqual(0., model.driftPartsPerMillion, 1e-6);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        eyeTrackerStart, model.eyeTrackerSystemTimeAtReference.microseconds);
+}
+
+CLOCK_SYNCHRONIZATION_TEST(fitOfNoSamplesHasNoSamples) {
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, fit(samples).samples);
+}
+
+CLOCK_SYNCHRONIZATION_TEST(convertsTargetPlayerTimeToEyeTrackerTime) {
+    EyeTrackerTargetPlayerClockModel model;
+    model.reference.nanoseconds = targetPlayerStart;
+    model.eyeTrackerSystemTimeAtReference.microseconds = 5000;
+    model.driftPartsPerMillion = 100;
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{5000 + 1000100},
+        eyeTrackerSystemTime(
+            model, TargetPlayerSystemTime{targetPlayerStart + 1000000000})
+            .microseconds);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{5000 - 1000100},
+        eyeTrackerSystemTime(
+            model, TargetPlayerSystemTime{targetPlayerStart - 1000000000})
+            .microseconds);
+}
+
+CLOCK_SYNCHRONIZATION_IMPL_TEST(samplesBothClocks) {
+    ClockSynchronizationImpl clockSynchronization{eyeTracker, maskerPlayer};
+    eyeTracker.setCurrentSystemTime(EyeTrackerSystemTime{7});
+    maskerPlayer.setNanosecondsFromPlayerTime(9);
+    clockSynchronization.sample();
+    const auto model{clockSynchronization.model()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, model.samples);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::uintmax_t{9}, model.reference.nanoseconds);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{7},
+        model.eyeTrackerSystemTimeAtReference.microseconds);
+}
+
+CLOCK_SYNCHRONIZATION_IMPL_TEST(keepsOnlyMostRecentSamples) {
+    ClockSynchronizationImpl::Settings settings;
+    settings.capacity = 2;
+    ClockSynchronizationImpl clockSynchronization{
+        eyeTracker, maskerPlayer, settings};
+    for (int i{0}; i < 3; ++i) {
+        maskerPlayer.setNanosecondsFromPlayerTime(targetPlayerNanoseconds(i));
+        clockSynchronization.sample();
+    }
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, clockSynchronization.model().samples);
+}
+
+CLOCK_SYNCHRONIZATION_IMPL_TEST(samplesAtLeastOnceBetweenStartAndStop) {
+    ClockSynchronizationImpl clockSynchronization{eyeTracker, maskerPlayer};
+    clockSynchronization.start();
+    clockSynchronization.stop();
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(clockSynchronization.model().samples >= 1);
+}
+}
+}
@@ -0,0 +1,30 @@
+#ifndef AV_SPEECH_IN_NOISE_TEST_CLOCKSYNCHRONIZATIONSTUB_HPP_
+#define AV_SPEECH_IN_NOISE_TEST_CLOCKSYNCHRONIZATIONSTUB_HPP_
+
+#include <av-speech-in-noise/core/ClockSynchronization.hpp>
+
+namespace av_speech_in_noise {
+class ClockSynchronizationStub : public ClockSynchronization {
+  public:
+    void start() override { started_ = true; }
+
+    void stop() override { stopped_ = true; }
+
+    auto model() -> EyeTrackerTargetPlayerClockModel override {
+        return model_;
+    }
+
+    void setModel(EyeTrackerTargetPlayerClockModel m) { model_ = m; }
+
+    [[nodiscard]] auto started() const -> bool { return started_; }
+
+    [[nodiscard]] auto stopped() const -> bool { return stopped_; }
+
+  private:
+    EyeTrackerTargetPlayerClockModel model_{};
+    bool started_{};
+    bool stopped_{};
+};
+}
+
+#endif
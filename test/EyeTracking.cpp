@@ -1,3 +1,4 @@
+#include "ClockSynchronizationStub.hpp"
 #include "OutputFileStub.hpp"
 #include "EyeTrackerStub.hpp"
 #include "MaskerPlayerStub.hpp"
@@ -46,7 +47,9 @@ class EyeTrackingTests : public ::testing::Test {
     MaskerPlayerStub maskerPlayer;
     TargetPlayerStub targetPlayer;
     OutputFileStub outputFile;
-    EyeTracking eyeTracking{eyeTracker, maskerPlayer, targetPlayer, outputFile};
+    ClockSynchronizationStub clockSynchronization;
+    EyeTracking eyeTracking{eyeTracker, maskerPlayer, targetPlayer, outputFile,
+        clockSynchronization};
 };
 
 #define EYE_TRACKING_TEST(a) TEST_F(EyeTrackingTests, a)
@@ -126,6 +129,24 @@ EYE_TRACKING_TEST(submitCoordinateResponseWritesSyncTimes) {
             .eyeTrackerSystemTime.microseconds);
 }
 
+EYE_TRACKING_TEST(syncTimesPlaceTargetStartOnFittedClock) {
+    maskerPlayer.setNanosecondsFromPlayerTime(3000);
+    EyeTrackerTargetPlayerClockModel model;
+    model.reference.nanoseconds = 1000;
+    model.eyeTrackerSystemTimeAtReference.microseconds = 5;
+    model.samples = 2;
+    clockSynchronization.setModel(model);
+    eyeTracker.setCurrentSystemTime(EyeTrackerSystemTime{100});
+    eyeTracking.notifyThatTargetWillPlayAt({});
+    eyeTracking.notifyThatSubjectHasResponded();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::uintmax_t{3000},
+        eyeTrackerTargetPlayerSynchronization(outputFile)
+            .targetPlayerSystemTime.nanoseconds);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{7},
+        eyeTrackerTargetPlayerSynchronization(outputFile)
+            .eyeTrackerSystemTime.microseconds);
+}
+
 EYE_TRACKING_TEST(passesCurrentMaskerTimeForNanosecondConversion) {
     av_speech_in_noise::PlayerTime t{};
     t.system = 1;
@@ -134,4 +155,59 @@ EYE_TRACKING_TEST(passesCurrentMaskerTimeForNanosecondConversion) {
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(player_system_time_type{1},
         maskerPlayer.toNanosecondsSystemTime().at(1));
 }
+
+EYE_TRACKING_TEST(submittingResponseWritesGazeStatisticsOfTrial) {
+    BinocularGazeSample a{};
+    a.left.position.valid = false;
+    eyeTracker.setGazes({a, {}});
+    eyeTracking.notifyThatTrialWillBegin(1);
+    eyeTracking.notifyThatSubjectHasResponded();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        50., outputFile.gazeStatistics().left.percentValid);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        100., outputFile.gazeStatistics().right.percentValid);
+}
+
+EYE_TRACKING_TEST(gazeStatisticsAreResetEachTrial) {
+    BinocularGazeSample a{};
+    a.left.position.valid = false;
+    eyeTracker.setGazes({a});
+    eyeTracking.notifyThatTrialWillBegin(1);
+    eyeTracking.notifyThatSubjectHasResponded();
+    eyeTracker.setGazes({{}});
+    eyeTracking.notifyThatTrialWillBegin(2);
+    eyeTracking.notifyThatSubjectHasResponded();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        100., outputFile.gazeStatistics().left.percentValid);
+}
+
+EYE_TRACKING_TEST(startsClockSynchronizationWhenNewTestIsReady) {
+    eyeTracking.notifyThatNewTestIsReady({});
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(clockSynchronization.started());
+}
+
+EYE_TRACKING_TEST(submittingResponseWritesClockModel) {
+    EyeTrackerTargetPlayerClockModel model;
+    model.driftPartsPerMillion = 1.5;
+    model.samples = 2;
+    clockSynchronization.setModel(model);
+    eyeTracking.notifyThatSubjectHasResponded();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1.5,
+        outputFile.eyeTrackerTargetPlayerClockModel().driftPartsPerMillion);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        2, outputFile.eyeTrackerTargetPlayerClockModel().samples);
+}
+
+EYE_TRACKING_TEST(submittingResponseWritesGazeDecimatedToTestOutputRate) {
+    av_speech_in_noise::Test test;
+    test.gazeFilter.outputRateHz = 100;
+    eyeTracking.notifyThatNewTestIsReady(test);
+    BinocularGazeSamples samples(50);
+    for (gsl::index i{0}; i < 50; ++i)
+        samples.at(i).systemTime.microseconds = i * 1000;
+    eyeTracker.setGazes(samples);
+    eyeTracking.notifyThatSubjectHasResponded();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{5}, outputFile.eyeGazes().size());
+}
 }
@@ -2,6 +2,7 @@
 #include "OutputFileStub.hpp"
 #include "ResponseEvaluatorStub.hpp"
 #include "TargetPlaylistStub.hpp"
+#include "TemporaryDirectory.hpp"
 #include "assert-utility.hpp"
 
 #include <av-speech-in-noise/Interface.hpp>
@@ -9,7 +10,11 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace av_speech_in_noise {
 namespace {
@@ -235,6 +240,24 @@ void assertCurrentTargetReinserted(
     AV_SPEECH_IN_NOISE_EXPECT_TRUE(reinsertCurrentCalled(list));
 }
 
+class TargetsInOrder : public FiniteTargetPlaylistWithRepeatables {
+  public:
+    explicit TargetsInOrder(std::vector<std::string> targets)
+        : targets{std::move(targets)} {}
+    void load(const LocalUrl &) override {}
+    auto next() -> LocalUrl override { return {targets.at(drawn++)}; }
+    auto current() -> LocalUrl override {
+        return drawn == 0 ? LocalUrl{} : LocalUrl{targets.at(drawn - 1)};
+    }
+    auto directory() -> LocalUrl override { return {}; }
+    auto empty() -> bool override { return drawn == targets.size(); }
+    void reinsertCurrent() override {}
+
+  private:
+    std::vector<std::string> targets;
+    std::size_t drawn{};
+};
+
 class FixedLevelMethodTests : public ::testing::Test {
   protected:
     ResponseEvaluatorStub evaluator;
@@ -261,7 +284,8 @@ class FixedLevelMethodTests : public ::testing::Test {
     }
 
     void setCurrentTarget(std::string s) {
-        targetList.setCurrent(std::move(s));
+        targetList.setCurrentTargetWhenNext(std::move(s));
+        method.nextTarget();
     }
 };
 
@@ -349,20 +373,61 @@ FIXED_LEVEL_METHOD_TEST(completeWhenTrialsExhausted) {
 }
 
 FIXED_LEVEL_METHOD_TEST(submitCoordinateResponsePassesCurrentToEvaluator) {
-    setCurrentTarget("a");
+    setCurrentTarget("b/a.wav");
     run(submittingCoordinateResponse, method);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.correctColorFilePath());
+        std::string{"a"}, evaluator.correctColorStem());
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.correctNumberFilePath());
+        std::string{"a"}, evaluator.correctNumberStem());
 }
 
 FIXED_LEVEL_METHOD_TEST(
     submitCoordinateResponsePassesCorrectTargetToEvaluator) {
-    setCurrentTarget("a");
+    setCurrentTarget("b/a.wav");
     run(submittingCoordinateResponse, method);
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.correctFilePath());
+        std::string{"a"}, evaluator.correctStem());
+}
+
+FIXED_LEVEL_METHOD_TEST(splitsCurrentTargetWhenDrawn) {
+    setCurrentTarget("b/a.wav");
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"a.wav"}, std::string{method.currentTargetFileName()});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"a"}, std::string{method.currentTargetStem()});
+}
+
+FIXED_LEVEL_METHOD_TEST(hasNoMaskerSeekFractionWithoutTrialPlan) {
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(method.maskerSeekFraction().has_value());
+}
+
+FIXED_LEVEL_METHOD_TEST(trialPlanDrawsEveryTargetAtInitialize) {
+    const auto directory{temporaryDirectory()};
+    std::filesystem::create_directories(directory);
+    std::ofstream{directory / "a.wav"};
+    setNext(targetList, (directory / "a.wav").string());
+    test.trials = 2;
+    test.compileTrialPlan = true;
+    test.trialPlanSeed = 3;
+    run(initializingMethod, method);
+    setNext(targetList, "b");
+    assertNextTargetEquals(method, (directory / "a.wav").string());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(method.maskerSeekFraction().has_value());
+    method.writeTestingParameters(outputFile);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::uint64_t{3}, outputFile.trialPlan().seed);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{2}, outputFile.trialPlan().trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        *method.maskerSeekFraction(),
+        outputFile.trialPlan().trials.front().maskerSeekFraction);
+    std::filesystem::remove_all(directory);
+}
+
+FIXED_LEVEL_METHOD_TEST(trialPlanThrowsWhenTargetIsMissing) {
+    setNext(targetList, "does-not-exist.wav");
+    test.compileTrialPlan = true;
+    EXPECT_THROW(run(initializingMethod, method), std::runtime_error);
 }
 
 class FixedLevelMethodWithFiniteTargetPlaylistTests : public ::testing::Test {
@@ -579,6 +644,31 @@ FIXED_LEVEL_METHOD_WITH_FINITE_TARGET_LIST_WITH_REPEATABLES_TEST(
         endsWith(targetList.log(), "reinsertCurrent empty "));
 }
 
+FIXED_LEVEL_METHOD_WITH_FINITE_TARGET_LIST_WITH_REPEATABLES_TEST(
+    trialPlanAmendedWithReinsertedTarget) {
+    const auto directory{temporaryDirectory()};
+    std::filesystem::create_directories(directory);
+    std::ofstream{directory / "a.wav"};
+    std::ofstream{directory / "b.wav"};
+    TargetsInOrder targets{
+        {(directory / "a.wav").string(), (directory / "b.wav").string()}};
+    test.compileTrialPlan = true;
+    test.trialPlanSeed = 5;
+    method.initialize(test, &targets);
+    assertNextTargetEquals(method, (directory / "a.wav").string());
+    submittingFreeResponse.setFlagged();
+    run(submittingFreeResponse, method);
+    const auto *plan{method.trialPlan()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{3}, plan->trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        plan->trials.front().maskerSeekFraction,
+        plan->trials.back().maskerSeekFraction);
+    assertNextTargetEquals(method, (directory / "b.wav").string());
+    run(submittingFreeResponse, method);
+    assertNextTargetEquals(method, (directory / "a.wav").string());
+    std::filesystem::remove_all(directory);
+}
+
 FIXED_LEVEL_METHOD_WITH_FINITE_TARGET_LIST_WITH_REPEATABLES_TEST(
     initializeLoadsBeforeQueryingCompletion) {
     run(initializingMethod, method);
@@ -2,6 +2,7 @@
 #define AV_SPEECH_IN_NOISE_TEST_FIXEDLEVELMETHODSTUB_HPP_
 
 #include <av-speech-in-noise/core/IFixedLevelMethod.hpp>
+#include <av-speech-in-noise/core/PathTable.hpp>
 
 namespace av_speech_in_noise {
 class FixedLevelMethodStub : public FixedLevelMethod {
@@ -30,7 +31,19 @@ class FixedLevelMethodStub : public FixedLevelMethod {
 
     auto currentTarget() -> LocalUrl override { return currentTarget_; }
 
+    auto currentTargetFileName() -> std::string_view override {
+        return fileName(currentTarget_.path);
+    }
+
+    auto currentTargetStem() -> std::string_view override {
+        return stem(currentTarget_.path);
+    }
+
     auto snr() -> SNR override { return SNR{}; }
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return std::nullopt;
+    }
+    auto trialPlan() -> const TrialPlan * override { return nullptr; }
 
     void submit(const Flaggable &) override { submittedFlaggable = true; }
 
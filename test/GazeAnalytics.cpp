@@ -0,0 +1,143 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/GazeAnalytics.hpp>
+
+#include <gtest/gtest.h>
+
+namespace av_speech_in_noise {
+namespace {
+auto sample(std::int_least64_t microseconds, Point2D left, Point2D right)
+    -> BinocularGazeSample {
+    BinocularGazeSample s{};
+    s.systemTime.microseconds = microseconds;
+    s.left.position.relativeScreen = left;
+    s.right.position.relativeScreen = right;
+    return s;
+}
+
+auto sample(std::int_least64_t microseconds, Point2D p = {})
+    -> BinocularGazeSample {
+    return sample(microseconds, p, p);
+}
+
+auto invalid(std::int_least64_t microseconds) -> BinocularGazeSample {
+    auto s{sample(microseconds)};
+    s.left.position.valid = false;
+    s.right.position.valid = false;
+    return s;
+}
+
+auto statistics(GazeAnalytics &analytics) -> BinocularGazeStatistics {
+    return analytics.statistics();
+}
+
+class GazeAnalyticsTests : public ::testing::Test {
+  protected:
+    GazeAnalytics analytics;
+};
+
+#define GAZE_ANALYTICS_TEST(a) TEST_F(GazeAnalyticsTests, a)
+
+GAZE_ANALYTICS_TEST(computesPercentValidPerEye) {
+    auto a{sample(0)};
+    a.left.position.valid = false;
+    auto b{sample(1)};
+    auto c{sample(2)};
+    c.right.position.valid = false;
+    auto d{sample(3)};
+    d.left.position.valid = false;
+    analytics.add({a, b, c, d});
+    assertEqual(50., statistics(analytics).left.percentValid, 1e-9);
+    assertEqual(75., statistics(analytics).right.percentValid, 1e-9);
+}
+
+GAZE_ANALYTICS_TEST(computesMeanAndStandardDeviationOfValidSamples) {
+    analytics.add({sample(0, {0.1F, 0.2F}, {0.5F, 0.5F}),
+        sample(1, {0.3F, 0.6F}, {0.5F, 0.5F})});
+    auto a{sample(2, {0.9F, 0.9F}, {0.5F, 0.5F})};
+    a.left.position.valid = false;
+    analytics.add(a);
+    assertEqual(0.2F, statistics(analytics).left.meanRelativeScreen.x, 1e-6F);
+    assertEqual(0.4F, statistics(analytics).left.meanRelativeScreen.y, 1e-6F);
+    assertEqual(0.141421F,
+        statistics(analytics).left.standardDeviationRelativeScreen.x, 1e-6F);
+    assertEqual(0.282843F,
+        statistics(analytics).left.standardDeviationRelativeScreen.y, 1e-6F);
+    assertEqual(
+        0.F, statistics(analytics).right.standardDeviationRelativeScreen.x);
+}
+
+GAZE_ANALYTICS_TEST(chunksAreEquivalentToSingleSamples) {
+    GazeAnalytics other;
+    BinocularGazeSamples samples{sample(0, {0.1F, 0.2F}),
+        sample(1000, {0.3F, 0.4F}), sample(2000, {0.5F, 0.6F})};
+    analytics.add(samples);
+    for (const auto &s : samples)
+        other.add(s);
+    assertEqual(statistics(other).left.meanRelativeScreen.x,
+        statistics(analytics).left.meanRelativeScreen.x);
+    assertEqual(statistics(other).left.standardDeviationRelativeScreen.y,
+        statistics(analytics).left.standardDeviationRelativeScreen.y);
+}
+
+GAZE_ANALYTICS_TEST(countsFixationLongerThanMinimumDuration) {
+    for (std::int_least64_t t{0}; t <= 150000; t += 10000)
+        analytics.add(sample(t, {0.5F, 0.5F}));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, statistics(analytics).fixations);
+}
+
+GAZE_ANALYTICS_TEST(doesNotCountFixationShorterThanMinimumDuration) {
+    for (std::int_least64_t t{0}; t <= 50000; t += 10000)
+        analytics.add(sample(t, {0.5F, 0.5F}));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, statistics(analytics).fixations);
+}
+
+GAZE_ANALYTICS_TEST(saccadeSeparatesFixations) {
+    for (std::int_least64_t t{0}; t <= 150000; t += 10000)
+        analytics.add(sample(t, {0.2F, 0.2F}));
+    for (std::int_least64_t t{160000}; t <= 310000; t += 10000)
+        analytics.add(sample(t, {0.8F, 0.8F}));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, statistics(analytics).fixations);
+}
+
+GAZE_ANALYTICS_TEST(countsBlinkWhenBothEyesInvalidForBlinkDuration) {
+    analytics.add(sample(0));
+    for (std::int_least64_t t{10000}; t <= 100000; t += 10000)
+        analytics.add(invalid(t));
+    analytics.add(sample(110000));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, statistics(analytics).blinks);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, statistics(analytics).gaps);
+}
+
+GAZE_ANALYTICS_TEST(countsGapWhenBothEyesInvalidBrieflyOrForTooLong) {
+    analytics.add({sample(0), invalid(10000), sample(20000)});
+    for (std::int_least64_t t{30000}; t <= 1030000; t += 10000)
+        analytics.add(invalid(t));
+    analytics.add(sample(1040000));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, statistics(analytics).blinks);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, statistics(analytics).gaps);
+}
+
+GAZE_ANALYTICS_TEST(oneValidEyeIsNotAGap) {
+    auto a{sample(10000)};
+    a.left.position.valid = false;
+    analytics.add({sample(0), a, sample(20000)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, statistics(analytics).gaps);
+}
+
+GAZE_ANALYTICS_TEST(includesInvalidRunInProgress) {
+    analytics.add({sample(0), invalid(10000)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, statistics(analytics).gaps);
+}
+
+GAZE_ANALYTICS_TEST(resetClearsStatistics) {
+    for (std::int_least64_t t{0}; t <= 150000; t += 10000)
+        analytics.add(sample(t, {0.5F, 0.5F}));
+    analytics.add(invalid(160000));
+    analytics.reset();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, statistics(analytics).fixations);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, statistics(analytics).gaps);
+    assertEqual(0., statistics(analytics).left.percentValid);
+}
+}
+}
@@ -0,0 +1,129 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/GazeFilter.hpp>
+
+#include <gsl/gsl>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+
+namespace av_speech_in_noise {
+namespace {
+constexpr auto pi{3.14159265358979323846};
+
+auto samplesAt(double rateHz, gsl::index n,
+    const std::function<float(double)> &x) -> BinocularGazeSamples {
+    BinocularGazeSamples samples(n);
+    for (gsl::index i{0}; i < n; ++i) {
+        const auto seconds{i / rateHz};
+        samples.at(i).systemTime.microseconds = std::llround(seconds * 1e6);
+        samples.at(i).left.position.relativeScreen = {x(seconds), 0.5F};
+        samples.at(i).right.position.relativeScreen = {x(seconds), 0.5F};
+    }
+    return samples;
+}
+
+auto leftX(const BinocularGazeSample &s) -> float {
+    return s.left.position.relativeScreen.x;
+}
+
+void invalidate(BinocularGazeSample &s) {
+    s.left.position.valid = false;
+    s.right.position.valid = false;
+}
+
+class GazeFilterTests : public ::testing::Test {};
+
+#define GAZE_FILTER_TEST(a) TEST_F(GazeFilterTests, a)
+
+GAZE_FILTER_TEST(decimatesToOutputRate) {
+    const auto decimated{
+        decimate(samplesAt(1200, 1200, [](double) { return 0.5F; }), 120)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{120}, decimated.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{0},
+        decimated.at(0).systemTime.microseconds);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{8333},
+        decimated.at(1).systemTime.microseconds);
+    assertEqual(0.5F, leftX(decimated.at(60)), 1e-6F);
+}
+
+GAZE_FILTER_TEST(zeroOutputRateKeepsEverySample) {
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{100},
+        decimate(samplesAt(1200, 100, [](double) { return 0.5F; }), 0)
+            .size());
+}
+
+GAZE_FILTER_TEST(outputRateAboveInputRateKeepsEverySample) {
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{100},
+        decimate(samplesAt(60, 100, [](double) { return 0.5F; }), 120)
+            .size());
+}
+
+GAZE_FILTER_TEST(attenuatesFrequenciesAboveOutputNyquist) {
+    const auto decimated{decimate(samplesAt(1200, 1200,
+                                      [](double t) {
+                                          return gsl::narrow_cast<float>(0.5 +
+                                              0.1 * std::sin(2 * pi * 200 * t));
+                                      }),
+        120)};
+    for (gsl::index i{10}; i < 110; ++i)
+        assertEqual(0.5F, leftX(decimated.at(i)), 0.01F);
+}
+
+GAZE_FILTER_TEST(passesFrequenciesWellBelowOutputNyquist) {
+    const auto decimated{decimate(samplesAt(1200, 1200,
+                                      [](double t) {
+                                          return gsl::narrow_cast<float>(0.5 +
+                                              0.1 * std::sin(2 * pi * 5 * t));
+                                      }),
+        120)};
+    assertEqual(0.6F, leftX(decimated.at(6)), 0.005F);
+}
+
+GAZE_FILTER_TEST(invalidSamplesDoNotContributeToNeighbors) {
+    auto samples{samplesAt(1200, 100, [](double) { return 0.5F; })};
+    for (gsl::index i{45}; i < 55; ++i) {
+        samples.at(i).left.position.relativeScreen.x = 100;
+        invalidate(samples.at(i));
+    }
+    const auto decimated{decimate(samples, 120)};
+    for (gsl::index i{0}; i < 10; ++i)
+        if (decimated.at(i).left.position.valid)
+            assertEqual(0.5F, leftX(decimated.at(i)), 1e-6F);
+}
+
+GAZE_FILTER_TEST(invalidCenterSampleRemainsInvalid) {
+    auto samples{samplesAt(1200, 100, [](double) { return 0.5F; })};
+    invalidate(samples.at(50));
+    const auto decimated{decimate(samples, 120)};
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(decimated.at(5).left.position.valid);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(decimated.at(4).left.position.valid);
+}
+
+GAZE_FILTER_TEST(smoothingAveragesNeighbors) {
+    auto samples{samplesAt(60, 3, [](double) { return 0.F; })};
+    samples.at(1).left.position.relativeScreen.x = 1;
+    const auto smoothed{smooth(samples)};
+    assertEqual(0.5F, leftX(smoothed.at(1)), 1e-6F);
+    assertEqual(1 / 3.F, leftX(smoothed.at(2)), 1e-6F);
+}
+
+GAZE_FILTER_TEST(smoothingIgnoresInvalidNeighbors) {
+    auto samples{samplesAt(60, 3, [](double) { return 1.F; })};
+    samples.at(0).left.position.relativeScreen.x = 0;
+    invalidate(samples.at(0));
+    assertEqual(1.F, leftX(smooth(samples).at(1)), 1e-6F);
+}
+
+GAZE_FILTER_TEST(filterSmoothsOnlyWhenEnabled) {
+    auto samples{samplesAt(60, 3, [](double) { return 0.F; })};
+    samples.at(1).left.position.relativeScreen.x = 1;
+    GazeFilterSettings settings;
+    assertEqual(1.F, leftX(filter(samples, settings).at(1)));
+    settings.smoothing = true;
+    assertEqual(0.5F, leftX(filter(samples, settings).at(1)), 1e-6F);
+}
+}
+}
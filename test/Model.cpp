@@ -3,6 +3,7 @@
 #include "RandomizerStub.hpp"
 #include "assert-utility.hpp"
 
+#include <av-speech-in-noise/core/PathTable.hpp>
 #include <av-speech-in-noise/core/SubmittingKeyPress.hpp>
 #include <av-speech-in-noise/core/SubmittingConsonant.hpp>
 #include <av-speech-in-noise/core/SubmittingFreeResponse.hpp>
@@ -31,8 +32,8 @@ class AdaptiveMethodStub : public AdaptiveMethod {
         return tracksResetted_;
     }
 
-    void initialize(
-        const AdaptiveTest &t, TargetPlaylistReader *reader) override {
+    void initialize(const AdaptiveTest &t, TargetPlaylistReader *reader,
+        Track::Factory &) override {
         test_ = &t;
         targetListReader_ = reader;
     }
@@ -47,6 +48,10 @@ class AdaptiveMethodStub : public AdaptiveMethod {
 
     auto testResults() -> AdaptiveTestResults override { return testResults_; }
 
+    auto currentTrackResult() -> std::optional<AdaptiveTestResult> override {
+        return std::nullopt;
+    }
+
     void resetTracks() override { tracksResetted_ = true; }
 
     auto log() -> const std::stringstream & { return log_; }
@@ -59,7 +64,13 @@ class AdaptiveMethodStub : public AdaptiveMethod {
         return {};
     }
     auto currentTarget() -> LocalUrl override { return {}; }
+    auto currentTargetFileName() -> std::string_view override { return {}; }
+    auto currentTargetStem() -> std::string_view override { return {}; }
     auto snr() -> SNR override { return SNR{}; }
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return std::nullopt;
+    }
+    auto trialPlan() -> const TrialPlan * override { return nullptr; }
     void submitCorrectResponse() override { log_ << "submitCorrectResponse "; }
     void submitIncorrectResponse() override {
         log_ << "submitIncorrectResponse ";
@@ -132,11 +143,23 @@ class FixedLevelMethodStub : public FixedLevelMethod {
 
     auto currentTarget() -> LocalUrl override { return currentTarget_; }
 
+    auto currentTargetFileName() -> std::string_view override {
+        return fileName(currentTarget_.path);
+    }
+
+    auto currentTargetStem() -> std::string_view override {
+        return stem(currentTarget_.path);
+    }
+
     void setCurrentTargetPath(std::string s) {
         currentTarget_.path = std::move(s);
     }
 
     auto snr() -> SNR override { return SNR{}; }
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return std::nullopt;
+    }
+    auto trialPlan() -> const TrialPlan * override { return nullptr; }
 
     void submit(const Flaggable &) override { submittedFlaggable = true; }
 
@@ -264,6 +287,8 @@ class RunningATestStub : public RunningATest {
 
     auto playTrialTime() -> std::string override { return playTrialTime_; }
 
+    auto method() -> const TestMethod * override { return testMethod_; }
+
     void setPlayTrialTime(std::string s) { playTrialTime_ = std::move(s); }
 
     std::vector<std::reference_wrapper<TestObserver>> observer{};
@@ -3,6 +3,7 @@
 
 #include <av-speech-in-noise/Interface.hpp>
 #include <av-speech-in-noise/core/OutputFile.hpp>
+#include <av-speech-in-noise/core/TrialPlan.hpp>
 
 #include <gtest/gtest.h>
 
@@ -1086,6 +1087,39 @@ OUTPUT_FILE_TEST(writeAdaptiveTestResult) {
     assertContainsColonDelimitedEntry(writer, "threshold for c", "3");
 }
 
+OUTPUT_FILE_TEST(writeAdaptiveTestResultStoppingReason) {
+    AdaptiveTestResults results{};
+    results.push_back({{"a"}, 1., TrackStoppingReason::converged});
+    file.write(results);
+    assertContainsColonDelimitedEntry(
+        writer, "stopping reason for a", "converged");
+}
+
+OUTPUT_FILE_TEST(writesConvergenceRule) {
+    AdaptiveTest test;
+    test.convergenceReversals = 6;
+    test.convergenceStandardErrorDb = 0.5;
+    file.write(test);
+    assertContainsColonDelimitedEntry(writer, "convergence reversals", "6");
+    assertContainsColonDelimitedEntry(
+        writer, "convergence standard error (dB)", "0.5");
+}
+
+OUTPUT_FILE_TEST(writesTrackSelection) {
+    AdaptiveTest test;
+    test.trackSelection = TrackSelection::leastPresented;
+    file.write(test);
+    assertContainsColonDelimitedEntry(
+        writer, "track selection", "least presented");
+}
+
+OUTPUT_FILE_TEST(writesTrackAlgorithm) {
+    AdaptiveTest test;
+    test.trackAlgorithm = TrackAlgorithm::psi;
+    file.write(test);
+    assertContainsColonDelimitedEntry(writer, "track", "psi");
+}
+
 OUTPUT_FILE_TEST(writeCommonFixedLevelTest) {
     assertCommonTestWritten(writingFixedLevelTest);
 }
@@ -1231,6 +1265,44 @@ OUTPUT_FILE_TEST(writeGazeValidities) {
     assertNthCommaDelimitedEntryOfLine(writer, "n", 13, 2);
 }
 
+OUTPUT_FILE_TEST(writeGazeStatistics) {
+    BinocularGazeStatistics statistics;
+    statistics.left.percentValid = 1;
+    statistics.right.percentValid = 2;
+    statistics.left.meanRelativeScreen = {0.3F, 0.33F};
+    statistics.right.meanRelativeScreen = {0.4F, 0.44F};
+    statistics.left.standardDeviationRelativeScreen = {0.5F, 0.55F};
+    statistics.right.standardDeviationRelativeScreen = {0.6F, 0.66F};
+    statistics.fixations = 7;
+    statistics.blinks = 8;
+    statistics.gaps = 9;
+    file.write(statistics);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::leftGazeValidPercent, 1, 1);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::rightGazeValidPercent, 2, 1);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::leftMeanGazePositionRelativeScreen, 3, 1);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::rightMeanGazePositionRelativeScreen, 4, 1);
+    assertNthCommaDelimitedEntryOfLine(writer,
+        HeadingItem::leftGazePositionRelativeScreenStandardDeviation, 5, 1);
+    assertNthCommaDelimitedEntryOfLine(writer,
+        HeadingItem::rightGazePositionRelativeScreenStandardDeviation, 6, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::fixations, 7, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::blinks, 8, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::gaps, 9, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, "1", 1, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "2", 2, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "0.3 0.33", 3, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "0.4 0.44", 4, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "0.5 0.55", 5, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "0.6 0.66", 6, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "7", 7, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "8", 8, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "9", 9, 2);
+}
+
 OUTPUT_FILE_TEST(writeTargetStartTime) {
     writeTargetStartTimeNanoseconds(file, 1);
     assertContainsColonDelimitedEntry(writer, "target start time (ns)", "1");
@@ -1249,6 +1321,57 @@ OUTPUT_FILE_TEST(writeEyeTrackerTargetPlayerSynchronization) {
     assertNthCommaDelimitedEntryOfLine(writer, "2", 2, 2);
 }
 
+OUTPUT_FILE_TEST(writeMaskerSeekInFull) {
+    file.write(MaskerSeek{0.1 + 0.2});
+    assertContainsColonDelimitedEntry(
+        writer, "masker seek (s)", "0.30000000000000004");
+}
+
+OUTPUT_FILE_TEST(writeTrialPlan) {
+    TrialPlan plan;
+    plan.seed = 7;
+    plan.trials.push_back({{"a.wav"}, 0.25});
+    plan.trials.push_back({{"b.wav"}, 0.5});
+    file.write(plan);
+    assertContainsColonDelimitedEntry(writer, "trial plan seed", "7");
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::trialNumber, 1, 2);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::maskerSeekFraction, 2, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::target, 3, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "1", 1, 3);
+    assertNthCommaDelimitedEntryOfLine(writer, "0.25", 2, 3);
+    assertNthCommaDelimitedEntryOfLine(writer, "b.wav", 3, 4);
+}
+
+OUTPUT_FILE_TEST(writeTrialPlanAmendment) {
+    file.write(TrialPlanAmendment{3, {{"a.wav"}, 0.1 + 0.2}});
+    assertContainsColonDelimitedEntry(
+        writer, "trial plan amendment", "3, 0.30000000000000004, a.wav");
+}
+
+OUTPUT_FILE_TEST(writeEyeTrackerTargetPlayerClockModel) {
+    EyeTrackerTargetPlayerClockModel m{};
+    m.reference.nanoseconds = 1;
+    m.eyeTrackerSystemTimeAtReference.microseconds = 2;
+    m.driftPartsPerMillion = 3.5;
+    m.residualStandardDeviationMicroseconds = 4.5;
+    m.samples = 5;
+    file.write(m);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::clockReference, 1, 1);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::eyeTrackerTimeAtClockReference, 2, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::clockDrift, 3, 1);
+    assertNthCommaDelimitedEntryOfLine(
+        writer, HeadingItem::clockResidualStandardDeviation, 4, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, HeadingItem::clockSamples, 5, 1);
+    assertNthCommaDelimitedEntryOfLine(writer, "1", 1, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "2", 2, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "3.5", 3, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "4.5", 4, 2);
+    assertNthCommaDelimitedEntryOfLine(writer, "5", 5, 2);
+}
+
 OUTPUT_FILE_TEST(openPassesFormattedFilePath) {
     path.setFileName("a");
     path.setOutputDirectory("b");
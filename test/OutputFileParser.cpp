@@ -0,0 +1,346 @@
+#include "TemporaryDirectory.hpp"
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/OutputFileParser.hpp>
+#include <av-speech-in-noise/core/TrialPlan.hpp>
+
+#include <gtest/gtest.h>
+
+#include <gsl/gsl>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+class StringWriter : public Writer {
+  public:
+    void write(const std::string &s) override { written_ += s; }
+    void write(Writable &) override {}
+    void open(const std::string &) override {}
+    auto failed() -> bool override { return {}; }
+    void close() override {}
+    void save() override {}
+    [[nodiscard]] auto written() const -> const std::string & {
+        return written_;
+    }
+
+  private:
+    std::string written_;
+};
+
+class OutputFilePathStub : public OutputFilePath {
+  public:
+    auto generateFileName(const TestIdentity &) -> std::string override {
+        return {};
+    }
+    auto outputDirectory() -> std::string override { return {}; }
+    void setRelativeOutputDirectory(std::filesystem::path) override {}
+};
+
+struct RecordedTrial {
+    OutputFileTrialType type{};
+    std::vector<std::string> fields;
+    std::optional<bool> correct;
+    bool flagged{};
+};
+
+class ParseObserver : public OutputFileParseObserver {
+  public:
+    void labeledLine(const ParsedLabeledLine &line) override {
+        labels.emplace_back(line.label);
+        values.emplace_back(line.value);
+    }
+
+    void threshold(const ParsedThreshold &t) override {
+        thresholdTargets.emplace_back(t.targetsUrl);
+        thresholds.push_back(t.threshold);
+    }
+
+    void targetStartTime(TargetStartTime t) override {
+        targetStartTimes.push_back(t.nanoseconds);
+    }
+
+    void trial(const ParsedTrial &t) override {
+        RecordedTrial recorded;
+        recorded.type = t.type;
+        for (const auto column : t.columns)
+            recorded.fields.emplace_back(*t.field(column));
+        recorded.correct = t.correct();
+        recorded.flagged = t.flagged;
+        trials.push_back(recorded);
+    }
+
+    void gazeSample(const BinocularGazeSample &s) override {
+        gazeSamples.push_back(s);
+    }
+
+    void gazeStatistics(const BinocularGazeStatistics &s) override {
+        statistics.push_back(s);
+    }
+
+    void synchronization(
+        const EyeTrackerTargetPlayerSynchronization &s) override {
+        synchronizations.push_back(s);
+    }
+
+    void maskerSeek(MaskerSeek s) override {
+        maskerSeeks.push_back(s.seconds);
+    }
+
+    void clockModel(const EyeTrackerTargetPlayerClockModel &m) override {
+        clockModels.push_back(m);
+    }
+
+    std::vector<std::string> labels;
+    std::vector<std::string> values;
+    std::vector<std::string> thresholdTargets;
+    std::vector<double> thresholds;
+    std::vector<std::uintmax_t> targetStartTimes;
+    std::vector<RecordedTrial> trials;
+    BinocularGazeSamples gazeSamples;
+    std::vector<BinocularGazeStatistics> statistics;
+    std::vector<EyeTrackerTargetPlayerSynchronization> synchronizations;
+    std::vector<EyeTrackerTargetPlayerClockModel> clockModels;
+    std::vector<double> maskerSeeks;
+};
+
+auto fields(std::initializer_list<const char *> f) -> std::vector<std::string> {
+    return {f.begin(), f.end()};
+}
+
+class OutputFileParserTests : public ::testing::Test {
+  protected:
+    StringWriter writer;
+    OutputFilePathStub path;
+    OutputFileImpl file{writer, path};
+    ParseObserver observer;
+
+    void parseWritten() { parse(writer.written(), observer); }
+};
+
+#define OUTPUT_FILE_PARSER_TEST(a) TEST_F(OutputFileParserTests, a)
+
+OUTPUT_FILE_PARSER_TEST(parsesAdaptiveTestLabeledLines) {
+    AdaptiveTest test;
+    test.identity.subjectId = "a";
+    test.identity.session = "b";
+    test.targetsUrl.path = "c";
+    test.startingSnr.dB = 5;
+    file.write(test);
+    parseWritten();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"subject"}, observer.labels.at(0));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, observer.values.at(0));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"b"}, observer.values.at(2));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"starting SNR (dB)"}, observer.labels.at(9));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"5"}, observer.values.at(9));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"threshold reversals"}, observer.labels.back());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(observer.trials.empty());
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesTrialsWithoutRepeatedHeadings) {
+    coordinate_response_measure::AdaptiveTrial trial;
+    trial.snr.dB = -3;
+    trial.correctNumber = 1;
+    trial.subjectNumber = 2;
+    trial.correctColor = coordinate_response_measure::Color::blue;
+    trial.subjectColor = coordinate_response_measure::Color::red;
+    trial.correct = false;
+    trial.reversals = 4;
+    file.write(trial);
+    trial.correct = true;
+    file.write(trial);
+    parseWritten();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, observer.trials.size());
+    const auto &first{observer.trials.front()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        fields({"-3", "1", "2", "blue", "red", "incorrect", "4"}),
+        first.fields);
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(*first.correct);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(*observer.trials.back().correct);
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesFlaggedFreeResponseContainingDelimiter) {
+    FreeResponseTrial trial;
+    trial.time = "12:00";
+    trial.target = "a.wav";
+    trial.response = "yes, no";
+    trial.flagged = true;
+    file.write(trial);
+    parseWritten();
+    const auto &parsed{observer.trials.at(0)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        fields({"12:00", "a.wav", "yes, no"}), parsed.fields);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(parsed.flagged);
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(parsed.correct.has_value());
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesEveryTrialType) {
+    file.write(coordinate_response_measure::FixedLevelTrial{});
+    file.write(coordinate_response_measure::AdaptiveTrial{});
+    file.write(FreeResponseTrial{});
+    file.write(open_set::AdaptiveTrial{});
+    file.write(CorrectKeywordsTrial{});
+    file.write(ConsonantTrial{});
+    file.write(ThreeKeywordsTrial{});
+    file.write(SyllableTrial{});
+    file.write(KeyPressTrial{});
+    file.write(EmotionTrial{});
+    file.write(PassFailTrial{});
+    parseWritten();
+    using Type = OutputFileTrialType;
+    std::vector<Type> types;
+    for (const auto &trial : observer.trials)
+        types.push_back(trial.type);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        (std::vector<Type>{Type::fixedLevelCoordinateResponse,
+            Type::adaptiveCoordinateResponse, Type::freeResponse,
+            Type::openSetAdaptive, Type::correctKeywords, Type::consonant,
+            Type::threeKeywords, Type::syllable, Type::keyPress,
+            Type::emotion, Type::passFail}),
+        types);
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesGazeSamplesBetweenTrials) {
+    open_set::AdaptiveTrial trial;
+    trial.target = "a.wav";
+    file.write(trial);
+    BinocularGazeSamples samples(2);
+    samples.at(0).systemTime.microseconds = 1;
+    samples.at(0).left.position.relativeScreen = {0.25F, -1e-5F};
+    samples.at(0).right.origin.relativeTrackbox = {1, 2, 3};
+    samples.at(1).systemTime.microseconds = 2;
+    samples.at(1).right.position.valid = false;
+    file.write(samples);
+    trial.target = "b.wav";
+    file.write(trial);
+    parseWritten();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{2}, observer.gazeSamples.size());
+    const auto &first{observer.gazeSamples.front()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::int_least64_t{1}, first.systemTime.microseconds);
+    assertEqual(0.25F, first.left.position.relativeScreen.x);
+    assertEqual(-1e-5F, first.left.position.relativeScreen.y);
+    assertEqual(3.F, first.right.origin.relativeTrackbox.z);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(first.right.position.valid);
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(
+        observer.gazeSamples.back().right.position.valid);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, observer.trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"b.wav"}, observer.trials.back().fields.at(1));
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesSingleRowRecords) {
+    BinocularGazeStatistics statistics;
+    statistics.left.percentValid = 97.5;
+    statistics.right.meanRelativeScreen = {0.5F, 0.25F};
+    statistics.blinks = 3;
+    file.write(statistics);
+    EyeTrackerTargetPlayerSynchronization synchronization{};
+    synchronization.eyeTrackerSystemTime.microseconds = 7;
+    synchronization.targetPlayerSystemTime.nanoseconds = 8;
+    file.write(synchronization);
+    EyeTrackerTargetPlayerClockModel model;
+    model.reference.nanoseconds = 9;
+    model.driftPartsPerMillion = -1.5;
+    model.samples = 10;
+    file.write(model);
+    file.write(TargetStartTime{11});
+    parseWritten();
+    assertEqual(97.5, observer.statistics.at(0).left.percentValid, 1e-9);
+    assertEqual(0.25F, observer.statistics.at(0).right.meanRelativeScreen.y);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(3, observer.statistics.at(0).blinks);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::uintmax_t{8},
+        observer.synchronizations.at(0).targetPlayerSystemTime.nanoseconds);
+    assertEqual(-1.5, observer.clockModels.at(0).driftPartsPerMillion, 1e-9);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(10, observer.clockModels.at(0).samples);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::uintmax_t{11}, observer.targetStartTimes.at(0));
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(observer.trials.empty());
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesMaskerSeekExactly) {
+    file.write(MaskerSeek{0.1 + 0.2});
+    parseWritten();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0.1 + 0.2, observer.maskerSeeks.at(0));
+}
+
+OUTPUT_FILE_PARSER_TEST(skipsTrialPlanRows) {
+    TrialPlan plan;
+    plan.seed = 3;
+    plan.trials.push_back({{"a.wav"}, 0.25});
+    file.write(plan);
+    PassFailTrial trial;
+    trial.target = "b.wav";
+    file.write(trial);
+    parseWritten();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, observer.trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"b.wav"}, observer.trials.front().fields.at(0));
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesThresholds) {
+    AdaptiveTestResults results(2);
+    results.at(0).targetsUrl.path = "a: b";
+    results.at(0).threshold = -2.5;
+    results.at(1).targetsUrl.path = "c";
+    results.at(1).threshold = 3;
+    file.write(results);
+    parseWritten();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        (std::vector<std::string>{"a: b", "c"}), observer.thresholdTargets);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        (std::vector<double>{-2.5, 3}), observer.thresholds);
+}
+
+OUTPUT_FILE_PARSER_TEST(skipsRowsBeforeAnyHeading) {
+    parse("1, 2, 3\n\nnonsense\n", observer);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(observer.trials.empty());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(observer.labels.empty());
+}
+
+OUTPUT_FILE_PARSER_TEST(parsesMappedFilesInParallel) {
+    PassFailTrial trial;
+    trial.correct = true;
+    file.write(trial);
+    file.write(trial);
+    const auto directory{temporaryDirectory()};
+    std::filesystem::create_directories(directory);
+    std::vector<std::filesystem::path> files;
+    for (auto i{0}; i < 5; ++i) {
+        files.push_back(directory / (std::to_string(i) + ".txt"));
+        std::ofstream{files.back()} << writer.written();
+    }
+    files.push_back(directory / "empty.txt");
+    std::ofstream{files.back()};
+    std::vector<ParseObserver> observers(files.size());
+    parse(files,
+        [&](gsl::index i) -> OutputFileParseObserver & {
+            return observers.at(i);
+        },
+        3);
+    for (gsl::index i{0}; i < 5; ++i)
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+            std::size_t{2}, observers.at(i).trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(observers.back().trials.empty());
+    std::filesystem::remove_all(directory);
+}
+
+OUTPUT_FILE_PARSER_TEST(rethrowsFailureToMapFile) {
+    const std::vector<std::filesystem::path> files{"/does/not/exist"};
+    EXPECT_THROW(parse(files,
+                     [&](gsl::index) -> OutputFileParseObserver & {
+                         return observer;
+                     },
+                     2),
+        MappedFile::OpenFailure);
+}
+}
+}
@@ -0,0 +1,107 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/OutputFile.hpp>
+#include <av-speech-in-noise/core/OutputFileReplay.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+namespace av_speech_in_noise {
+namespace {
+class StringWriter : public Writer {
+  public:
+    void write(const std::string &s) override { written_ += s; }
+    void write(Writable &) override {}
+    void open(const std::string &) override {}
+    auto failed() -> bool override { return {}; }
+    void close() override {}
+    void save() override {}
+    [[nodiscard]] auto written() const -> const std::string & {
+        return written_;
+    }
+
+  private:
+    std::string written_;
+};
+
+class OutputFilePathStub : public OutputFilePath {
+  public:
+    auto generateFileName(const TestIdentity &) -> std::string override {
+        return {};
+    }
+    auto outputDirectory() -> std::string override { return {}; }
+    void setRelativeOutputDirectory(std::filesystem::path) override {}
+};
+
+class OutputFileReplayTests : public ::testing::Test {
+  protected:
+    StringWriter writer;
+    OutputFilePathStub path;
+    OutputFileImpl file{writer, path};
+    FixedLevelTest test;
+
+    OutputFileReplayTests() {
+        test.maskerFileUrl.path = "/masker.wav";
+        test.targetsUrl.path = "/targets";
+        test.maskerLevel.dB_SPL = 65;
+        test.snr.dB = -3;
+    }
+
+    void writeTrial(const std::string &target) {
+        FreeResponseTrial trial;
+        trial.target = target;
+        file.write(trial);
+    }
+
+    auto session() -> ReplayableSession {
+        return replayableSession(writer.written());
+    }
+};
+
+#define OUTPUT_FILE_REPLAY_TEST(a) TEST_F(OutputFileReplayTests, a)
+
+OUTPUT_FILE_REPLAY_TEST(readsMaskerAndLevels) {
+    file.write(test);
+    file.write(MaskerSeek{0.1 + 0.2});
+    writeTrial("a.wav");
+    const auto replayable{session()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"/masker.wav"}, replayable.masker.path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(65, replayable.maskerLevel.dB_SPL);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(-3, replayable.trials.at(0).snr.dB);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        0.1 + 0.2, replayable.trials.at(0).maskerSeekSeconds);
+}
+
+OUTPUT_FILE_REPLAY_TEST(resolvesBareTargetNamesAgainstTargets) {
+    file.write(test);
+    file.write(MaskerSeek{1});
+    writeTrial("a.wav");
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        (std::filesystem::path{"/targets"} / "a.wav").string(),
+        session().trials.at(0).target.path);
+}
+
+OUTPUT_FILE_REPLAY_TEST(keepsTargetPaths) {
+    file.write(test);
+    file.write(MaskerSeek{1});
+    writeTrial("/other/a.wav");
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"/other/a.wav"}, session().trials.at(0).target.path);
+}
+
+OUTPUT_FILE_REPLAY_TEST(skipsTrialsWithoutSeek) {
+    file.write(test);
+    writeTrial("a.wav");
+    file.write(MaskerSeek{2});
+    writeTrial("b.wav");
+    const auto replayable{session()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, replayable.trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, replayable.trials.at(0).trialNumber);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        2., replayable.trials.at(0).maskerSeekSeconds);
+}
+}
+}
@@ -4,9 +4,11 @@
 #include "LogString.hpp"
 
 #include <av-speech-in-noise/core/IOutputFile.hpp>
+#include <av-speech-in-noise/core/TrialPlan.hpp>
 
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace av_speech_in_noise {
 class OutputFileStub : public OutputFile {
@@ -46,6 +48,16 @@ class OutputFileStub : public OutputFile {
         fixedLevelTest_ = &p;
     }
 
+    void write(const TrialPlan &p) override {
+        addToLog("writeTrialPlan ");
+        trialPlan_ = p;
+    }
+
+    void write(const TrialPlanAmendment &p) override {
+        addToLog("writeTrialPlanAmendment ");
+        trialPlanAmendments_.push_back(p);
+    }
+
     void write(const FreeResponseTrial &p) override {
         addToLog("writeTrial ");
         freeResponseTrial_ = p;
@@ -107,8 +119,25 @@ class OutputFileStub : public OutputFile {
         eyeTrackerTargetPlayerSynchronization_ = e;
     }
 
+    void write(const EyeTrackerTargetPlayerClockModel &m) override {
+        addToLog("writeClockModel ");
+        eyeTrackerTargetPlayerClockModel_ = m;
+    }
+
     void write(const BinocularGazeSamples &g) override { eyeGazes_ = g; }
 
+    void write(const BinocularGazeStatistics &s) override {
+        addToLog("writeGazeStatistics ");
+        gazeStatistics_ = s;
+    }
+
+    void write(MaskerSeek s) override {
+        addToLog("writeMaskerSeek ");
+        maskerSeek_ = s;
+    }
+
+    auto maskerSeek() const -> MaskerSeek { return maskerSeek_; }
+
     void write(TargetStartTime t) override {
         targetStartTimeNanoseconds_ = t.nanoseconds;
         targetStartTime_ = t;
@@ -133,8 +162,19 @@ class OutputFileStub : public OutputFile {
         return fixedLevelTest_;
     }
 
+    auto trialPlan() const -> const TrialPlan & { return trialPlan_; }
+
+    auto trialPlanAmendments() const
+        -> const std::vector<TrialPlanAmendment> & {
+        return trialPlanAmendments_;
+    }
+
     auto eyeGazes() const -> BinocularGazeSamples { return eyeGazes_; }
 
+    auto gazeStatistics() const -> const BinocularGazeStatistics & {
+        return gazeStatistics_;
+    }
+
     auto targetStartTimeNanoseconds() const -> std::uintmax_t {
         return targetStartTimeNanoseconds_;
     }
@@ -144,6 +184,11 @@ class OutputFileStub : public OutputFile {
         return eyeTrackerTargetPlayerSynchronization_;
     }
 
+    auto eyeTrackerTargetPlayerClockModel() const
+        -> const EyeTrackerTargetPlayerClockModel & {
+        return eyeTrackerTargetPlayerClockModel_;
+    }
+
     auto fadeInCompleteConvertedAudioSampleSystemTimeNanoseconds() const
         -> std::uintmax_t {
         return fadeInCompleteConvertedAudioSampleSystemTimeNanoseconds_;
@@ -199,17 +244,22 @@ class OutputFileStub : public OutputFile {
     SyllableTrial syllableTrial_{};
     open_set::AdaptiveTrial openSetAdaptiveTrial_{};
     BinocularGazeSamples eyeGazes_;
+    BinocularGazeStatistics gazeStatistics_{};
+    EyeTrackerTargetPlayerClockModel eyeTrackerTargetPlayerClockModel_{};
     AdaptiveTestResults adaptiveTestResult_{};
     std::stringstream log_{};
     std::filesystem::path parentPath_;
     EyeTrackerTargetPlayerSynchronization
         eyeTrackerTargetPlayerSynchronization_{};
     TargetStartTime targetStartTime_{};
+    MaskerSeek maskerSeek_{};
     std::uintmax_t fadeInCompleteConvertedAudioSampleSystemTimeNanoseconds_{};
     std::uintmax_t targetStartTimeNanoseconds_{};
     gsl::index fadeInCompleteAudioSampleOffset_{};
     const AdaptiveTest *adaptiveTest_{};
     const FixedLevelTest *fixedLevelTest_{};
+    TrialPlan trialPlan_{};
+    std::vector<TrialPlanAmendment> trialPlanAmendments_;
     const TestIdentity *openNewFileParameters_{};
     bool throwOnOpen_{};
 };
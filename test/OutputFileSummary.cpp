@@ -0,0 +1,179 @@
+#include "TemporaryDirectory.hpp"
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/OutputFile.hpp>
+#include <av-speech-in-noise/core/OutputFileSummary.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace av_speech_in_noise {
+namespace {
+class StringWriter : public Writer {
+  public:
+    void write(const std::string &s) override { written_ += s; }
+    void write(Writable &) override {}
+    void open(const std::string &) override {}
+    auto failed() -> bool override { return {}; }
+    void close() override {}
+    void save() override {}
+    [[nodiscard]] auto written() const -> const std::string & {
+        return written_;
+    }
+
+  private:
+    std::string written_;
+};
+
+class OutputFilePathStub : public OutputFilePath {
+  public:
+    auto generateFileName(const TestIdentity &) -> std::string override {
+        return {};
+    }
+    auto outputDirectory() -> std::string override { return {}; }
+    void setRelativeOutputDirectory(std::filesystem::path) override {}
+};
+
+class OutputFileSummaryTests : public ::testing::Test {
+  protected:
+    StringWriter writer;
+    OutputFilePathStub path;
+    OutputFileImpl file{writer, path};
+
+    void writeFixedLevelTest() {
+        FixedLevelTest test;
+        test.identity.subjectId = "a";
+        test.identity.session = "b";
+        test.identity.method = "c";
+        file.write(test);
+    }
+
+    void writePassFailTrial(bool correct) {
+        PassFailTrial trial;
+        trial.correct = correct;
+        file.write(trial);
+    }
+
+    void writeKeyPressTrial(double milliseconds) {
+        KeyPressTrial trial;
+        trial.rt.milliseconds = milliseconds;
+        file.write(trial);
+    }
+};
+
+#define OUTPUT_FILE_SUMMARY_TEST(a) TEST_F(OutputFileSummaryTests, a)
+
+OUTPUT_FILE_SUMMARY_TEST(summarizesIdentityAndPercentCorrect) {
+    writeFixedLevelTest();
+    writePassFailTrial(true);
+    writePassFailTrial(false);
+    writePassFailTrial(true);
+    writePassFailTrial(true);
+    const auto summary{summarize(writer.written()).front()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, summary.subjectId);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"b"}, summary.session);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"c"}, summary.method);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{4}, summary.evaluatedTrials);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{3}, summary.correctTrials);
+}
+
+OUTPUT_FILE_SUMMARY_TEST(summarizesEachTestOfFileSeparately) {
+    AdaptiveTest adaptive;
+    adaptive.identity.subjectId = "a";
+    file.write(adaptive);
+    writePassFailTrial(false);
+    writePassFailTrial(false);
+    writeFixedLevelTest();
+    writePassFailTrial(true);
+    writePassFailTrial(true);
+    writePassFailTrial(false);
+    const auto summaries{summarize(writer.written())};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, summaries.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        gsl::index{0}, summaries.at(0).correctTrials);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{2}, summaries.at(0).trials);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        gsl::index{2}, summaries.at(1).correctTrials);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{3}, summaries.at(1).trials);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"c"}, summaries.at(1).method);
+}
+
+OUTPUT_FILE_SUMMARY_TEST(totalsKeywords) {
+    CorrectKeywordsTrial correctKeywords;
+    correctKeywords.count = 2;
+    file.write(correctKeywords);
+    correctKeywords.count = 3;
+    file.write(correctKeywords);
+    ThreeKeywordsTrial threeKeywords;
+    threeKeywords.firstCorrect = true;
+    threeKeywords.thirdCorrect = true;
+    file.write(threeKeywords);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        7, summarize(writer.written()).front().keywordsCorrect);
+}
+
+OUTPUT_FILE_SUMMARY_TEST(collectsReactionTimes) {
+    writeKeyPressTrial(100);
+    writeKeyPressTrial(300);
+    EmotionTrial emotion;
+    emotion.reactionTimeMilliseconds = 200;
+    file.write(emotion);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL((std::vector<double>{100, 300, 200}),
+        summarize(writer.written()).front().reactionTimesMilliseconds);
+}
+
+OUTPUT_FILE_SUMMARY_TEST(collectsThresholdsPerList) {
+    AdaptiveTestResults results(2);
+    results.at(0).targetsUrl.path = "x";
+    results.at(0).threshold = -1;
+    results.at(1).targetsUrl.path = "y";
+    results.at(1).threshold = 2;
+    file.write(results);
+    const auto summary{summarize(writer.written()).front()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, summary.thresholds.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"y"}, summary.thresholds.at(1).targetsUrl.path);
+    assertEqual(2., summary.thresholds.at(1).threshold, 1e-9);
+}
+
+OUTPUT_FILE_SUMMARY_TEST(writesOneRowPerFile) {
+    writeFixedLevelTest();
+    writePassFailTrial(true);
+    writePassFailTrial(false);
+    writeKeyPressTrial(100);
+    writeKeyPressTrial(200);
+    writeKeyPressTrial(600);
+    auto summary{summarize(writer.written()).front()};
+    summary.file = "f.txt";
+    std::stringstream stream;
+    writeSummaryTable(stream, {summary});
+    std::string heading;
+    std::getline(stream, heading);
+    std::string row;
+    std::getline(stream, row);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"f.txt\ta\tb\tc\t5\t50\t0\t3\t300\t200\t264.575\t"}, row);
+}
+
+OUTPUT_FILE_SUMMARY_TEST(summarizesTextFilesBelowDirectory) {
+    writeFixedLevelTest();
+    writePassFailTrial(true);
+    const auto directory{temporaryDirectory()};
+    std::filesystem::create_directories(directory / "nested");
+    std::ofstream{directory / "1.txt"} << writer.written();
+    std::ofstream{directory / "nested" / "2.txt"} << writer.written();
+    std::ofstream{directory / "results-index.tsv"} << "test\n";
+    const auto summaries{summarize(directory, 2)};
+    std::filesystem::remove_all(directory);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, summaries.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        directory / "nested" / "2.txt", summaries.at(1).file);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"a"}, summaries.at(1).subjectId);
+}
+}
+}
@@ -0,0 +1,65 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/PathTable.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+namespace av_speech_in_noise {
+namespace {
+class PathTableTests : public ::testing::Test {
+  protected:
+    PathTable table;
+};
+
+#define PATH_TABLE_TEST(a) TEST_F(PathTableTests, a)
+
+void assertPartsMatchFilesystem(const std::string &path) {
+    const std::filesystem::path expected{path};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        expected.filename().string(), std::string{fileName(path)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        expected.stem().string(), std::string{stem(path)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        expected.parent_path().string(), std::string{parentPath(path)});
+}
+
+PATH_TABLE_TEST(partsMatchFilesystem) {
+    for (const auto *path : {"/Users/user/a.wav", "a.wav", "/a.wav",
+             "/Users/user/a.b.wav", "/Users/user/.hidden", "/Users/user/",
+             "a", "", "/", "/Users//user/..", "C:/a"})
+        assertPartsMatchFilesystem(path);
+}
+
+PATH_TABLE_TEST(joinsAsFilesystemDoes) {
+    for (const auto &[directory, file] :
+        {std::pair{"C:", "a.wav"}, {"/Users/user/", "a.wav"},
+            {"", "a.wav"}, {"/Users/user", "/b/a.wav"}, {"C:", ""}}) {
+        const auto h{table.add(directory, file)};
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+            (std::filesystem::path{directory} / file).string(),
+            std::string{table.path(h)});
+    }
+}
+
+PATH_TABLE_TEST(splitsEachPath) {
+    table.add("/Users/user", "a.wav");
+    const auto h{table.add("/Users/user", "b.c.wav")};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"b.c.wav"}, std::string{table.fileName(h)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"b.c"}, std::string{table.stem(h)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"/Users/user/a.wav"}, std::string{table.path(0)});
+}
+
+PATH_TABLE_TEST(clearEmpties) {
+    table.add("a", "b");
+    table.clear();
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(table.empty());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{0}, table.size());
+}
+}
+}
@@ -137,6 +137,23 @@ TEST_F(PredeterminedTargetPlaylistTests, reinsertCurrentRevisitsAtTheEnd) {
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL("/Users/user/b.wav", playlist.next().path);
 }
 
+TEST_F(PredeterminedTargetPlaylistTests, drainsLargePlaylistWithRetries) {
+    std::string contents;
+    for (auto i{0}; i < 100000; ++i)
+        contents += "/Users/user/" + std::to_string(i) + ".wav\n";
+    fileReader.setContents(contents);
+    playlist.load({});
+    auto played{0};
+    while (!playlist.empty()) {
+        playlist.next();
+        if (played++ % 2 == 0 && played < 100000)
+            playlist.reinsertCurrent();
+    }
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(150000, played);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        "/Users/user/99998.wav", playlist.current().path);
+}
+
 TEST_F(PredeterminedTargetPlaylistTests, directoryIsThatOfCurrentTarget) {
     fileReader.setContents(R"(/Users/user/1/a.wav
 /Users/user/2/b.wav
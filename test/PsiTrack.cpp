@@ -0,0 +1,99 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/PsiTrack.hpp>
+#include <av-speech-in-noise/core/PsychometricFunction.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+
+namespace av_speech_in_noise {
+namespace {
+class PsiTrackTests : public ::testing::Test {
+  protected:
+    Track::Settings settings{};
+    PsiTrackParameters parameters;
+
+    PsiTrackTests() {
+        settings.startingX = 0;
+        settings.ceiling = 20;
+        settings.floor = -40;
+    }
+
+    auto track() -> PsiTrack { return PsiTrack{settings, parameters}; }
+};
+
+#define PSI_TRACK_TEST(a) TEST_F(PsiTrackTests, a)
+
+PSI_TRACK_TEST(startsAtStartingX) {
+    settings.startingX = 5;
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(5, track().x());
+}
+
+PSI_TRACK_TEST(completesAfterTrials) {
+    parameters.trials = 3;
+    auto psi{track()};
+    psi.down();
+    psi.up();
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(psi.complete());
+    psi.down();
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(psi.complete());
+}
+
+PSI_TRACK_TEST(correctResponsesLowerX) {
+    auto psi{track()};
+    psi.down();
+    psi.down();
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(psi.x() < 0);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(psi.threshold(0) < -10);
+}
+
+PSI_TRACK_TEST(staysWithinFloorAndCeiling) {
+    auto psi{track()};
+    for (auto i{0}; i < 10; ++i) {
+        psi.up();
+        AV_SPEECH_IN_NOISE_EXPECT_TRUE(psi.x() <= 20);
+    }
+    psi.reset();
+    for (auto i{0}; i < 10; ++i) {
+        psi.down();
+        AV_SPEECH_IN_NOISE_EXPECT_TRUE(psi.x() >= -40);
+    }
+}
+
+PSI_TRACK_TEST(resetRestoresPrior) {
+    auto psi{track()};
+    const auto prior{psi.threshold(0)};
+    psi.down();
+    psi.up();
+    psi.reset();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, psi.x());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, psi.reversals());
+    assertEqual(prior, psi.threshold(0), 1e-9);
+}
+
+PSI_TRACK_TEST(estimatesListenerThreshold) {
+    parameters.trials = 60;
+    PsychometricFunction listener;
+    listener.threshold = -12;
+    listener.slope = 0.4;
+    listener.lapseRate = 0.02;
+    std::mt19937 engine{1};
+    std::uniform_real_distribution<> uniform;
+    auto psi{track()};
+    while (!psi.complete())
+        if (uniform(engine) < probabilityCorrect(listener, psi.x()))
+            psi.down();
+        else
+            psi.up();
+    assertEqual(-12., psi.threshold(0), 3.);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(psi.reversals() > 0);
+}
+
+PSI_TRACK_TEST(requiresFloorAndCeiling) {
+    settings.ceiling = maximumInt;
+    EXPECT_THROW(track(), std::runtime_error);
+}
+}
+}
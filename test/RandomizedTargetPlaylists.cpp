@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace av_speech_in_noise {
 static auto operator==(const LocalUrl &a, const LocalUrl &b) -> bool {
@@ -35,15 +37,30 @@ class RandomizerStub : public target_list::Randomizer {
         std::rotate(s.begin(), s.begin() + rotateToTheLeft_, s.end());
     }
 
+    auto betweenInclusive(int a, int b) -> int override {
+        lowerIntBound_ = a;
+        upperIntBound_ = b;
+        return a + intOffset_;
+    }
+
     void rotateToTheLeft(int N) { rotateToTheLeft_ = N; }
 
+    void setIntOffset(int x) { intOffset_ = x; }
+
     auto shuffledCount() -> gsl::index { return shuffledCount_; }
 
+    [[nodiscard]] auto lowerIntBound() const -> int { return lowerIntBound_; }
+
+    [[nodiscard]] auto upperIntBound() const -> int { return upperIntBound_; }
+
   private:
     std::vector<av_speech_in_noise::LocalUrl> shuffledStrings_;
     std::vector<int> shuffledInts_;
     gsl::index shuffledCount_{};
     int rotateToTheLeft_{};
+    int intOffset_{};
+    int lowerIntBound_{};
+    int upperIntBound_{};
 };
 
 void loadFromDirectory(TargetPlaylist &list, const std::string &s = {}) {
@@ -316,12 +333,12 @@ EACH_TARGET_PLAYED_ONCE_THEN_SHUFFLE_AND_REPEAT_TEST(
     currentReturnsEmptyIfNoFiles(list, reader);
 }
 
-RANDOMIZED_TARGET_PLAYLIST_WITH_REPLACEMENT_TEST(
-    nextShufflesNextSetNotIncludingCurrent) {
+RANDOMIZED_TARGET_PLAYLIST_WITH_REPLACEMENT_TEST(nextDrawsFromAllButCurrent) {
     setFileNames(reader, {{"a"}, {"b"}, {"c"}, {"d"}});
     loadFromDirectory(list);
     next(list);
-    assertShuffled(randomizer, {{"b"}, {"c"}, {"d"}});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, randomizer.lowerIntBound());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, randomizer.upperIntBound());
 }
 
 EACH_TARGET_PLAYED_ONCE_THEN_SHUFFLE_AND_REPEAT_TEST(
@@ -337,13 +354,19 @@ EACH_TARGET_PLAYED_ONCE_THEN_SHUFFLE_AND_REPEAT_TEST(
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{2}, randomizer.shuffledCount());
 }
 
-RANDOMIZED_TARGET_PLAYLIST_WITH_REPLACEMENT_TEST(
-    nextReplacesSecondToLastTarget) {
+RANDOMIZED_TARGET_PLAYLIST_WITH_REPLACEMENT_TEST(nextSkipsOverCurrent) {
     setFileNames(reader, {{"a"}, {"b"}, {"c"}, {"d"}, {"e"}});
-    loadFromDirectory(list);
-    next(list);
-    next(list);
-    assertShuffled(randomizer, {{"c"}, {"d"}, {"e"}, {"a"}});
+    loadFromDirectory(list, "C:");
+    randomizer.setIntOffset(3);
+    assertNextEquals(list, "C:/d");
+    assertNextEquals(list, "C:/c");
+}
+
+RANDOMIZED_TARGET_PLAYLIST_WITH_REPLACEMENT_TEST(nextRepeatsOnlyFile) {
+    setFileNames(reader, {{"a"}});
+    loadFromDirectory(list, "C:");
+    assertNextEquals(list, "C:/a");
+    assertNextEquals(list, "C:/a");
 }
 
 RANDOMIZED_TARGET_PLAYLIST_WITHOUT_REPLACEMENT_TEST(
@@ -441,6 +464,77 @@ TEST_F(RandomizedTargetPlaylistWithReplacementFailureTests,
     assertNextEquals(list, "");
 }
 
+auto draws(target_list::Randomizer &randomizer) -> std::vector<int> {
+    std::vector<int> v(8);
+    std::generate(v.begin(), v.end(),
+        [&] { return randomizer.betweenInclusive(0, 1000000); });
+    return v;
+}
+
+auto nextEight(TargetPlaylistFactory &factory) -> std::vector<std::string> {
+    auto list{factory.make()};
+    list->load({"C:"});
+    std::vector<std::string> v(8);
+    std::generate(v.begin(), v.end(), [&] { return next(*list); });
+    return v;
+}
+
+TEST(SeededRandomizerTests, sameSeedAndStreamDrawSameValues) {
+    target_list::SeededRandomizer a{1, 2};
+    target_list::SeededRandomizer b{1, 2};
+    EXPECT_EQ(draws(a), draws(b));
+}
+
+TEST(SeededRandomizerTests, streamsDrawDifferentValues) {
+    target_list::SeededRandomizer a{1, 2};
+    target_list::SeededRandomizer b{1, 3};
+    EXPECT_NE(draws(a), draws(b));
+}
+
+TEST(SeededRandomizerTests, seededFactoriesMakeSameSequenceOfLists) {
+    DirectoryReaderStub reader;
+    setFileNames(reader, {{"a"}, {"b"}, {"c"}, {"d"}, {"e"}});
+    RandomizedTargetPlaylistWithReplacement::Factory first{&reader, 7};
+    RandomizedTargetPlaylistWithReplacement::Factory second{&reader, 7};
+    const auto firstList{nextEight(first)};
+    EXPECT_EQ(firstList, nextEight(second));
+    EXPECT_EQ(nextEight(first), nextEight(second));
+}
+
+TEST(SeededRandomizerTests, seededListsDrawSameTargets) {
+    DirectoryReaderStub reader;
+    setFileNames(reader, {{"a"}, {"b"}, {"c"}, {"d"}, {"e"}});
+    RandomizerStub randomizer;
+    RandomizedTargetPlaylistWithReplacement first{&reader, &randomizer};
+    RandomizedTargetPlaylistWithReplacement second{&reader, &randomizer};
+    first.seed(7);
+    second.seed(7);
+    first.load({"C:"});
+    second.load({"C:"});
+    std::vector<std::string> firstTargets(8);
+    std::vector<std::string> secondTargets(8);
+    std::generate(firstTargets.begin(), firstTargets.end(),
+        [&] { return next(first); });
+    std::generate(secondTargets.begin(), secondTargets.end(),
+        [&] { return next(second); });
+    EXPECT_EQ(firstTargets, secondTargets);
+    EXPECT_EQ(0, randomizer.shuffledCount());
+    EXPECT_EQ(0, randomizer.upperIntBound());
+}
+
+TEST(TargetQueueTests, playsReinsertedTargetsAfterRemainingOnes) {
+    TargetQueue queue;
+    queue.assign({{"a"}, {"b"}, {"c"}});
+    std::vector<std::string> played;
+    for (int i{0}; i < 100; ++i) {
+        played.push_back(queue.next().path);
+        queue.reinsert({played.back()});
+    }
+    EXPECT_EQ("b", played.at(1));
+    EXPECT_EQ("a", played.at(99));
+    EXPECT_FALSE(queue.empty());
+}
+
 auto filesIn(DirectoryReader &reader, const LocalUrl &directory = {})
     -> std::vector<av_speech_in_noise::LocalUrl> {
     return reader.filesIn(directory);
@@ -525,6 +619,18 @@ TEST_F(FileExtensionFilterTests, returnsFilteredFiles) {
         filter(decorator, {{"a"}, {"b.c"}, {"d.e"}, {"f.c"}, {"g.h"}}));
 }
 
+TEST_F(FileExtensionFilterTests, returnsEachFileOnceWhenSeveralMatch) {
+    auto decorator = construct({".c", "b.c", ".c"});
+    assertEqual({{"b.c"}, {"f.c"}},
+        filter(decorator, {{"a"}, {"b.c"}, {"d.e"}, {"f.c"}}));
+}
+
+TEST_F(FileExtensionFilterTests, matchesExtensionsOfDifferentLengths) {
+    auto decorator = construct({".mp4", ".c", ".wav"});
+    assertEqual({{"a.wav"}, {"b.c"}, {"d.mp4"}},
+        filter(decorator, {{"a.wav"}, {"b.c"}, {"c"}, {"d.mp4"}, {"wav"}}));
+}
+
 class FileIdentifierFilterTests : public ::testing::Test {
   protected:
     static auto construct(std::string indentifier = {})
@@ -562,6 +668,23 @@ TEST_F(
         filter(decorator, {{"ax.j"}, {"b1.c"}, {"d.e"}, {"fx2.c"}, {"g3.h"}}));
 }
 
+TEST_F(FileIdentifierExcluderFilterTests,
+    excludesIdentifiersOfDifferentLengths) {
+    auto decorator = construct({"100", "2"});
+    assertEqual({{"a100b.wav"}, {"c.wav"}},
+        filter(decorator,
+            {{"a100b.wav"}, {"a100.wav"}, {"b2.wav"}, {"c.wav"}, {"d2"}}));
+}
+
+TEST(FileMatcherPipelineTests, keepsFilesEveryMatcherAccepts) {
+    FileExtensionFilter extensions{{".wav", ".mp4"}};
+    FileIdentifierExcluderFilter excluder{{"100", "200"}};
+    FileMatcherPipeline pipeline{{&extensions, &excluder}};
+    assertEqual({{"a.wav"}, {"d.mp4"}},
+        filter(pipeline,
+            {{"a.wav"}, {"b100.wav"}, {"c.txt"}, {"d.mp4"}, {"e200.mp4"}}));
+}
+
 class RandomSubsetFilesTests : public ::testing::Test {
   protected:
     RandomizerStub randomizer;
@@ -1,5 +1,6 @@
 #include "assert-utility.hpp"
 
+#include <av-speech-in-noise/core/PathTable.hpp>
 #include <av-speech-in-noise/core/ResponseEvaluator.hpp>
 
 #include <gtest/gtest.h>
@@ -9,7 +10,7 @@
 namespace av_speech_in_noise::coordinate_response_measure {
 static auto correct(
     ResponseEvaluatorImpl &evaluator, std::string_view s, Response r) -> bool {
-    return evaluator.correct(LocalUrl{std::string{s}}, r);
+    return evaluator.correct(stem(s), r);
 }
 
 static void assertIncorrect(
@@ -78,15 +79,6 @@ COORDINATE_RESPONSE_EVALUATOR_TEST(invalidFormatIsAlwaysIncorrect) {
         evaluator, "/", {ResponseEvaluatorImpl::invalidNumber, Color::unknown});
 }
 
-COORDINATE_RESPONSE_EVALUATOR_TEST(fileNameReturnsEverythingAfterFinalSlash) {
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"b"}, evaluator.fileName({"a/b"}));
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, evaluator.fileName({"a"}));
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"c.txt"}, evaluator.fileName({"a/b/c.txt"}));
-}
-
 COORDINATE_RESPONSE_EVALUATOR_TEST(onlyEvaluatesFirstPartOfFileName) {
     assertCorrect(evaluator, "blue2_3.mov", {2, Color::blue});
     assertCorrect(evaluator, "a/blue2_3.mov", {2, Color::blue});
@@ -100,5 +92,27 @@ COORDINATE_RESPONSE_EVALUATOR_TEST(miscellaneous) {
     assertIncorrect(evaluator, "a/b/c/blue9-3.mov", {3, Color::blue});
     assertIncorrect(evaluator, "a/b/c/red8 4.mov", {4, Color::red});
 }
+
+static void assertParsed(std::string_view stem, Response expected) {
+    const auto actual{parseCoordinateResponseTarget(stem)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(expected.number, actual.number);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(expected.color, actual.color);
+}
+
+TEST(CoordinateResponseTargetParserTests, parsesLeadingColorAndFirstDigit) {
+    assertParsed("blue2_3", {2, Color::blue});
+    assertParsed("white9", {9, Color::white});
+}
+
+TEST(CoordinateResponseTargetParserTests, numberNeedNotFollowColor) {
+    assertParsed("red-a4", {4, Color::red});
+    assertParsed("Red4", {4, Color::unknown});
+}
+
+TEST(CoordinateResponseTargetParserTests, missingPartsAreInvalid) {
+    assertParsed("", {ResponseEvaluatorImpl::invalidNumber, Color::unknown});
+    assertParsed("green", {ResponseEvaluatorImpl::invalidNumber, Color::green});
+    assertParsed("7", {7, Color::unknown});
+}
 }
 }
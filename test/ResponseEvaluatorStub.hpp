@@ -3,28 +3,27 @@
 
 #include <av-speech-in-noise/core/IResponseEvaluator.hpp>
 
-#include <utility>
+#include <string>
+#include <string_view>
 
 namespace av_speech_in_noise {
 class ResponseEvaluatorStub : public ResponseEvaluator {
   public:
-    void setFileName(std::string s) { fileName_ = std::move(s); }
-
     void setCorrectNumber(int x) { correctNumber_ = x; }
 
     void setCorrectColor(coordinate_response_measure::Color c) {
         correctColor_ = c;
     }
 
-    [[nodiscard]] auto correctNumberFilePath() const {
-        return correctNumberFilePath_;
+    [[nodiscard]] auto correctNumberStem() const {
+        return correctNumberStem_;
     }
 
-    [[nodiscard]] auto correctColorFilePath() const {
-        return correctColorFilePath_;
+    [[nodiscard]] auto correctColorStem() const {
+        return correctColorStem_;
     }
 
-    [[nodiscard]] auto correctFilePath() const { return correctTarget_; }
+    [[nodiscard]] auto correctStem() const { return correctStem_; }
 
     [[nodiscard]] auto response() const { return response_; }
 
@@ -32,39 +31,28 @@ class ResponseEvaluatorStub : public ResponseEvaluator {
 
     void setIncorrect() { correct_ = false; }
 
-    auto correct(const LocalUrl &target,
+    auto correct(std::string_view targetStem,
         const coordinate_response_measure::Response &p) -> bool override {
-        correctTarget_ = target.path;
+        correctStem_ = targetStem;
         response_ = &p;
         return correct_;
     }
 
-    auto correctColor(const LocalUrl &filePath)
+    auto correctColor(std::string_view targetStem)
         -> coordinate_response_measure::Color override {
-        correctColorFilePath_ = filePath.path;
+        correctColorStem_ = targetStem;
         return correctColor_;
     }
 
-    auto correctNumber(const LocalUrl &filePath) -> int override {
-        correctNumberFilePath_ = filePath.path;
+    auto correctNumber(std::string_view targetStem) -> int override {
+        correctNumberStem_ = targetStem;
         return correctNumber_;
     }
 
-    auto fileName(const LocalUrl &filePath) -> std::string override {
-        filePathForFileName_ = filePath.path;
-        return fileName_;
-    }
-
-    [[nodiscard]] auto filePathForFileName() const {
-        return filePathForFileName_;
-    }
-
   private:
-    std::string correctTarget_;
-    std::string correctNumberFilePath_;
-    std::string correctColorFilePath_;
-    std::string fileName_;
-    std::string filePathForFileName_;
+    std::string correctStem_;
+    std::string correctNumberStem_;
+    std::string correctColorStem_;
     const coordinate_response_measure::Response *response_{};
     int correctNumber_{};
     coordinate_response_measure::Color correctColor_{};
@@ -0,0 +1,380 @@
+#include "OutputFileStub.hpp"
+#include "TemporaryDirectory.hpp"
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/IndexedOutputFile.hpp>
+#include <av-speech-in-noise/core/ResultsStore.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace av_speech_in_noise {
+namespace {
+auto testRecord(std::string subject, std::string session, std::string method)
+    -> TestRecord {
+    TestRecord record;
+    record.identity.subjectId = std::move(subject);
+    record.identity.session = std::move(session);
+    record.identity.method = std::move(method);
+    return record;
+}
+
+auto trialRecord(std::string test, std::optional<bool> correct)
+    -> TrialRecord {
+    TrialRecord record;
+    record.test = std::move(test);
+    record.target = "a.wav";
+    record.correct = correct;
+    return record;
+}
+
+auto query(std::string subject, std::string session = {},
+    std::string method = {}) -> ResultsQuery {
+    return ResultsQuery{
+        std::move(subject), std::move(session), std::move(method)};
+}
+
+class ResultsStoreTests : public ::testing::Test {
+  protected:
+    ResultsStore store;
+};
+
+#define RESULTS_STORE_TEST(a) TEST_F(ResultsStoreTests, a)
+
+RESULTS_STORE_TEST(queriesTestsBySubjectSessionAndMethod) {
+    store.add(testRecord("a", "1", "x"));
+    store.add(testRecord("b", "1", "x"));
+    store.add(testRecord("a", "2", "y"));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{2}, store.tests(query("a")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{2}, store.tests(query("", "1")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, store.tests(query("a", "", "y")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{0}, store.tests(query("c")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{3}, store.tests({}).size());
+}
+
+RESULTS_STORE_TEST(computesPercentCorrectOverEvaluatedTrialsOfMatchingTests) {
+    const auto a{store.add(testRecord("a", "1", "x"))};
+    const auto b{store.add(testRecord("b", "1", "x"))};
+    store.add(trialRecord(a, true));
+    store.add(trialRecord(a, false));
+    store.add(trialRecord(a, std::nullopt));
+    store.add(trialRecord(a, true));
+    store.add(trialRecord(b, false));
+    assertEqual(200. / 3, store.percentCorrect(query("a")), 1e-9);
+    assertEqual(50., store.percentCorrect({}), 1e-9);
+}
+
+RESULTS_STORE_TEST(roundTripsRecordsThroughStream) {
+    auto test{testRecord("a\tb", "1", "x")};
+    test.targetsUrl.path = "/targets";
+    test.maskerLevel.dB_SPL = 65;
+    test.condition = Condition::audioVisual;
+    test.startingSnr = SNR{-6};
+    test.trackingRule = {{2, 4, 1, 1}, {6, 2, 2, 1}};
+    const auto id{store.add(test)};
+    auto trial{trialRecord(id, false)};
+    trial.reactionTimeMilliseconds = 123.5;
+    trial.snr_dB = -8;
+    store.add(trial);
+    ThresholdRecord threshold;
+    threshold.test = id;
+    threshold.targetsUrl.path = "/targets/1";
+    threshold.threshold = -4.25;
+    store.add(threshold);
+    std::stringstream stream;
+    store.writeNewRecords(stream);
+
+    ResultsStore read;
+    read.read(stream);
+    const auto tests{read.tests(query("a b"))};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, tests.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"/targets"}, tests.front().targetsUrl.path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(65, tests.front().maskerLevel.dB_SPL);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        tests.front().condition == Condition::audioVisual);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(-6, tests.front().startingSnr.dB);
+    const auto &rule{tests.front().trackingRule};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, rule.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(6, rule.at(1).runCount);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, rule.at(1).stepSize);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2, rule.at(1).down);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, rule.at(1).up);
+    const auto trials{read.trials({})};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(*trials.front().correct);
+    assertEqual(123.5, *trials.front().reactionTimeMilliseconds, 1e-9);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(-8, *trials.front().snr_dB);
+    const auto thresholds{read.thresholds({})};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, thresholds.size());
+    assertEqual(-4.25, thresholds.front().threshold, 1e-9);
+}
+
+RESULTS_STORE_TEST(writesOnlyRecordsNotYetWritten) {
+    store.add(testRecord("a", "1", "x"));
+    std::stringstream first;
+    store.writeNewRecords(first);
+    store.add(testRecord("b", "1", "x"));
+    std::stringstream second;
+    store.writeNewRecords(second);
+    ResultsStore read;
+    read.read(second);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, read.tests({}).size());
+}
+
+RESULTS_STORE_TEST(rejectsAndReportsMalformedAndDanglingRecords) {
+    std::stringstream stream{"test\tx1\ta\tt\t1\tx\t\t\t60\t"
+                             "audio-visual\t0\t\n"
+                             "test\tx2\ta\tt\n"
+                             "trial\tx2\ta.wav\t1\t\t\n"
+                             "bogus\n"
+                             "test\tx1\tb\tt\t1\tx\t\t\t60\t"
+                             "audio-visual\t0\t\n"
+                             "threshold\tx1\t/t\tnope\n"
+                             "trial\tx1\ta.wav\t1\t\t\n"};
+    store.read(stream);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, store.tests({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, store.trials({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{5}, store.malformed().size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"test\tx2\ta\tt"}, store.malformed().front());
+}
+
+RESULTS_STORE_TEST(rejectsFieldsWithTrailingCharacters) {
+    std::stringstream stream{"test\tx1\ta\tt\t1\tx\t\t\t60\t"
+                             "audio-visual\t0\t\n"
+                             "test\tx2\ta\tt\t1\tx\t\t\t60x\t"
+                             "audio-visual\t0\t\n"
+                             "test\tx3\ta\tt\t1\tx\t\t\t60\t"
+                             "visual\t0\t\n"
+                             "test\tx4\ta\tt\t1\tx\t\t\t60\t"
+                             "audio-visual\t0\t1 2\n"
+                             "trial\tx1\ta.wav\t1\t1.5x\t\n"
+                             "trial\tx1\ta.wav\tyes\t\t\n"
+                             "trial\tx1\ta.wav\t1\t\t-2.5\n"
+                             "threshold\tx1\t/t\t1.5x\n"
+                             "threshold\tx1\t/t\t 1.5\n"};
+    store.read(stream);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, store.tests({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{0}, store.trials({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{0}, store.thresholds({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{8}, store.malformed().size());
+}
+
+RESULTS_STORE_TEST(assignsUniqueTestIds) {
+    ResultsStore other;
+    const auto a{store.add(testRecord("a", "1", "x"))};
+    const auto b{store.add(testRecord("a", "1", "x"))};
+    const auto c{other.add(testRecord("a", "1", "x"))};
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(a.empty());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(a != b);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(a != c);
+}
+
+RESULTS_STORE_TEST(linksInterleavedRecordsOfTwoWritersById) {
+    ResultsStore other;
+    std::stringstream stream;
+    const auto a{store.add(testRecord("a", "1", "x"))};
+    store.writeNewRecords(stream);
+    const auto b{other.add(testRecord("b", "1", "x"))};
+    other.writeNewRecords(stream);
+    store.add(trialRecord(a, true));
+    store.writeNewRecords(stream);
+    other.add(trialRecord(b, false));
+    other.add(trialRecord(b, false));
+    other.writeNewRecords(stream);
+    ResultsStore read;
+    read.read(stream);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, read.trials(query("a")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{2}, read.trials(query("b")).size());
+}
+
+RESULTS_STORE_TEST(skipsRereadRecordsOfItsOwnTests) {
+    const auto a{store.add(testRecord("a", "1", "x"))};
+    store.add(trialRecord(a, true));
+    std::stringstream stream;
+    store.writeNewRecords(stream);
+    store.read(stream);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, store.tests({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{1}, store.trials({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(store.malformed().empty());
+}
+
+class IndexedOutputFileTests : public ::testing::Test {
+  protected:
+    OutputFileStub decorated;
+    IndexedOutputFile file{decorated};
+    std::filesystem::path directory{temporaryDirectory()};
+    TestIdentity identity;
+    AdaptiveTest test;
+
+    IndexedOutputFileTests() {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        decorated.setParentPath(directory);
+        identity.subjectId = "a";
+        test.identity = identity;
+    }
+
+    ~IndexedOutputFileTests() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    void runTrial(bool correct) {
+        coordinate_response_measure::AdaptiveTrial trial;
+        trial.correct = correct;
+        file.write(trial);
+    }
+};
+
+#define INDEXED_OUTPUT_FILE_TEST(a) TEST_F(IndexedOutputFileTests, a)
+
+INDEXED_OUTPUT_FILE_TEST(forwardsWritesToDecoratedFile) {
+    file.openNewFile(identity);
+    file.write(test);
+    runTrial(true);
+    file.save();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"openNewFile writeTest writeTrial save "},
+        string(decorated.log()));
+}
+
+INDEXED_OUTPUT_FILE_TEST(indexesTrialsOfCurrentTest) {
+    file.openNewFile(identity);
+    file.write(test);
+    runTrial(true);
+    runTrial(false);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{2}, file.store().trials(query("a")).size());
+    assertEqual(50., file.store().percentCorrect(query("a")), 1e-9);
+}
+
+INDEXED_OUTPUT_FILE_TEST(recordsTestParametersAndTrialSnr) {
+    test.maskerLevel.dB_SPL = 70;
+    test.condition = Condition::audioVisual;
+    test.startingSnr = SNR{5};
+    test.trackingRule = {{2, 4, 1, 1}};
+    file.openNewFile(identity);
+    file.write(test);
+    coordinate_response_measure::AdaptiveTrial trial;
+    trial.snr = SNR{3};
+    file.write(trial);
+    const auto tests{file.store().tests({})};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(70, tests.front().maskerLevel.dB_SPL);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        tests.front().condition == Condition::audioVisual);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(5, tests.front().startingSnr.dB);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, tests.front().trackingRule.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        3, *file.store().trials({}).front().snr_dB);
+}
+
+INDEXED_OUTPUT_FILE_TEST(recordsFixedLevelTrialsAtTestSnr) {
+    FixedLevelTest fixedLevelTest;
+    fixedLevelTest.identity = identity;
+    fixedLevelTest.snr = SNR{-2};
+    file.openNewFile(identity);
+    file.write(fixedLevelTest);
+    file.write(FreeResponseTrial{});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        -2, file.store().tests({}).front().startingSnr.dB);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        -2, *file.store().trials({}).front().snr_dB);
+}
+
+INDEXED_OUTPUT_FILE_TEST(persistsRecordsAcrossInstancesInSameDirectory) {
+    file.openNewFile(identity);
+    file.write(test);
+    runTrial(true);
+    file.close();
+
+    OutputFileStub otherDecorated;
+    otherDecorated.setParentPath(directory);
+    IndexedOutputFile other{otherDecorated};
+    other.openNewFile(identity);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, other.store().trials(query("a")).size());
+}
+
+INDEXED_OUTPUT_FILE_TEST(readsRecordsAppendedByAnotherInstanceBeforeAppending) {
+    OutputFileStub otherDecorated;
+    otherDecorated.setParentPath(directory);
+    IndexedOutputFile other{otherDecorated};
+    file.openNewFile(identity);
+    other.openNewFile(identity);
+    file.write(test);
+    runTrial(true);
+    file.save();
+    auto otherTest{test};
+    otherTest.identity.subjectId = "b";
+    other.write(otherTest);
+    coordinate_response_measure::AdaptiveTrial trial;
+    other.write(trial);
+    other.save();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, other.store().trials(query("a")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, other.store().trials(query("b")).size());
+}
+
+INDEXED_OUTPUT_FILE_TEST(terminatesTornLineBeforeAppending) {
+    {
+        std::ofstream torn{directory / IndexedOutputFile::storeFileName};
+        torn << "test\tx";
+    }
+    file.openNewFile(identity);
+    file.write(test);
+    runTrial(true);
+    file.close();
+
+    OutputFileStub otherDecorated;
+    otherDecorated.setParentPath(directory);
+    IndexedOutputFile other{otherDecorated};
+    other.openNewFile(identity);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, other.store().trials(query("a")).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, other.store().malformed().size());
+}
+
+INDEXED_OUTPUT_FILE_TEST(ignoresTrialsBeforeTest) {
+    file.openNewFile(identity);
+    runTrial(true);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{0}, file.store().trials({}).size());
+}
+INDEXED_OUTPUT_FILE_TEST(readsResultsStoresOfEveryDirectoryBelow) {
+    file.openNewFile(identity);
+    file.write(test);
+    runTrial(true);
+    file.close();
+    const auto subdirectory{directory / "b"};
+    std::filesystem::create_directories(subdirectory);
+    OutputFileStub otherDecorated;
+    otherDecorated.setParentPath(subdirectory);
+    IndexedOutputFile other{otherDecorated};
+    other.openNewFile(identity);
+    auto otherTest{test};
+    otherTest.identity.subjectId = "b";
+    other.write(otherTest);
+    other.close();
+
+    ResultsStore store;
+    readResultsStores(store, directory);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, store.tests({}).size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, store.trials(query("a")).size());
+}
+}
+}
@@ -3,16 +3,18 @@
 #include "ModelObserverStub.hpp"
 #include "OutputFileStub.hpp"
 #include "RandomizerStub.hpp"
-#include "ResponseEvaluatorStub.hpp"
 #include "TargetPlayerStub.hpp"
 #include "assert-utility.hpp"
 
 #include <av-speech-in-noise/Interface.hpp>
+#include <av-speech-in-noise/core/PathTable.hpp>
 #include <av-speech-in-noise/core/RunningATest.hpp>
+#include <av-speech-in-noise/core/TrialPlan.hpp>
 
 #include <gtest/gtest.h>
 
 #include <functional>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,6 +31,18 @@ class TestMethodStub : public TestMethod {
 
     auto snr() -> SNR override { return SNR{snr_dB_}; }
 
+    void setMaskerSeekFraction(double x) { maskerSeekFraction_ = x; }
+
+    auto maskerSeekFraction() -> std::optional<double> override {
+        return maskerSeekFraction_;
+    }
+
+    void setTrialPlan(TrialPlan p) { trialPlan_ = std::move(p); }
+
+    auto trialPlan() -> const TrialPlan * override {
+        return trialPlan_ ? &*trialPlan_ : nullptr;
+    }
+
     void setNextTarget(std::string s) { nextTarget_ = std::move(s); }
 
     auto nextTarget() -> LocalUrl override {
@@ -43,6 +57,14 @@ class TestMethodStub : public TestMethod {
 
     auto currentTarget() -> LocalUrl override { return {currentTarget_}; }
 
+    auto currentTargetFileName() -> std::string_view override {
+        return fileName(currentTarget_);
+    }
+
+    auto currentTargetStem() -> std::string_view override {
+        return stem(currentTarget_);
+    }
+
     void setCurrentTarget(std::string s) { currentTarget_ = std::move(s); }
 
     void submit(const coordinate_response_measure::Response &) override {
@@ -69,6 +91,8 @@ class TestMethodStub : public TestMethod {
     std::string currentTarget_{};
     std::string currentTargetWhenNextTarget_{};
     std::string nextTarget_{};
+    std::optional<double> maskerSeekFraction_{};
+    std::optional<TrialPlan> trialPlan_{};
     int snr_dB_{};
     bool complete_{};
 };
@@ -255,8 +279,8 @@ class ClockStub : public Clock {
 
 class RunningATestObserverStub : public RunningATest::TestObserver {
   public:
-    void notifyThatNewTestIsReady(std::string_view session) override {
-        this->session = session;
+    void notifyThatNewTestIsReady(const Test &test) override {
+        session = test.identity.session;
     }
 
     void notifyThatTrialWillBegin(int trialNumber) override {
@@ -293,10 +317,6 @@ auto targetFileName(RunningATestImpl &m) -> std::string {
     return m.targetFileName();
 }
 
-auto filePathForFileName(ResponseEvaluatorStub &r) -> std::string {
-    return r.filePathForFileName();
-}
-
 auto hidden(TargetPlayerStub &targetPlayer) -> bool {
     return targetPlayer.videoHidden();
 }
@@ -452,12 +472,11 @@ class RunningATestTests : public ::testing::Test {
     ModelObserverStub listener;
     TargetPlayerStub targetPlayer;
     MaskerPlayerStub maskerPlayer;
-    ResponseEvaluatorStub evaluator;
     OutputFileStub outputFile;
     RandomizerStub randomizer;
     ClockStub clock;
     RunningATestImpl model{
-        targetPlayer, maskerPlayer, evaluator, outputFile, randomizer, clock};
+        targetPlayer, maskerPlayer, outputFile, randomizer, clock};
     TestMethodStub testMethod;
     Calibration calibration{};
     PlayingCalibration playingCalibration{calibration, targetPlayer};
@@ -526,6 +545,26 @@ class RunningATestTests : public ::testing::Test {
             randomizer.upperFloatBound(), 1e-15);
     }
 
+    void assertMaskerPlayerSeekedToPlannedPosition(UseCase &useCase) {
+        setDurationSeconds(targetPlayer, 1);
+        setFadeTimeSeconds(maskerPlayer, 2);
+        maskerPlayer.setDurationSeconds(10);
+        testMethod.setMaskerSeekFraction(0.5);
+        randomizer.setRandomFloat(1);
+        run(useCase, model);
+        const auto upperLimit{10. - 2 - 1 - 2 -
+            RunningATestImpl::targetOnsetFringeDuration.seconds -
+            RunningATestImpl::targetOffsetFringeDuration.seconds};
+        ::assertEqual(upperLimit / 2, secondsSeeked(maskerPlayer), 1e-15);
+    }
+
+    void assertWritesMaskerSeekWhenPlayingTrial(UseCase &useCase) {
+        randomizer.setRandomFloat(1.5);
+        run(useCase, model);
+        run(playingTrial, model);
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1.5, outputFile.maskerSeek().seconds);
+    }
+
     void assertMaskerPlayerSeekedToRandomTime(UseCase &useCase) {
         randomizer.setRandomFloat(1);
         run(useCase, model);
@@ -883,18 +922,11 @@ RECOGNITION_TEST_MODEL_TEST(initializeDefaultTestResetsTrialNumber) {
     assertYieldsTrialNumber(initializingTest, 1);
 }
 
-RECOGNITION_TEST_MODEL_TEST(returnsTargetFileName) {
-    evaluator.setFileName("a");
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, targetFileName(model));
-}
-
-RECOGNITION_TEST_MODEL_TEST(
-    passesCurrentTargetToEvaluatorWhenReturningTargetFileName) {
+RECOGNITION_TEST_MODEL_TEST(returnsFileNameOfCurrentTarget) {
     run(initializingTest, model);
-    setCurrentTarget(testMethod, "a");
-    targetFileName(model);
+    setCurrentTarget(testMethod, "b/a.wav");
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, filePathForFileName(evaluator));
+        std::string{"a.wav"}, targetFileName(model));
 }
 
 RECOGNITION_TEST_MODEL_TEST(initializingTestResetsTrialNumber) {
@@ -1018,6 +1050,19 @@ RECOGNITION_TEST_MODEL_TEST(
     assertMaskerPlayerSeekedToRandomTime(preparingNextTrialIfNeeded);
 }
 
+RECOGNITION_TEST_MODEL_TEST(playTrialWritesMaskerSeekAfterInitializing) {
+    assertWritesMaskerSeekWhenPlayingTrial(initializingTest);
+}
+
+RECOGNITION_TEST_MODEL_TEST(playTrialWritesMaskerSeekAfterSubmitting) {
+    run(initializingTest, model);
+    assertWritesMaskerSeekWhenPlayingTrial(submittingCoordinateResponse);
+}
+
+RECOGNITION_TEST_MODEL_TEST(initializeDefaultTestSeeksToPlannedMaskerPosition) {
+    assertMaskerPlayerSeekedToPlannedPosition(initializingTest);
+}
+
 RECOGNITION_TEST_MODEL_TEST(initializeDefaultTestSetsInitialMaskerPlayerLevel) {
     setMaskerLevel_dB_SPL(test, 1);
     setFullScaleLevel_dB_SPL(test, 2);
@@ -1158,6 +1203,27 @@ RECOGNITION_TEST_MODEL_TEST(
     assertCallThrowsRequestFailure(initializingTest, "unable to read a");
 }
 
+RECOGNITION_TEST_MODEL_TEST(
+    initializeTestThrowsRequestFailureWhenPlannedTargetCannotBeRead) {
+    testMethod.setTrialPlan({1, {{{"a"}, 0.5}}});
+    targetPlayer.throwInvalidAudioFileOnDigitalLevel();
+    assertCallThrowsRequestFailure(initializingTest, "unable to read a");
+}
+
+RECOGNITION_TEST_MODEL_TEST(preparingNextTrialWritesTrialPlanAmendments) {
+    testMethod.setTrialPlan({1, {{{"a"}, 0.5}}});
+    run(initializingTest, model);
+    testMethod.setTrialPlan({1, {{{"a"}, 0.5}, {{"a"}, 0.5}}});
+    run(preparingNextTrialIfNeeded, model);
+    run(preparingNextTrialIfNeeded, model);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{1}, outputFile.trialPlanAmendments().size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        gsl::index{2}, outputFile.trialPlanAmendments().front().trial);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"},
+        outputFile.trialPlanAmendments().front().planned.target.path);
+}
+
 RECOGNITION_TEST_MODEL_TEST(
     playTrialWithInvalidAudioDeviceThrowsRequestFailure) {
     assertThrowsRequestFailureWhenInvalidAudioDevice(playingTrial);
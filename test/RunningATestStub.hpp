@@ -46,6 +46,7 @@ class RunningATestStub : public RunningATest {
         nextTrialPreparedIfNeeded_ = true;
     }
     auto playTrialTime() -> std::string override { return {}; }
+    auto method() -> const TestMethod * override { return testMethod; }
 
     Calibration calibration_;
     Calibration leftSpeakerCalibration_;
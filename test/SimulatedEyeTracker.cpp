@@ -0,0 +1,149 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/GazeAnalytics.hpp>
+#include <av-speech-in-noise/core/SimulatedEyeTracker.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+namespace av_speech_in_noise {
+namespace {
+auto simulate(SimulatedGaze &gaze, double seconds, double rateHz)
+    -> BinocularGazeSamples {
+    BinocularGazeSamples samples;
+    for (std::int_least64_t n{0}; n < seconds * rateHz; ++n)
+        samples.push_back(gaze.next(
+            EyeTrackerSystemTime{std::llround(n * 1e6 / rateHz)}));
+    return samples;
+}
+
+auto statistics(const BinocularGazeSamples &samples)
+    -> BinocularGazeStatistics {
+    GazeAnalytics analytics;
+    analytics.add(samples);
+    return analytics.statistics();
+}
+
+void sleepFor(double seconds) {
+    std::this_thread::sleep_for(std::chrono::duration<double>{seconds});
+}
+
+class SimulatedGazeTests : public ::testing::Test {
+  protected:
+    SimulatedGazeSettings settings;
+};
+
+class SimulatedEyeTrackerTests : public ::testing::Test {
+  protected:
+    SimulatedGazeSettings settings;
+};
+
+#define SIMULATED_GAZE_TEST(a) TEST_F(SimulatedGazeTests, a)
+
+#define SIMULATED_EYE_TRACKER_TEST(a) TEST_F(SimulatedEyeTrackerTests, a)
+
+SIMULATED_GAZE_TEST(timestampsSamples) {
+    SimulatedGaze gaze{settings};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{123},
+        gaze.next(EyeTrackerSystemTime{123}).systemTime.microseconds);
+}
+
+SIMULATED_GAZE_TEST(sameSeedProducesSameSamples) {
+    SimulatedGaze first{settings};
+    SimulatedGaze second{settings};
+    const auto a{simulate(first, 1, 600)};
+    const auto b{simulate(second, 1, 600)};
+    for (gsl::index i{0}; i < gsl::narrow_cast<gsl::index>(a.size()); ++i) {
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(a.at(i).left.position.relativeScreen.x,
+            b.at(i).left.position.relativeScreen.x);
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+            a.at(i).right.position.valid, b.at(i).right.position.valid);
+    }
+}
+
+SIMULATED_GAZE_TEST(producesFixations) {
+    settings.blinkProbability = 0;
+    settings.invalidSampleProbability = 0;
+    SimulatedGaze gaze{settings};
+    const auto s{statistics(simulate(gaze, 10, 1000))};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(s.fixations >= 10);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, s.blinks);
+    assertEqual(100., s.left.percentValid);
+}
+
+SIMULATED_GAZE_TEST(producesBlinks) {
+    settings.blinkProbability = 0.5;
+    settings.invalidSampleProbability = 0;
+    SimulatedGaze gaze{settings};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        statistics(simulate(gaze, 10, 1000)).blinks > 0);
+}
+
+SIMULATED_GAZE_TEST(producesInvalidSamples) {
+    settings.blinkProbability = 0;
+    settings.invalidSampleProbability = 0.1;
+    SimulatedGaze gaze{settings};
+    const auto s{statistics(simulate(gaze, 10, 1000))};
+    assertEqual(90., s.left.percentValid, 1.);
+    assertEqual(90., s.right.percentValid, 1.);
+}
+
+SIMULATED_EYE_TRACKER_TEST(recordsSamplesAtConfiguredRate) {
+    settings.rateHz = 2000;
+    SimulatedEyeTracker eyeTracker{settings};
+    eyeTracker.allocateRecordingTimeSeconds(1);
+    eyeTracker.start();
+    sleepFor(0.05);
+    eyeTracker.stop();
+    const auto samples{eyeTracker.gazeSamples()};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(samples.size() > 1);
+    for (gsl::index i{1}; i < gsl::narrow_cast<gsl::index>(samples.size());
+         ++i)
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{500},
+            samples.at(i).systemTime.microseconds -
+                samples.at(i - 1).systemTime.microseconds);
+}
+
+SIMULATED_EYE_TRACKER_TEST(doesNotRecordPastAllocatedTime) {
+    settings.rateHz = 2000;
+    SimulatedEyeTracker eyeTracker{settings};
+    eyeTracker.allocateRecordingTimeSeconds(0.01);
+    eyeTracker.start();
+    sleepFor(0.05);
+    eyeTracker.stop();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::size_t{21}, eyeTracker.gazeSamples().size());
+}
+
+SIMULATED_EYE_TRACKER_TEST(deliversSamplesMissedDuringStall) {
+    settings.rateHz = 1000;
+    SimulatedEyeTracker eyeTracker{settings};
+    eyeTracker.allocateRecordingTimeSeconds(1);
+    eyeTracker.injectStall(Duration{0.03});
+    eyeTracker.start();
+    sleepFor(0.06);
+    eyeTracker.stop();
+    const auto samples{eyeTracker.gazeSamples()};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(samples.size() > 30);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{1000},
+        samples.at(30).systemTime.microseconds -
+            samples.at(29).systemTime.microseconds);
+}
+
+SIMULATED_EYE_TRACKER_TEST(clampsRate) {
+    settings.rateHz = 10000;
+    SimulatedEyeTracker eyeTracker{settings};
+    eyeTracker.allocateRecordingTimeSeconds(1);
+    eyeTracker.start();
+    sleepFor(0.02);
+    eyeTracker.stop();
+    const auto samples{eyeTracker.gazeSamples()};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(samples.size() > 1);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int_least64_t{500},
+        samples.at(1).systemTime.microseconds -
+            samples.at(0).systemTime.microseconds);
+}
+}
+}
@@ -0,0 +1,144 @@
+#include "assert-utility.hpp"
+#include "OutputFileStub.hpp"
+#include "RandomizerStub.hpp"
+#include "TargetPlaylistSetReaderStub.hpp"
+#include "TargetPlaylistStub.hpp"
+
+#include <av-speech-in-noise/core/AdaptiveMethod.hpp>
+#include <av-speech-in-noise/core/AdaptiveTrack.hpp>
+#include <av-speech-in-noise/core/OfflinePlayers.hpp>
+#include <av-speech-in-noise/core/ResponseEvaluator.hpp>
+#include <av-speech-in-noise/core/RunningATest.hpp>
+#include <av-speech-in-noise/core/SimulatedSession.hpp>
+#include <av-speech-in-noise/core/SubmittingPassFail.hpp>
+#include <av-speech-in-noise/core/VirtualTime.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace av_speech_in_noise {
+namespace {
+class TimerObserverStub : public Timer::Observer {
+  public:
+    void callback() override { ++callbacks; }
+    int callbacks{};
+};
+
+class OneSecondStimuli : public StimulusDescriptions {
+  public:
+    auto describe(const LocalUrl &url) -> StimulusDescription override {
+        if (url.path == "masker.wav")
+            return {Duration{60}, DigitalLevel{-20}};
+        return {Duration{1}, DigitalLevel{-30}};
+    }
+};
+
+class VirtualTimeTests : public ::testing::Test {
+  protected:
+    VirtualTime time;
+};
+
+#define VIRTUAL_TIME_TEST(a) TEST_F(VirtualTimeTests, a)
+
+VIRTUAL_TIME_TEST(runsCallbacksInTimeOrder) {
+    std::string order;
+    time.schedule(Duration{2}, [&]() { order += "b"; });
+    time.schedule(Duration{1}, [&]() { order += "a"; });
+    while (time.advance())
+        ;
+    assertEqual("ab", order);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(2., time.now().seconds);
+}
+
+VIRTUAL_TIME_TEST(runsSimultaneousCallbacksInScheduledOrder) {
+    std::string order;
+    time.schedule(Duration{1}, [&]() { order += "a"; });
+    time.schedule(Duration{1}, [&]() { order += "b"; });
+    while (time.advance())
+        ;
+    assertEqual("ab", order);
+}
+
+VIRTUAL_TIME_TEST(cancelsLastTimerCallback) {
+    TimerObserverStub observer;
+    time.attach(&observer);
+    time.scheduleCallbackAfterSeconds(1);
+    time.scheduleCallbackAfterSeconds(2);
+    time.cancelLastCallback();
+    while (time.advance())
+        ;
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, observer.callbacks);
+}
+
+VIRTUAL_TIME_TEST(formatsTimeAfterOrigin) {
+    VirtualTime later{1700000000};
+    later.schedule(Duration{3661.5}, []() {});
+    later.advance();
+    assertEqual("2023-11-14 23:14:21", later.time());
+    assertEqual("1970-01-01 00:00:00", time.time());
+}
+
+class SimulatedSessionTests : public ::testing::Test {
+  protected:
+    VirtualTime time;
+    OneSecondStimuli stimuli;
+    OfflineTargetPlayer targetPlayer{time, stimuli};
+    OfflineMaskerPlayer maskerPlayer{time, stimuli};
+    ResponseEvaluatorImpl evaluator;
+    OutputFileStub outputFile;
+    RandomizerStub randomizer;
+    RunningATestImpl model{
+        targetPlayer, maskerPlayer, outputFile, randomizer, time};
+    adaptive_track::AdaptiveTrack::Factory trackFactory;
+    AdaptiveMethodImpl method{evaluator, randomizer};
+    submitting_pass_fail::InteractorImpl interactor{method, model, outputFile};
+    SimulatedListener listener{PsychometricFunction{}, 1};
+    submitting_pass_fail::SimulatedResponder responder{
+        interactor, method, listener};
+    SimulatedSession session{model, time, responder};
+    TargetPlaylistSetReaderStub reader;
+    AdaptiveTest test;
+    AudioSettings audioSettings;
+
+    SimulatedSessionTests() {
+        auto list{std::make_shared<TargetPlaylistStub>()};
+        list->setNext("target.wav");
+        reader.setTargetPlaylists({list});
+        test.maskerFileUrl.path = "masker.wav";
+        test.trackingRule = {{4, 4, 2, 1}, {6, 2, 2, 1}};
+        test.ceilingSnr = SNR{20};
+        test.floorSnr = SNR{-40};
+        test.trackBumpLimit = 10;
+        test.thresholdReversals = 4;
+        method.initialize(test, &reader, trackFactory);
+        model.initialize(&method, test, {});
+        audioSettings.audioDevice = OfflineMaskerPlayer::audioDevice;
+    }
+};
+
+#define SIMULATED_SESSION_TEST(a) TEST_F(SimulatedSessionTests, a)
+
+SIMULATED_SESSION_TEST(runsTestToCompletion) {
+    const auto result{session.run(audioSettings, 1000)};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(result.complete);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(model.testComplete());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(result.trials >= 10);
+}
+
+SIMULATED_SESSION_TEST(measuresEachInterTrialInterval) {
+    const auto result{session.run(audioSettings, 1000)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        result.trials - 1,
+        static_cast<gsl::index>(result.interTrialSeconds.size()));
+}
+
+SIMULATED_SESSION_TEST(advancesVirtualTimeByEachTrial) {
+    const auto result{session.run(audioSettings, 3)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(gsl::index{3}, result.trials);
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(result.complete);
+    assertEqual(
+        3 * (2 * 0.02 + 1 + 2 * 0.166), result.virtualDuration.seconds, 1e-9);
+}
+}
+}
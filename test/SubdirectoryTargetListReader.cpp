@@ -9,6 +9,9 @@
 
 #include <gsl/gsl>
 
+#include <string>
+#include <vector>
+
 namespace av_speech_in_noise {
 namespace {
 class TargetPlaylistFactoryStub : public TargetPlaylistFactory {
@@ -100,6 +103,23 @@ TEST_F(SubdirectoryTargetPlaylistReaderTests,
     EXPECT_EQ(targetList(0), actual.at(0));
 }
 
+TEST_F(SubdirectoryTargetPlaylistReaderTests,
+    readLoadsEachSubDirectoryInOrderOnSeveralThreads) {
+    std::vector<av_speech_in_noise::LocalUrl> subDirectories;
+    for (auto i{0}; i < 16; ++i)
+        subDirectories.push_back({std::to_string(i)});
+    setSubDirectories(subDirectories);
+    SubdirectoryTargetPlaylistReader parallel{
+        &targetListFactory, &directoryReader, 4};
+    const auto actual{parallel.read({"d"})};
+    EXPECT_EQ(16, actual.size());
+    for (auto i{0}; i < 16; ++i) {
+        EXPECT_EQ(targetList(i), actual.at(i));
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+            "d/" + std::to_string(i), targetListDirectory(i));
+    }
+}
+
 class SubdirectoryTargetPlaylistReaderFailureTests : public ::testing::Test {};
 
 TEST_F(SubdirectoryTargetPlaylistReaderFailureTests, returnsEmptyList) {
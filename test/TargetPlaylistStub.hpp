@@ -47,6 +47,20 @@ class TargetPlaylistStub : public virtual TargetPlaylist {
     bool nextCalled_{};
 };
 
+class SeedableTargetPlaylistStub : public virtual SeedableTargetPlaylist,
+                                   public TargetPlaylistStub {
+  public:
+    void seed(std::uint64_t s) override {
+        insert(log_, "seed ");
+        seed_ = s;
+    }
+
+    [[nodiscard]] auto seed() const -> std::uint64_t { return seed_; }
+
+  private:
+    std::uint64_t seed_{};
+};
+
 class FiniteTargetPlaylistStub : public virtual FiniteTargetPlaylist,
                                  public TargetPlaylistStub {
   public:
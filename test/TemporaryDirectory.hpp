@@ -0,0 +1,19 @@
+#ifndef TESTS_TEMPORARYDIRECTORY_HPP_
+#define TESTS_TEMPORARYDIRECTORY_HPP_
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <random>
+#include <string>
+
+// Named after the running test and made unique, so that concurrent runs
+// of the test executable don't share files.
+inline auto temporaryDirectory() -> std::filesystem::path {
+    const auto *test{::testing::UnitTest::GetInstance()->current_test_info()};
+    return std::filesystem::temp_directory_path() /
+        (std::string{test->test_suite_name()} + '.' + test->name() + '.' +
+            std::to_string(std::random_device{}()));
+}
+
+#endif
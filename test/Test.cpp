@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <utility>
 
 namespace av_speech_in_noise {
@@ -579,10 +580,21 @@ TEST_CONTROLLER_TEST(completesTaskWhenTestIsComplete) {
 }
 
 TEST_PRESENTER_TEST(showsAdaptiveTestResults) {
-    adaptiveMethod.testResults_ = {{{"a"}, 1.}, {{"b"}, 2.}, {{"c"}, 3.}};
+    adaptiveMethod.testResults_ = {{{"a"}, 1., {}, 0.5}, {{"b"}, 2., {}, 1.},
+        {{"c"}, 3., {}, 1.5}};
     presenter.updateAdaptiveTestResults();
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"thresholds (targets: dB SNR)\na: 1\nb: 2\nc: 3"},
+        std::string{"thresholds (targets: dB SNR)\na: 1 (SD 0.5)\nb: 2 (SD "
+                    "1)\nc: 3 (SD 1.5)"},
+        view.continueTestingDialogMessage());
+}
+
+TEST_PRESENTER_TEST(omitsThresholdStandardDeviationWhenUnknown) {
+    adaptiveMethod.testResults_ = {
+        {{"a"}, 1., {}, std::numeric_limits<double>::quiet_NaN()}};
+    presenter.updateAdaptiveTestResults();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"thresholds (targets: dB SNR)\na: 1"},
         view.continueTestingDialogMessage());
 }
 
@@ -689,6 +701,23 @@ TEST_PRESENTER_TEST(displaysTargetWhenUpdatingTrialInformation) {
         presenter, runningATest, updatingTrialInformation, view);
 }
 
+TEST_PRESENTER_TEST(displaysCurrentTrackThresholdOfAdaptiveTest) {
+    runningATest.trialNumber_ = 1;
+    runningATest.testMethod = &adaptiveMethod;
+    adaptiveMethod.currentTrackResult_ = {{{"a"}, -2.5, {}, 1.5}};
+    presenter.updateTrialInformation();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"Trial 1 (threshold -2.5 dB SNR, SD 1.5)"},
+        view.displayed());
+}
+
+TEST_PRESENTER_TEST(omitsCurrentTrackThresholdWhenTestIsNotAdaptive) {
+    runningATest.trialNumber_ = 1;
+    adaptiveMethod.currentTrackResult_ = {{{"a"}, -2.5, {}, 1.5}};
+    presenter.updateTrialInformation();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"Trial 1"}, view.displayed());
+}
+
 TEST_PRESENTER_TEST(displaysTrialNumberWhenInitializing) {
     AV_SPEECH_IN_NOISE_EXPECT_DISPLAYS_TRIAL(
         presenter, runningATest, initializing, view);
@@ -3,6 +3,7 @@
 #include "RunningATestStub.hpp"
 #include "TargetPlaylistSetReaderStub.hpp"
 #include "TargetPlaylistStub.hpp"
+#include "TrackStub.hpp"
 #include "assert-utility.hpp"
 #include "PuzzleStub.hpp"
 
@@ -12,6 +13,8 @@
 #include <gtest/gtest.h>
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace av_speech_in_noise {
 constexpr auto operator==(const TrackingSequence &a, const TrackingSequence &b)
@@ -215,6 +218,8 @@ class TestSettingsInterpreterTests : public ::testing::Test {
   protected:
     RunningATestStub runningATest;
     AdaptiveMethodStub adaptiveMethod;
+    TrackFactoryStub staircaseTrackFactory;
+    TrackFactoryStub psiTrackFactory;
     FixedLevelMethodStub fixedLevelMethod;
     RunningATest::TestObserver eyeTracking;
     RunningATest::TestObserver audioRecording;
@@ -224,7 +229,7 @@ class TestSettingsInterpreterTests : public ::testing::Test {
     FiniteTargetPlaylistWithRepeatablesStub everyTargetOnce;
     FiniteTargetPlaylistWithRepeatablesStub silentIntervalTargets;
     RepeatableFiniteTargetPlaylistStub eachTargetNTimes;
-    TargetPlaylistStub targetsWithReplacement;
+    SeedableTargetPlaylistStub targetsWithReplacement;
     SessionControllerStub sessionController;
     submitting_free_response::PuzzleStub puzzle;
     FreeResponseControllerStub freeResponseController;
@@ -241,7 +246,8 @@ class TestSettingsInterpreterTests : public ::testing::Test {
     TaskPresenterStub childEmotionPresenter;
     TaskPresenterStub fixedPassFailPresenter;
     TestSettingsInterpreterImpl interpreter{runningATest, adaptiveMethod,
-        fixedLevelMethod, eyeTracking, audioRecording, cyclicTargetsReader,
+        staircaseTrackFactory, psiTrackFactory, fixedLevelMethod, eyeTracking,
+        audioRecording, cyclicTargetsReader,
         targetsWithReplacementReader, predeterminedTargets, everyTargetOnce,
         silentIntervalTargets, eachTargetNTimes, targetsWithReplacement, puzzle,
         freeResponseController, sessionController,
@@ -833,18 +839,28 @@ TEST_SETTINGS_INTERPRETER_TEST(throwsRuntimeErrorIfMethodUnknown) {
         FAIL() << "Expected std::runtime_error";
     } catch (const std::runtime_error &e) {
         AV_SPEECH_IN_NOISE_ASSERT_EQUAL(
-            std::string{
-                "Test method not recognized: this is not a real test method"},
+            std::string{"Invalid test settings:\nline 1: \"method\" expects "
+                        "a test method but found \"this is not a real test "
+                        "method\""},
             e.what());
     }
 }
 
-TEST_SETTINGS_INTERPRETER_TEST(ignoresBadLine) {
-    initializeTest(interpreter,
-        {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
-            "f:\n", entryWithNewline(TestSetting::targets, "a")});
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        std::string{"a"}, adaptiveMethod.test.targetsUrl.path);
+TEST_SETTINGS_INTERPRETER_TEST(refusesToInitializeTestWithErrors) {
+    try {
+        initializeTest(interpreter,
+            {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
+                "f:\n", entryWithNewline(TestSetting::targets, "a"),
+                entryWithNewline(TestSetting::maskerLevel, "b")});
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error &e) {
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+            std::string{"Invalid test settings:\nline 2: unknown setting "
+                        "\"f\"\nline 4: \"masker level (dB SPL)\" expects "
+                        "an integer but found \"b\""},
+            e.what());
+    }
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(adaptiveMethod.test.targetsUrl.path.empty());
 }
 
 TEST_SETTINGS_INTERPRETER_TEST(ignoresBadLine2) {
@@ -863,16 +879,159 @@ TEST_SETTINGS_INTERPRETER_TEST(ignoresBadLine3) {
         std::string{"a"}, adaptiveMethod.test.targetsUrl.path);
 }
 
-TEST_SETTINGS_INTERPRETER_TEST(badMaskerLevelResolvesToZero) {
+TEST_SETTINGS_INTERPRETER_TEST(meta) {
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        "a", interpreter.meta(entryWithNewline(TestSetting::meta, "a")));
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(adaptiveTest) {
+    const auto test{TestSettingsInterpreterImpl::adaptiveTest(
+        concatenate({entryWithNewline(TestSetting::method,
+                         Method::adaptiveCoordinateResponseMeasure),
+            entryWithNewline(TestSetting::startingSnr, "6"),
+            entryWithNewline(TestSetting::down, "2 3"),
+            entryWithNewline(TestSetting::thresholdReversals, "4")}))};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(6, test.startingSnr.dB);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(3, test.trackingRule.at(1).down);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(4, test.thresholdReversals);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        SessionControllerImpl::ceilingSnr.dB, test.ceilingSnr.dB);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(adaptiveTestConvergenceRule) {
+    const auto test{TestSettingsInterpreterImpl::adaptiveTest(
+        concatenate({entryWithNewline(
+                         TestSetting::method, Method::adaptivePassFail),
+            entryWithNewline(TestSetting::convergenceReversals, "6"),
+            entryWithNewline(TestSetting::convergenceStandardError, "0.5")}))};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(6, test.convergenceReversals);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0.5, test.convergenceStandardErrorDb);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(adaptiveTestTrackSelection) {
+    const auto test{TestSettingsInterpreterImpl::adaptiveTest(
+        concatenate({entryWithNewline(
+                         TestSetting::method, Method::adaptivePassFail),
+            entryWithNewline(TestSetting::trackSelection, "round robin")}))};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        TrackSelection::roundRobin, test.trackSelection);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(adaptiveTestTrackAlgorithm) {
+    const auto test{TestSettingsInterpreterImpl::adaptiveTest(
+        concatenate({entryWithNewline(
+                         TestSetting::method, Method::adaptivePassFail),
+            entryWithNewline(TestSetting::track, "psi")}))};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(TrackAlgorithm::psi, test.trackAlgorithm);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(initializesAdaptiveMethodWithStaircaseTracks) {
     initializeTest(interpreter,
-        {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
-            entryWithNewline(TestSetting::maskerLevel, "a")});
-    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, adaptiveMethod.test.maskerLevel.dB_SPL);
+        {entryWithNewline(TestSetting::method, Method::adaptivePassFail)});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        &staircaseTrackFactory, adaptiveMethod.trackFactory);
 }
 
-TEST_SETTINGS_INTERPRETER_TEST(meta) {
+TEST_SETTINGS_INTERPRETER_TEST(initializesAdaptiveMethodWithPsiTracks) {
+    initializeTest(interpreter,
+        {entryWithNewline(TestSetting::method, Method::adaptiveCorrectKeywords),
+            entryWithNewline(TestSetting::track, "psi")});
     AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
-        "a", interpreter.meta(entryWithNewline(TestSetting::meta, "a")));
+        &psiTrackFactory, adaptiveMethod.trackFactory);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(adaptiveTestRejectsFixedLevelMethod) {
+    EXPECT_THROW(TestSettingsInterpreterImpl::adaptiveTest(entryWithNewline(
+                     TestSetting::method, Method::fixedLevelConsonants)),
+        std::runtime_error);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(method) {
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(Method::fixedLevelConsonants,
+        TestSettingsInterpreterImpl::method(entryWithNewline(
+            TestSetting::method, Method::fixedLevelConsonants)));
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(fixedLevelTest) {
+    const auto test{TestSettingsInterpreterImpl::fixedLevelTest(
+        concatenate({entryWithNewline(TestSetting::method,
+                         Method::fixedLevelFreeResponseWithAllTargets),
+            entryWithNewline(TestSetting::startingSnr, "6"),
+            entryWithNewline(TestSetting::masker, "a")}))};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(6, test.snr.dB);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, test.maskerFileUrl.path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        SessionControllerImpl::fullScaleLevel.dB_SPL,
+        test.fullScaleLevel.dB_SPL);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(fixedLevelTestRejectsAdaptiveMethod) {
+    EXPECT_THROW(TestSettingsInterpreterImpl::fixedLevelTest(entryWithNewline(
+                     TestSetting::method, Method::adaptivePassFail)),
+        std::runtime_error);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(errorsEmptyForValidSettings) {
+    const auto contents{concatenate(
+        {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
+            entryWithNewline(TestSetting::maskerLevel, "65"),
+            entryWithNewline(TestSetting::up, "1 1"),
+            entryWithNewline(TestSetting::condition, Condition::audioVisual),
+            entryWithNewline(TestSetting::convergenceStandardError, "0.5"),
+            "\n", entryWithNewline(TestSetting::keepVideoShown, "false")})};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        TestSettingsInterpreterImpl::errors(contents).empty());
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(errorsReportsEachBadLineWithItsNumber) {
+    assertEqual(
+        std::vector<std::string>{"line 2: unknown setting \"f\"",
+            "line 4: \"masker level (dB SPL)\" expects an integer but found "
+            "\"a\"",
+            "line 5: expected \"setting: value\" but found \"oops\"",
+            "line 6: \"keep video shown\" expects true or false but found "
+            "\"yes\"",
+            "line 7: \"track\" expects staircase or psi but found \"qu\""},
+        TestSettingsInterpreterImpl::errors(concatenate(
+            {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
+                "f: 1\n", entryWithNewline(TestSetting::targets, "a"),
+                entryWithNewline(TestSetting::maskerLevel, "a"), "oops\n",
+                entryWithNewline(TestSetting::keepVideoShown, "yes"),
+                entryWithNewline(TestSetting::track, "qu")})));
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(errorsReportsMissingMethod) {
+    assertEqual(std::vector<std::string>{"Test method not found"},
+        TestSettingsInterpreterImpl::errors(
+            entryWithNewline(TestSetting::targets, "a")));
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(errorsReportsUnknownMethod) {
+    assertEqual(std::vector<std::string>{
+                    "line 1: \"method\" expects a test method but found \"x\""},
+        TestSettingsInterpreterImpl::errors(
+            entryWithNewline(TestSetting::method, "x")));
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(errorsReportsTrialPlanForAdaptiveMethod) {
+    assertEqual(
+        std::vector<std::string>{"Adaptive methods can't follow a trial plan"},
+        TestSettingsInterpreterImpl::errors(concatenate(
+            {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
+                entryWithNewline(TestSetting::trialPlan, "true")})));
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(readsThousandsOfEntries) {
+    std::vector<std::string> lines{
+        entryWithNewline(TestSetting::method, Method::adaptivePassFail)};
+    for (auto i{0}; i < 5000; ++i)
+        lines.push_back(
+            entryWithNewline(TestSetting::startingSnr, std::to_string(i)));
+    const auto contents{concatenate(lines)};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        TestSettingsInterpreterImpl::errors(contents).empty());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(4999,
+        TestSettingsInterpreterImpl::adaptiveTest(contents).startingSnr.dB);
 }
 
 TEST_SETTINGS_INTERPRETER_TEST(preparesTestAfterConfirmButtonIsClicked) {
@@ -898,6 +1057,17 @@ TEST_SETTINGS_INTERPRETER_TEST(initializesPuzzleWithPath) {
         "/Users/user/puzzle.png", puzzle.url().path);
 }
 
+TEST_SETTINGS_INTERPRETER_TEST(initializesGazeFilter) {
+    initializeTest(interpreter,
+        {entryWithNewline(TestSetting::method,
+             Method::fixedLevelFreeResponseWithPredeterminedTargets),
+            entryWithNewline(TestSetting::gazeOutputRate, "120"),
+            entryWithNewline(TestSetting::gazeSmoothing, "true")});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        120., runningATest.test.gazeFilter.outputRateHz);
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(runningATest.test.gazeFilter.smoothing);
+}
+
 TEST_SETTINGS_INTERPRETER_TEST(initializesFreeResponseControllerWithPuzzle) {
     initializeTest(interpreter,
         {entryWithNewline(TestSetting::method,
@@ -1024,6 +1194,37 @@ TEST_SETTINGS_INTERPRETER_TEST(
         fixedLevelMethod.fixedLevelFixedTrialsTest);
 }
 
+TEST_SETTINGS_INTERPRETER_TEST(fixedLevelTrialPlanSeed) {
+    initializeTest(interpreter,
+        {entryWithNewline(TestSetting::method,
+             Method::fixedLevelCoordinateResponseMeasureWithTargetReplacement),
+            entryWithNewline(TestSetting::trialPlanSeed, "42")});
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        fixedLevelMethod.fixedLevelFixedTrialsTest.compileTrialPlan);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::uint64_t{42},
+        fixedLevelMethod.fixedLevelFixedTrialsTest.trialPlanSeed);
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(fixedLevelTrialPlanSeedsTargetsBeforeLoading) {
+    initializeTest(interpreter,
+        {entryWithNewline(TestSetting::method,
+             Method::fixedLevelCoordinateResponseMeasureWithTargetReplacement),
+            entryWithNewline(TestSetting::trialPlanSeed, "42")});
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::uint64_t{42},
+        targetsWithReplacement.seed());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"seed "}, targetsWithReplacement.log().str());
+}
+
+TEST_SETTINGS_INTERPRETER_TEST(fixedLevelTrialPlan) {
+    initializeTest(interpreter,
+        {entryWithNewline(TestSetting::method,
+             Method::fixedLevelCoordinateResponseMeasureWithTargetReplacement),
+            entryWithNewline(TestSetting::trialPlan, "true")});
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        fixedLevelMethod.fixedLevelFixedTrialsTest.compileTrialPlan);
+}
+
 TEST_SETTINGS_INTERPRETER_TEST(adaptiveAudioVisual) {
     initializeTest(interpreter,
         {entryWithNewline(TestSetting::method, Method::adaptivePassFail),
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -115,6 +116,8 @@ class TestSettingsInterpreterStub : public TestSettingsInterpreter {
         startingSnr_ = snr.dB;
         text_ = t;
         identity_ = id;
+        if (!errorMessage.empty())
+            throw std::runtime_error{errorMessage};
         if (initializeAnyTestOnApply_)
             runningATest.initialize(nullptr, {}, {});
     }
@@ -127,6 +130,8 @@ class TestSettingsInterpreterStub : public TestSettingsInterpreter {
 
     void initializeAnyTestOnApply() { initializeAnyTestOnApply_ = true; }
 
+    std::string errorMessage;
+
     auto sessionController() -> const SessionController * {
         return sessionController_;
     }
@@ -397,6 +402,12 @@ TEST_SETUP_CONTROLLER_TEST(confirmingTestWithInvalidStartingSnrShowsMessage) {
         presenter.errorMessage());
 }
 
+TEST_SETUP_CONTROLLER_TEST(confirmingTestWithInvalidSettingsShowsMessage) {
+    testSettingsInterpreter.errorMessage = "a";
+    run(confirmingTestSetup);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, presenter.errorMessage());
+}
+
 TEST_SETUP_CONTROLLER_TEST(confirmingTestPassesTesterId) {
     control.setTesterId("c");
     run(confirmingTestSetup);
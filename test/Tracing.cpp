@@ -0,0 +1,124 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/Tracing.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+class TracingTests : public ::testing::Test {
+  protected:
+    TracingTests() { tracing::clear(); }
+    ~TracingTests() override {
+        tracing::disable();
+        tracing::clear();
+    }
+};
+
+auto trace() -> std::string {
+    std::stringstream stream;
+    tracing::write(stream);
+    return stream.str();
+}
+
+auto contains(const std::string &s, const std::string &what) -> bool {
+    return s.find(what) != std::string::npos;
+}
+
+auto occurrences(const std::string &s, const std::string &what) -> int {
+    auto count{0};
+    for (auto i{s.find(what)}; i != std::string::npos;
+         i = s.find(what, i + 1))
+        ++count;
+    return count;
+}
+
+auto threadIds(const std::string &json) -> std::set<std::string> {
+    std::set<std::string> tids;
+    for (auto i{json.find(R"("tid":)")}; i != std::string::npos;
+         i = json.find(R"("tid":)", i + 1))
+        tids.insert(json.substr(i, json.find('}', i) - i));
+    return tids;
+}
+
+#define TRACING_TEST(a) TEST_F(TracingTests, a)
+
+TRACING_TEST(recordsNothingWhileDisabled) {
+    { tracing::Span span{"a"}; }
+    tracing::instant("b");
+    assertEqual(R"({"traceEvents":[],"displayTimeUnit":"ms"})", trace());
+}
+
+TRACING_TEST(recordsSpanAsCompleteEvent) {
+    tracing::enable();
+    { tracing::Span span{"a"}; }
+    const auto json{trace()};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        contains(json, R"({"name":"a","cat":"trial","ph":"X","ts":)"));
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(contains(json, R"("dur":)"));
+}
+
+TRACING_TEST(recordsInstantWithThreadScope) {
+    tracing::enable();
+    tracing::instant("a");
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        contains(trace(), R"("name":"a","cat":"trial","ph":"i")"));
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(contains(trace(), R"("s":"t")"));
+}
+
+TRACING_TEST(spanStartedWhileDisabledIsNotRecorded) {
+    {
+        tracing::Span span{"a"};
+        tracing::enable();
+    }
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(contains(trace(), R"("name":"a")"));
+}
+
+TRACING_TEST(recordsEachThreadSeparately) {
+    tracing::enable();
+    std::vector<std::thread> threads;
+    for (auto i{0}; i < 4; ++i)
+        threads.emplace_back([]() {
+            for (auto j{0}; j < 100; ++j)
+                tracing::Span span{"a"};
+        });
+    for (auto &thread : threads)
+        thread.join();
+    const auto json{trace()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(400, occurrences(json, R"("name":"a")"));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{4}, threadIds(json).size());
+}
+
+TRACING_TEST(escapesNames) {
+    tracing::enable();
+    tracing::instant("a\"b\\c\n");
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(
+        contains(trace(), R"("name":"a\"b\\c\u000a")"));
+}
+
+TRACING_TEST(keepsEventsOfThreadsWhoseBuffersAreReused) {
+    tracing::enable();
+    for (auto i{0}; i < 3; ++i)
+        std::thread{[]() { tracing::instant("a"); }}.join();
+    const auto json{trace()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(3, occurrences(json, R"("name":"a")"));
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{3}, threadIds(json).size());
+}
+
+TRACING_TEST(dropsEventsBeyondBufferCapacity) {
+    tracing::enable();
+    std::thread{[]() {
+        for (auto i{0}; i < (1 << 16) + 10; ++i)
+            tracing::instant("a");
+    }}.join();
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::int64_t{10}, tracing::dropped());
+}
+}
+}
@@ -10,6 +10,8 @@ class TrackStub : public Track {
     Settings settings_;
     double thresholdWhenUpdated_{};
     double threshold_{};
+    double thresholdStandardDeviation_{};
+    TrackStoppingReason stoppingReason_{};
     int x_{};
     int reversals_{};
     int reversalsWhenUpdated_{};
@@ -66,6 +68,12 @@ class TrackStub : public Track {
             complete_ = false;
     }
 
+    auto stoppingReason() -> TrackStoppingReason override {
+        return stoppingReason_;
+    }
+
+    void setStoppingReason(TrackStoppingReason r) { stoppingReason_ = r; }
+
     void incompleteOnReset() { incompleteOnReset_ = true; }
 
     [[nodiscard]] auto resetted() const -> bool { return resetted_; }
@@ -75,6 +83,15 @@ class TrackStub : public Track {
         return threshold_;
     }
 
+    auto thresholdStandardDeviation(int reversals) -> double override {
+        thresholdReversals_ = reversals;
+        return thresholdStandardDeviation_;
+    }
+
+    void setThresholdStandardDeviation(double x) {
+        thresholdStandardDeviation_ = x;
+    }
+
     [[nodiscard]] auto thresholdReversals() const -> int {
         return thresholdReversals_;
     }
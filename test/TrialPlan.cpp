@@ -0,0 +1,99 @@
+#include "TargetPlaylistStub.hpp"
+#include "TemporaryDirectory.hpp"
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/TrialPlan.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+class TargetSequence : public FiniteTargetPlaylist {
+  public:
+    explicit TargetSequence(std::vector<std::string> targets)
+        : targets{std::move(targets)} {}
+    void load(const LocalUrl &) override {}
+    auto next() -> LocalUrl override { return {targets.at(++current_)}; }
+    auto current() -> LocalUrl override { return {targets.at(current_)}; }
+    auto directory() -> LocalUrl override { return {}; }
+    auto empty() -> bool override {
+        return current_ + 1 == static_cast<gsl::index>(targets.size());
+    }
+
+  private:
+    std::vector<std::string> targets;
+    gsl::index current_{-1};
+};
+
+class TrialPlanTests : public ::testing::Test {};
+
+#define TRIAL_PLAN_TEST(a) TEST_F(TrialPlanTests, a)
+
+TRIAL_PLAN_TEST(drawsEachFixedTrialFromPlaylist) {
+    TargetPlaylistStub list;
+    list.setNext("a");
+    const auto plan{compileTrialPlan(list, 3, 1)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{3}, plan.trials.size());
+    for (const auto &trial : plan.trials)
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, trial.target.path);
+}
+
+TRIAL_PLAN_TEST(drainsFinitePlaylist) {
+    TargetSequence list{{"a", "b", "c"}};
+    const auto plan{compileTrialPlan(list, 1)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{3}, plan.trials.size());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"c"}, plan.trials.back().target.path);
+}
+
+TRIAL_PLAN_TEST(seekFractionsDependOnlyOnSeed) {
+    TargetPlaylistStub list;
+    const auto first{compileTrialPlan(list, 10, 7)};
+    const auto second{compileTrialPlan(list, 10, 7)};
+    const auto third{compileTrialPlan(list, 10, 8)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::uint64_t{7}, first.seed);
+    auto differs{false};
+    for (gsl::index i{0}; i < 10; ++i) {
+        const auto fraction{first.trials.at(i).maskerSeekFraction};
+        AV_SPEECH_IN_NOISE_EXPECT_TRUE(fraction >= 0 && fraction <= 1);
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+            fraction, second.trials.at(i).maskerSeekFraction);
+        differs = differs || fraction != third.trials.at(i).maskerSeekFraction;
+    }
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(differs);
+}
+
+TRIAL_PLAN_TEST(checkingTargetsThrowsForMissingFile) {
+    const auto directory{temporaryDirectory()};
+    std::filesystem::create_directories(directory);
+    std::ofstream{directory / "a.wav"};
+    TrialPlan plan;
+    plan.trials.push_back({{(directory / "a.wav").string()}, 0});
+    checkTargetsExist(plan);
+    plan.trials.push_back({{(directory / "b.wav").string()}, 0});
+    EXPECT_THROW(checkTargetsExist(plan), std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
+
+TRIAL_PLAN_TEST(playlistLooksUpPlannedTrials) {
+    TrialPlanPlaylist playlist;
+    playlist.assign({1, {{{"a"}, 0.25}, {{"b"}, 0.75}}}, {"d"});
+    AV_SPEECH_IN_NOISE_EXPECT_FALSE(playlist.empty());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"a"}, playlist.next().path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0.25, playlist.maskerSeekFraction());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"b"}, playlist.next().path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::string{"b"}, playlist.current().path);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0.75, playlist.maskerSeekFraction());
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(playlist.empty());
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(
+        std::string{"d"}, playlist.directory().path);
+}
+}
+}
@@ -0,0 +1,78 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/player/TrialRenderer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+namespace av_speech_in_noise {
+namespace {
+class AudioReaderMap : public AudioReader {
+  public:
+    auto read(std::string filePath) -> audio_type override {
+        return audio.at(filePath);
+    }
+
+    std::map<std::string, audio_type> audio;
+};
+
+constexpr auto sampleRateHz{1000.};
+constexpr Duration rampDuration{0.01};
+constexpr gsl::index rampFrames{10};
+constexpr gsl::index fringeFrames{166};
+
+class TrialRendererTests : public ::testing::Test {
+  protected:
+    AudioReaderMap reader;
+    TrialStimulus stimulus;
+
+    TrialRendererTests() {
+        reader.audio["masker"] = {channel_type(2000, 0.5F)};
+        reader.audio["target"] = {channel_type(10)};
+        reader.audio["target"].front().front() = 1;
+        stimulus.masker.path = "masker";
+        stimulus.target.path = "target";
+        stimulus.maskerLevel.dB_SPL = 60;
+        stimulus.fullScaleLevel.dB_SPL = 60;
+    }
+
+    auto rendered() -> audio_type {
+        return render(reader, sampleRateHz, rampDuration, stimulus);
+    }
+};
+
+#define TRIAL_RENDERER_TEST(a) TEST_F(TrialRendererTests, a)
+
+TRIAL_RENDERER_TEST(scalesMaskerToLevel) {
+    const auto audio{rendered()};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, audio.size());
+    assertEqual(1.F, audio.at(0).at(rampFrames + 1), 1e-5F);
+    assertEqual(1.F, audio.at(1).at(rampFrames + 1), 1e-5F);
+}
+
+TRIAL_RENDERER_TEST(rampsMaskerIn) {
+    assertEqual(0.F, rendered().at(0).at(0), 1e-5F);
+}
+
+TRIAL_RENDERER_TEST(startsTargetOneFringeAfterFadeIn) {
+    const auto audio{rendered()};
+    assertEqual(1.F, audio.at(0).at(rampFrames + fringeFrames), 1e-5F);
+    assertEqual(3.F, audio.at(0).at(rampFrames + 1 + fringeFrames), 1e-5F);
+}
+
+TRIAL_RENDERER_TEST(scalesTargetBySnr) {
+    stimulus.snr.dB = -20;
+    assertEqual(1.2F, rendered().at(1).at(rampFrames + 1 + fringeFrames),
+        1e-5F);
+}
+
+TRIAL_RENDERER_TEST(lastsThroughTheFadeOut) {
+    const auto audio{rendered()};
+    AV_SPEECH_IN_NOISE_EXPECT_TRUE(audio.at(0).size() >=
+        gsl::index{2 * rampFrames + 2 * fringeFrames + 10});
+    assertEqual(0.F, audio.at(0).back(), 1e-5F);
+}
+}
+}
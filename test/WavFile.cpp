@@ -0,0 +1,65 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/player/WavFile.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace av_speech_in_noise {
+namespace {
+void put(std::string &s, std::uint32_t x, int size) {
+    for (auto i{0U}; i < static_cast<unsigned>(size); ++i)
+        s.push_back(static_cast<char>((x >> (8U * i)) & 0xFFU));
+}
+
+auto pcm16(const std::vector<std::int16_t> &interleaved, int channels)
+    -> std::string {
+    const auto dataBytes{static_cast<std::uint32_t>(2 * interleaved.size())};
+    std::string s{"RIFF"};
+    put(s, 36 + dataBytes, 4);
+    s += "WAVEfmt ";
+    put(s, 16, 4);
+    put(s, 1, 2);
+    put(s, channels, 2);
+    put(s, 8000, 4);
+    put(s, 8000 * 2 * channels, 4);
+    put(s, 2 * channels, 2);
+    put(s, 16, 2);
+    s += "data";
+    put(s, dataBytes, 4);
+    for (const auto x : interleaved)
+        put(s, static_cast<std::uint16_t>(x), 2);
+    return s;
+}
+
+class WavFileTests : public ::testing::Test {};
+
+#define WAV_FILE_TEST(a) TEST_F(WavFileTests, a)
+
+WAV_FILE_TEST(writtenAudioReadsBack) {
+    std::stringstream stream;
+    writeWav(stream, {{0.5F, -0.25F, 1}, {0, 0.125F, -1}}, 44100);
+    const auto wav{readWav(stream)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(44100., wav.sampleRateHz);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(std::size_t{2}, wav.audio.size());
+    assertEqual(channel_type{0.5F, -0.25F, 1}, wav.audio.at(0));
+    assertEqual(channel_type{0, 0.125F, -1}, wav.audio.at(1));
+}
+
+WAV_FILE_TEST(readsInterleavedPcm16) {
+    std::stringstream stream{pcm16({16384, -32768, -16384, 0}, 2)};
+    const auto wav{readWav(stream)};
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(8000., wav.sampleRateHz);
+    assertEqual(channel_type{0.5F, -0.5F}, wav.audio.at(0));
+    assertEqual(channel_type{-1.F, 0}, wav.audio.at(1));
+}
+
+WAV_FILE_TEST(throwsOnNonWav) {
+    std::stringstream stream{"not a wav file"};
+    EXPECT_THROW(readWav(stream), AudioReader::InvalidFile);
+}
+}
+}
@@ -0,0 +1,55 @@
+#include "assert-utility.hpp"
+
+#include <av-speech-in-noise/core/WorkStealing.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+class WorkStealingTests : public ::testing::Test {};
+
+#define WORK_STEALING_TEST(a) TEST_F(WorkStealingTests, a)
+
+WORK_STEALING_TEST(runsEachTaskOnce) {
+    std::vector<std::atomic<int>> runs(1000);
+    runWorkStealing(1000, 4, [&](gsl::index i) { ++runs.at(i); });
+    for (const auto &r : runs)
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, r.load());
+}
+
+WORK_STEALING_TEST(runsWithoutTasks) {
+    auto runs{0};
+    runWorkStealing(0, 4, [&](gsl::index) { ++runs; });
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(0, runs);
+}
+
+WORK_STEALING_TEST(idleWorkersTakeOverSlowShare) {
+    std::vector<std::atomic<int>> runs(64);
+    runWorkStealing(64, 2, [&](gsl::index i) {
+        if (i == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        ++runs.at(i);
+    });
+    for (const auto &r : runs)
+        AV_SPEECH_IN_NOISE_EXPECT_EQUAL(1, r.load());
+}
+
+WORK_STEALING_TEST(rethrowsFirstFailureAfterRunningRemainingTasks) {
+    std::atomic<int> runs{0};
+    EXPECT_THROW(runWorkStealing(10, 3,
+                     [&](gsl::index i) {
+                         ++runs;
+                         if (i == 5)
+                             throw std::runtime_error{"failed"};
+                     }),
+        std::runtime_error);
+    AV_SPEECH_IN_NOISE_EXPECT_EQUAL(10, runs.load());
+}
+}
+}
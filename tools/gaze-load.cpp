@@ -0,0 +1,259 @@
+#include <av-speech-in-noise/core/ClockSynchronization.hpp>
+#include <av-speech-in-noise/core/EyeTracking.hpp>
+#include <av-speech-in-noise/core/OfflinePlayers.hpp>
+#include <av-speech-in-noise/core/OutputFile.hpp>
+#include <av-speech-in-noise/core/SimulatedEyeTracker.hpp>
+
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+struct Options {
+    std::filesystem::path output;
+    SimulatedGazeSettings gaze{2000};
+    GazeFilterSettings filter{};
+    Duration target{3};
+    Duration stall{};
+    gsl::index trials{20};
+};
+
+class FixedStimulusDescriptions : public StimulusDescriptions {
+  public:
+    explicit FixedStimulusDescriptions(Duration target) : target{target} {}
+
+    auto describe(const LocalUrl &url) -> StimulusDescription override {
+        if (url.path == "masker")
+            return {Duration{target.seconds + 60}, {}};
+        return {target, {}};
+    }
+
+  private:
+    Duration target;
+};
+
+// Reads the host clock, so that clock synchronization samples the same
+// clock the simulated eye tracker does.
+class HostClockMaskerPlayer : public OfflineMaskerPlayer {
+  public:
+    using OfflineMaskerPlayer::OfflineMaskerPlayer;
+
+    auto currentSystemTime() -> PlayerTime override {
+        return PlayerTime{gsl::narrow_cast<player_system_time_type>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count())};
+    }
+};
+
+class FileWriter : public Writer {
+  public:
+    void write(const std::string &s) override { file << s; }
+    void write(Writable &writable) override { writable.write(file); }
+    void open(const std::string &s) override { file.open(s); }
+    auto failed() -> bool override { return file.fail(); }
+    void close() override { file.close(); }
+    void save() override { file.flush(); }
+
+  private:
+    std::ofstream file;
+};
+
+// Still formats every line so the output path costs what it does in a
+// real session.
+class DiscardingWriter : public Writer {
+  public:
+    void write(const std::string &) override {}
+    void write(Writable &writable) override {
+        stream.str({});
+        writable.write(stream);
+    }
+    void open(const std::string &) override {}
+    auto failed() -> bool override { return false; }
+    void close() override {}
+    void save() override {}
+
+  private:
+    std::stringstream stream;
+};
+
+class LoadOutputFilePath : public OutputFilePath {
+  public:
+    explicit LoadOutputFilePath(std::filesystem::path directory)
+        : directory{std::move(directory)} {}
+
+    auto generateFileName(const TestIdentity &) -> std::string override {
+        return "gaze-load";
+    }
+
+    auto outputDirectory() -> std::string override {
+        return directory.string();
+    }
+
+    void setRelativeOutputDirectory(std::filesystem::path) override {}
+
+  private:
+    std::filesystem::path directory;
+};
+
+// Counts the samples written so the report can show what reached the
+// writer after filtering. EyeTracking writes through OutputFile, so the
+// other overloads are still reached.
+class CountingOutputFile : public OutputFileImpl {
+  public:
+    using OutputFileImpl::OutputFileImpl;
+
+    void write(const BinocularGazeSamples &samples) override {
+        written += size(samples);
+        OutputFileImpl::write(samples);
+    }
+
+    gsl::index written{};
+};
+}
+
+static void assign(Options &options, const std::string &option) {
+    const auto equals{option.find('=')};
+    if (equals == std::string::npos)
+        throw std::runtime_error{"Expected name=value: " + option};
+    const auto name{option.substr(0, equals)};
+    const auto value{option.substr(equals + 1)};
+    if (name == "rate")
+        options.gaze.rateHz = std::stod(value);
+    else if (name == "trials")
+        options.trials = std::stol(value);
+    else if (name == "target")
+        options.target.seconds = std::stod(value);
+    else if (name == "stall")
+        options.stall.seconds = std::stod(value);
+    else if (name == "seed")
+        options.gaze.seed = static_cast<std::uint_fast32_t>(std::stoul(value));
+    else if (name == "output-rate")
+        options.filter.outputRateHz = std::stod(value);
+    else if (name == "smoothing")
+        options.filter.smoothing = value == "1";
+    else if (name == "output")
+        options.output = value;
+    else
+        throw std::runtime_error{"Unknown option: " + name};
+}
+
+static auto percentile(const std::vector<double> &sorted, double p) -> double {
+    if (sorted.empty())
+        return 0;
+    const auto rank{std::min(sorted.size() - 1,
+        static_cast<std::size_t>(p * static_cast<double>(sorted.size())))};
+    return sorted.at(rank);
+}
+
+static auto microseconds(double seconds) -> double { return seconds * 1e6; }
+
+static auto seconds(std::chrono::steady_clock::duration d) -> double {
+    return std::chrono::duration<double>{d}.count();
+}
+}
+
+// Drives EyeTracking with a simulated eye tracker in real time, as the
+// application does during a test, and reports the wall time of the path
+// from gaze buffer through the output file formatter to the writer after
+// each trial. The tracker defaults to 2000 Hz.
+auto main(int argc, char *argv[]) -> int {
+    using namespace av_speech_in_noise;
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    try {
+        Options options;
+        for (const auto *option : arguments.subspan(1))
+            assign(options, option);
+        VirtualTime time;
+        FixedStimulusDescriptions stimuli{options.target};
+        OfflineTargetPlayer targetPlayer{time, stimuli};
+        HostClockMaskerPlayer maskerPlayer{time, stimuli};
+        targetPlayer.loadFile({"target"}, {});
+        maskerPlayer.loadFile({"masker"});
+        std::unique_ptr<Writer> writer;
+        if (options.output.empty())
+            writer = std::make_unique<DiscardingWriter>();
+        else {
+            std::filesystem::create_directories(options.output);
+            writer = std::make_unique<FileWriter>();
+        }
+        LoadOutputFilePath path{options.output};
+        CountingOutputFile outputFile{*writer, path};
+        try {
+            outputFile.openNewFile({});
+        } catch (const OutputFile::OpenFailure &) {
+            throw std::runtime_error{
+                "Unable to open output in " + options.output.string()};
+        }
+        SimulatedEyeTracker eyeTracker{options.gaze};
+        ClockSynchronizationImpl clockSynchronization{
+            eyeTracker, maskerPlayer};
+        EyeTracking eyeTracking{eyeTracker, maskerPlayer, targetPlayer,
+            outputFile, clockSynchronization};
+        Test test;
+        test.gazeFilter = options.filter;
+        eyeTracking.notifyThatNewTestIsReady(test);
+        std::vector<double> responseSeconds;
+        gsl::index recorded{};
+        const auto duration{trialDuration(targetPlayer, maskerPlayer)};
+        for (gsl::index trial{1}; trial <= options.trials; ++trial) {
+            eyeTracking.notifyThatTrialWillBegin(
+                gsl::narrow_cast<int>(trial));
+            PlayerTimeWithDelay targetStart;
+            targetStart.playerTime = maskerPlayer.currentSystemTime();
+            eyeTracking.notifyThatTargetWillPlayAt(targetStart);
+            if (options.stall.seconds > 0)
+                eyeTracker.injectStall(options.stall);
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>{duration.seconds});
+            eyeTracking.notifyThatStimulusHasEnded();
+            recorded += size(eyeTracker.gazeSamples());
+            const auto start{std::chrono::steady_clock::now()};
+            eyeTracking.notifyThatSubjectHasResponded();
+            responseSeconds.push_back(
+                seconds(std::chrono::steady_clock::now() - start));
+        }
+        clockSynchronization.stop();
+        outputFile.close();
+        std::sort(responseSeconds.begin(), responseSeconds.end());
+        const auto recordedSeconds{
+            duration.seconds * static_cast<double>(options.trials)};
+        std::cout << "trials\t" << options.trials << '\n'
+                  << "samples recorded\t" << recorded << '\n'
+                  << "recorded rate (Hz)\t"
+                  << static_cast<double>(recorded) / recordedSeconds << '\n'
+                  << "samples written\t" << outputFile.written << '\n'
+                  << "response mean (us)\t"
+                  << microseconds(std::accumulate(responseSeconds.begin(),
+                                      responseSeconds.end(), 0.) /
+                         static_cast<double>(responseSeconds.size()))
+                  << '\n'
+                  << "response p50 (us)\t"
+                  << microseconds(percentile(responseSeconds, .5)) << '\n'
+                  << "response p99 (us)\t"
+                  << microseconds(percentile(responseSeconds, .99)) << '\n'
+                  << "response max (us)\t"
+                  << microseconds(responseSeconds.empty()
+                             ? 0.
+                             : responseSeconds.back())
+                  << '\n';
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " [rate=] [trials=] [target=] [stall=] [seed=] "
+                     "[output-rate=] [smoothing=] [output=]\n"
+                  << e.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,99 @@
+#include <av-speech-in-noise/core/IndexedOutputFile.hpp>
+#include <av-speech-in-noise/core/ResultsStore.hpp>
+
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+struct TestTrials {
+    int trials{};
+    int evaluated{};
+    int correct{};
+};
+}
+
+static auto argument(gsl::span<char *> arguments, gsl::index i)
+    -> std::string {
+    return i < gsl::narrow_cast<gsl::index>(arguments.size())
+        ? gsl::at(arguments, i)
+        : "";
+}
+
+static void writeTrackingRule(
+    std::ostream &stream, const av_speech_in_noise::TrackingRule &rule) {
+    auto first{true};
+    for (const auto &sequence : rule) {
+        if (!first)
+            stream << "; ";
+        stream << sequence.down << " down " << sequence.up << " up "
+               << sequence.stepSize << " dB x" << sequence.runCount;
+        first = false;
+    }
+}
+
+// Writes a table of the tests, from every results store below a
+// directory, that match a subject, session, and method. An empty or
+// omitted field matches anything.
+auto main(int argc, char *argv[]) -> int {
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    if (arguments.size() < 2 || arguments.size() > 5) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " <results directory> [subject] [session] [method]\n";
+        return 1;
+    }
+    try {
+        av_speech_in_noise::ResultsStore store;
+        av_speech_in_noise::readResultsStores(store, gsl::at(arguments, 1));
+        const av_speech_in_noise::ResultsQuery query{argument(arguments, 2),
+            argument(arguments, 3), argument(arguments, 4)};
+        std::unordered_map<std::string, TestTrials> trialsOfTest;
+        for (const auto &trial : store.trials(query)) {
+            auto &counts{trialsOfTest[trial.test]};
+            ++counts.trials;
+            if (trial.correct) {
+                ++counts.evaluated;
+                if (*trial.correct)
+                    ++counts.correct;
+            }
+        }
+        std::unordered_map<std::string, std::vector<double>> thresholdsOfTest;
+        for (const auto &threshold : store.thresholds(query))
+            thresholdsOfTest[threshold.test].push_back(threshold.threshold);
+        std::cout << "subject\ttester\tsession\tmethod\ttargets\t"
+                     "masker level (dB SPL)\tcondition\tstarting SNR (dB)\t"
+                     "tracking rule\ttrials\tpercent correct\tthresholds\n";
+        for (const auto &test : store.tests(query)) {
+            std::cout << test.identity.subjectId << '\t'
+                      << test.identity.testerId << '\t'
+                      << test.identity.session << '\t'
+                      << test.identity.method << '\t' << test.targetsUrl.path
+                      << '\t' << test.maskerLevel.dB_SPL << '\t'
+                      << name(test.condition) << '\t' << test.startingSnr.dB
+                      << '\t';
+            writeTrackingRule(std::cout, test.trackingRule);
+            const auto counts{trialsOfTest[test.id]};
+            std::cout << '\t' << counts.trials << '\t';
+            if (counts.evaluated != 0)
+                std::cout << 100. * counts.correct / counts.evaluated;
+            std::cout << '\t';
+            auto first{true};
+            for (const auto threshold : thresholdsOfTest[test.id]) {
+                if (!first)
+                    std::cout << "; ";
+                std::cout << threshold;
+                first = false;
+            }
+            std::cout << '\n';
+        }
+        if (!store.malformed().empty())
+            std::cerr << store.malformed().size() << " malformed records\n";
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include <av-speech-in-noise/core/OutputFileParser.hpp>
+#include <av-speech-in-noise/core/OutputFileReplay.hpp>
+#include <av-speech-in-noise/core/WorkStealing.hpp>
+#include <av-speech-in-noise/player/TrialRenderer.hpp>
+#include <av-speech-in-noise/player/WavFile.hpp>
+#include <av-speech-in-noise/ui/SessionController.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// Decodes each file once; later reads copy the decoded audio.
+class CachingWavReader : public av_speech_in_noise::AudioReader {
+  public:
+    auto read(std::string filePath) -> av_speech_in_noise::audio_type override {
+        return wav(filePath)->audio;
+    }
+
+    auto sampleRateHz(const std::string &filePath) -> double {
+        return wav(filePath)->sampleRateHz;
+    }
+
+  private:
+    auto wav(const std::string &filePath)
+        -> std::shared_ptr<const av_speech_in_noise::WavAudio> {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            const auto found{cache.find(filePath)};
+            if (found != cache.end())
+                return found->second;
+        }
+        std::ifstream stream{filePath, std::ios::binary};
+        if (!stream)
+            throw InvalidFile{};
+        auto decoded{std::make_shared<const av_speech_in_noise::WavAudio>(
+            av_speech_in_noise::readWav(stream))};
+        std::lock_guard<std::mutex> lock{mutex};
+        return cache.emplace(filePath, std::move(decoded)).first->second;
+    }
+
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<const av_speech_in_noise::WavAudio>>
+        cache;
+};
+
+struct Options {
+    std::filesystem::path wavDirectory;
+    std::vector<std::filesystem::path> outputFiles;
+    av_speech_in_noise::Duration rampDuration{0.02};
+    unsigned threads{std::max(1U, std::thread::hardware_concurrency())};
+    int trial{};
+};
+
+struct Job {
+    std::filesystem::path outputFile;
+    av_speech_in_noise::TrialStimulus stimulus;
+    int trialNumber{};
+};
+}
+
+static auto startsWith(const std::string &s, const std::string &prefix)
+    -> bool {
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+static auto value(const std::string &option) -> std::string {
+    return option.substr(option.find('=') + 1);
+}
+
+static auto options(gsl::span<char *> arguments) -> Options {
+    Options options;
+    options.wavDirectory = gsl::at(arguments, 1);
+    for (const std::string argument : arguments.subspan(2))
+        if (startsWith(argument, "threads="))
+            options.threads =
+                static_cast<unsigned>(std::stoul(value(argument)));
+        else if (startsWith(argument, "trial="))
+            options.trial = std::stoi(value(argument));
+        else if (startsWith(argument, "ramp="))
+            options.rampDuration.seconds = std::stod(value(argument));
+        else
+            options.outputFiles.emplace_back(argument);
+    return options;
+}
+
+static auto jobs(const Options &options) -> std::vector<Job> {
+    std::vector<Job> jobs;
+    for (const auto &file : options.outputFiles) {
+        const av_speech_in_noise::MappedFile mapped{file};
+        const auto session{
+            av_speech_in_noise::replayableSession(mapped.contents())};
+        for (const auto &trial : session.trials)
+            if (options.trial == 0 || options.trial == trial.trialNumber) {
+                Job job;
+                job.outputFile = file;
+                job.trialNumber = trial.trialNumber;
+                job.stimulus.masker = session.masker;
+                job.stimulus.target = trial.target;
+                job.stimulus.maskerSeekSeconds = trial.maskerSeekSeconds;
+                job.stimulus.maskerLevel = session.maskerLevel;
+                job.stimulus.fullScaleLevel =
+                    av_speech_in_noise::SessionControllerImpl::fullScaleLevel;
+                job.stimulus.snr = trial.snr;
+                jobs.push_back(job);
+            }
+    }
+    return jobs;
+}
+
+static auto wavPath(const Options &options, const Job &job)
+    -> std::filesystem::path {
+    return options.wavDirectory /
+        (job.outputFile.stem().string() + "-trial-" +
+            std::to_string(job.trialNumber) + ".wav");
+}
+
+static void render(CachingWavReader &reader, const Options &options,
+    const Job &job) {
+    const auto sampleRateHz{reader.sampleRateHz(job.stimulus.masker.path)};
+    if (reader.sampleRateHz(job.stimulus.target.path) != sampleRateHz)
+        throw std::runtime_error{"target and masker sample rates differ"};
+    const auto audio{av_speech_in_noise::render(
+        reader, sampleRateHz, options.rampDuration, job.stimulus)};
+    std::ofstream stream{wavPath(options, job), std::ios::binary};
+    av_speech_in_noise::writeWav(stream, audio, sampleRateHz);
+    if (!stream)
+        throw std::runtime_error{"unable to write"};
+}
+
+static auto failure(const Job &job, const std::string &reason)
+    -> std::string {
+    return job.outputFile.string() + " trial " +
+        std::to_string(job.trialNumber) + ": " + reason;
+}
+
+// Re-renders the trials logged in output files to one WAV file per trial,
+// mixing masker and target as they were presented.
+auto main(int argc, char *argv[]) -> int {
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    if (arguments.size() < 3) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " <WAV directory> <output file>... [threads=] [trial=] "
+                     "[ramp=]\n";
+        return 1;
+    }
+    try {
+        const auto parsed{options(arguments)};
+        std::filesystem::create_directories(parsed.wavDirectory);
+        const auto toRender{jobs(parsed)};
+        std::vector<std::string> failures(toRender.size());
+        CachingWavReader reader;
+        av_speech_in_noise::runWorkStealing(
+            gsl::narrow<gsl::index>(toRender.size()), parsed.threads,
+            [&](gsl::index i) {
+                const auto &job{toRender.at(i)};
+                try {
+                    render(reader, parsed, job);
+                } catch (const std::exception &e) {
+                    failures.at(i) = failure(job, e.what());
+                } catch (const av_speech_in_noise::AudioReader::InvalidFile
+                        &) {
+                    failures.at(i) = failure(job, "unable to decode audio");
+                }
+            });
+        auto failed{false};
+        for (const auto &f : failures)
+            if (!f.empty()) {
+                std::cerr << f << '\n';
+                failed = true;
+            }
+        std::cout << "rendered "
+                  << std::count(failures.begin(), failures.end(), "")
+                  << " of " << toRender.size() << " trials\n";
+        return failed ? 1 : 0;
+    } catch (const av_speech_in_noise::MappedFile::OpenFailure &) {
+        std::cerr << "unable to read an output file\n";
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+    }
+    return 1;
+}
@@ -0,0 +1,543 @@
+#include <av-speech-in-noise/core/AdaptiveMethod.hpp>
+#include <av-speech-in-noise/core/AdaptiveTrack.hpp>
+#include <av-speech-in-noise/core/FixedLevelMethod.hpp>
+#include <av-speech-in-noise/core/OfflinePlayers.hpp>
+#include <av-speech-in-noise/core/OutputFile.hpp>
+#include <av-speech-in-noise/core/PsiTrack.hpp>
+#include <av-speech-in-noise/core/ResponseEvaluator.hpp>
+#include <av-speech-in-noise/core/RunningATest.hpp>
+#include <av-speech-in-noise/core/SimulatedSession.hpp>
+#include <av-speech-in-noise/core/SubmittingFixedPassFail.hpp>
+#include <av-speech-in-noise/core/SubmittingFreeResponse.hpp>
+#include <av-speech-in-noise/core/SubmittingNumberKeywords.hpp>
+#include <av-speech-in-noise/core/SubmittingPassFail.hpp>
+#include <av-speech-in-noise/core/Tracing.hpp>
+#include <av-speech-in-noise/core/WorkStealing.hpp>
+#include <av-speech-in-noise/player/AudioLevels.hpp>
+#include <av-speech-in-noise/player/WavFile.hpp>
+#include <av-speech-in-noise/playlist/FileFilterDecorator.hpp>
+#include <av-speech-in-noise/playlist/PredeterminedTargetPlaylist.hpp>
+#include <av-speech-in-noise/playlist/RandomizedTargetPlaylists.hpp>
+#include <av-speech-in-noise/playlist/SubdirectoryTargetPlaylistReader.hpp>
+#include <av-speech-in-noise/ui/TestSettingsInterpreter.hpp>
+
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace av_speech_in_noise {
+namespace {
+struct Options {
+    std::string settings;
+    std::filesystem::path output;
+    std::filesystem::path trace;
+    PsychometricFunction listener;
+    gsl::index sessions{1};
+    gsl::index maximumTrials{1000};
+    unsigned threads{std::max(1U, std::thread::hardware_concurrency())};
+    std::uint64_t seed{};
+};
+
+struct Outcome {
+    SimulatedSessionResult result;
+    std::string error;
+};
+
+class FileSystemDirectoryReader : public DirectoryReader {
+  public:
+    auto filesIn(const LocalUrl &directory) -> LocalUrls override {
+        return entries(directory, false);
+    }
+
+    auto subDirectories(const LocalUrl &directory) -> LocalUrls override {
+        return entries(directory, true);
+    }
+
+  private:
+    static auto entries(const LocalUrl &directory, bool directories)
+        -> LocalUrls {
+        std::error_code error;
+        std::filesystem::directory_iterator entry{directory.path, error};
+        if (error)
+            throw CannotRead{error.message()};
+        LocalUrls names;
+        for (const auto &e : entry)
+            if (e.is_directory() == directories)
+                names.push_back({e.path().filename().string()});
+        std::sort(names.begin(), names.end(),
+            [](const LocalUrl &a, const LocalUrl &b) {
+                return a.path < b.path;
+            });
+        return names;
+    }
+};
+
+class FileTextReader : public TextFileReader {
+  public:
+    auto read(const LocalUrl &url) -> std::string override {
+        std::ifstream file{url.path};
+        if (!file)
+            throw FileDoesNotExist{};
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return stream.str();
+    }
+};
+
+class ExistingTargets : public TargetValidator {
+  public:
+    auto isValid(const LocalUrl &url) -> bool override {
+        return std::filesystem::is_regular_file(url.path);
+    }
+};
+
+// Each file is read once however many sessions play it.
+class WavStimulusDescriptions : public StimulusDescriptions {
+  public:
+    auto describe(const LocalUrl &url) -> StimulusDescription override {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            const auto found{descriptions.find(url.path)};
+            if (found != descriptions.end())
+                return found->second;
+        }
+        const auto description{read(url)};
+        std::lock_guard<std::mutex> lock{mutex};
+        descriptions.emplace(url.path, description);
+        return description;
+    }
+
+  private:
+    static auto read(const LocalUrl &url) -> StimulusDescription {
+        std::ifstream file{url.path, std::ios::binary};
+        if (!file)
+            throw InvalidAudioFile{};
+        try {
+            const auto wav{readWav(file)};
+            if (wav.audio.empty() || wav.sampleRateHz <= 0)
+                throw InvalidAudioFile{};
+            return {Duration{static_cast<double>(wav.audio.front().size()) /
+                        wav.sampleRateHz},
+                levels(wav.audio).rms};
+        } catch (const AudioReader::InvalidFile &) {
+            throw InvalidAudioFile{};
+        }
+    }
+
+    std::map<std::string, StimulusDescription> descriptions;
+    std::mutex mutex;
+};
+
+class SeededRandomizer : public Randomizer {
+  public:
+    explicit SeededRandomizer(std::uint64_t seed) : engine{seed} {}
+
+    auto betweenInclusive(double a, double b) -> double override {
+        return std::uniform_real_distribution<>{a, b}(engine);
+    }
+
+    auto betweenInclusive(int a, int b) -> int override {
+        return std::uniform_int_distribution<>{a, b}(engine);
+    }
+
+  private:
+    std::mt19937_64 engine;
+};
+
+class FileWriter : public Writer {
+  public:
+    void write(const std::string &s) override { file << s; }
+    void write(Writable &writable) override { writable.write(file); }
+    void open(const std::string &s) override { file.open(s); }
+    auto failed() -> bool override { return file.fail(); }
+    void close() override { file.close(); }
+    void save() override { file.flush(); }
+
+  private:
+    std::ofstream file;
+};
+
+// Still formats every line so the output path costs what it does in a
+// real session.
+class DiscardingWriter : public Writer {
+  public:
+    void write(const std::string &) override {}
+    void write(Writable &writable) override {
+        stream.str({});
+        writable.write(stream);
+    }
+    void open(const std::string &) override {}
+    auto failed() -> bool override { return false; }
+    void close() override {}
+    void save() override {}
+
+  private:
+    std::stringstream stream;
+};
+
+class SessionOutputFilePath : public OutputFilePath {
+  public:
+    SessionOutputFilePath(std::filesystem::path directory, gsl::index session)
+        : directory{std::move(directory)}, session{session} {}
+
+    auto generateFileName(const TestIdentity &) -> std::string override {
+        return "session-" + std::to_string(session);
+    }
+
+    auto outputDirectory() -> std::string override {
+        return directory.string();
+    }
+
+    void setRelativeOutputDirectory(std::filesystem::path) override {}
+
+  private:
+    std::filesystem::path directory;
+    gsl::index session;
+};
+
+enum class Stream : std::uint32_t {
+    maskerSeek,
+    listener,
+    playlists,
+    subdirectories
+};
+
+// Independent seeds for each session and each use within it.
+static auto seed(const Options &options, gsl::index session, Stream stream)
+    -> std::uint64_t {
+    std::seed_seq sequence{static_cast<std::uint32_t>(options.seed),
+        static_cast<std::uint32_t>(options.seed >> 32U),
+        static_cast<std::uint32_t>(session),
+        static_cast<std::uint32_t>(stream)};
+    std::array<std::uint32_t, 2> words{};
+    sequence.generate(words.begin(), words.end());
+    return (std::uint64_t{words[0]} << 32U) | words[1];
+}
+
+// Everything one session needs, wired as the application wires it but
+// with offline players and virtual time.
+class Session {
+  public:
+    Session(const Options &options, StimulusDescriptions &stimuli,
+        gsl::index index)
+        : targetPlayer{time, stimuli}, maskerPlayer{time, stimuli},
+          outputFilePath{options.output, index},
+          writer{makeWriter(options)},
+          outputFile{*writer, outputFilePath},
+          randomizer{seed(options, index, Stream::maskerSeek)},
+          listener{options.listener, seed(options, index, Stream::listener)},
+          playlistRandomizer{seed(options, index, Stream::playlists), 0},
+          targetsWithReplacementFactory{
+              &wavFiles, seed(options, index, Stream::subdirectories)},
+          cyclicTargetsFactory{
+              &wavFiles, seed(options, index, Stream::subdirectories)} {}
+
+    auto run(const Options &options) -> SimulatedSessionResult {
+        const auto responder{initialize(
+            TestSettingsInterpreterImpl::method(options.settings),
+            options.settings)};
+        SimulatedSession session{model, time, *responder};
+        AudioSettings audioSettings;
+        audioSettings.audioDevice = OfflineMaskerPlayer::audioDevice;
+        return session.run(audioSettings, options.maximumTrials);
+    }
+
+  private:
+    static auto makeWriter(const Options &options) -> std::unique_ptr<Writer> {
+        if (options.output.empty())
+            return std::make_unique<DiscardingWriter>();
+        return std::make_unique<FileWriter>();
+    }
+
+    auto initialize(Method method, const std::string &settings)
+        -> std::unique_ptr<SimulatedResponder> {
+        switch (method) {
+        case Method::adaptivePassFail:
+            initialize(adaptiveMethod, settings, targetsWithReplacementReader);
+            return std::make_unique<submitting_pass_fail::SimulatedResponder>(
+                passFail, adaptiveMethod, listener);
+        case Method::adaptiveCoordinateResponseMeasure:
+            initialize(adaptiveMethod, settings, targetsWithReplacementReader);
+            return std::make_unique<
+                coordinate_response_measure::SimulatedResponder>(
+                model, adaptiveMethod, evaluator, listener);
+        case Method::adaptiveCorrectKeywords:
+            initialize(adaptiveMethod, settings, cyclicTargetsReader);
+            return std::make_unique<
+                submitting_number_keywords::SimulatedResponder>(
+                numberKeywords, adaptiveMethod, listener);
+        case Method::fixedLevelFreeResponseWithAllTargets:
+            initialize(fixedLevelMethod, settings, everyTargetOnce);
+            return freeResponseResponder();
+        case Method::fixedLevelFreeResponseWithPredeterminedTargets:
+            initialize(fixedLevelMethod, settings, predeterminedTargets);
+            return freeResponseResponder();
+        case Method::fixedLevelPassFailWithPredeterminedTargets:
+            initialize(fixedLevelMethod, settings, predeterminedTargets);
+            return std::make_unique<
+                submitting_fixed_pass_fail::SimulatedResponder>(
+                fixedPassFail, fixedLevelMethod, listener);
+        case Method::fixedLevelFreeResponseWithTargetReplacement:
+            initializeWithReplacement(settings);
+            return freeResponseResponder();
+        case Method::fixedLevelCoordinateResponseMeasureWithTargetReplacement:
+            initializeWithReplacement(settings);
+            return std::make_unique<
+                coordinate_response_measure::SimulatedResponder>(
+                model, fixedLevelMethod, evaluator, listener);
+        default:
+            throw std::runtime_error{
+                std::string{"No simulated listener for "} + name(method)};
+        }
+    }
+
+    void initialize(AdaptiveMethod &method, const std::string &settings,
+        TargetPlaylistReader &reader) {
+        const auto test{TestSettingsInterpreterImpl::adaptiveTest(settings)};
+        if (test.trackAlgorithm == TrackAlgorithm::psi)
+            method.initialize(test, &reader, psiTrackFactory);
+        else
+            method.initialize(test, &reader, staircaseTrackFactory);
+        model.initialize(&method, test, {});
+    }
+
+    void initialize(FixedLevelMethod &method, const std::string &settings,
+        FiniteTargetPlaylistWithRepeatables &targets) {
+        const auto test{TestSettingsInterpreterImpl::fixedLevelTest(settings)};
+        method.initialize(test, &targets);
+        model.initialize(&method, test, {});
+    }
+
+    void initializeWithReplacement(const std::string &settings) {
+        FixedLevelFixedTrialsTest test;
+        static_cast<FixedLevelTest &>(test) =
+            TestSettingsInterpreterImpl::fixedLevelTest(settings);
+        if (test.compileTrialPlan)
+            targetsWithReplacement.seed(test.trialPlanSeed);
+        fixedLevelMethod.initialize(test, &targetsWithReplacement);
+        model.initialize(&fixedLevelMethod, test, {});
+    }
+
+    auto freeResponseResponder() -> std::unique_ptr<SimulatedResponder> {
+        return std::make_unique<submitting_free_response::SimulatedResponder>(
+            freeResponse, fixedLevelMethod, listener);
+    }
+
+    VirtualTime time;
+    OfflineTargetPlayer targetPlayer;
+    OfflineMaskerPlayer maskerPlayer;
+    SessionOutputFilePath outputFilePath;
+    std::unique_ptr<Writer> writer;
+    OutputFileImpl outputFile;
+    ResponseEvaluatorImpl evaluator;
+    SeededRandomizer randomizer;
+    SimulatedListener listener;
+    RunningATestImpl model{
+        targetPlayer, maskerPlayer, outputFile, randomizer, time};
+    adaptive_track::AdaptiveTrack::Factory staircaseTrackFactory;
+    PsiTrack::Factory psiTrackFactory;
+    AdaptiveMethodImpl adaptiveMethod{evaluator, randomizer};
+    FixedLevelMethodImpl fixedLevelMethod{evaluator};
+    FileSystemDirectoryReader directoryReader;
+    FileExtensionFilter wavFilter{{".wav"}};
+    FileFilterDecorator wavFiles{&directoryReader, &wavFilter};
+    target_list::SeededRandomizer playlistRandomizer;
+    RandomizedTargetPlaylistWithReplacement::Factory
+        targetsWithReplacementFactory;
+    SubdirectoryTargetPlaylistReader targetsWithReplacementReader{
+        &targetsWithReplacementFactory, &wavFiles};
+    CyclicRandomizedTargetPlaylist::Factory cyclicTargetsFactory;
+    SubdirectoryTargetPlaylistReader cyclicTargetsReader{
+        &cyclicTargetsFactory, &wavFiles};
+    RandomizedTargetPlaylistWithoutReplacement everyTargetOnce{
+        &wavFiles, &playlistRandomizer};
+    RandomizedTargetPlaylistWithReplacement targetsWithReplacement{
+        &wavFiles, &playlistRandomizer};
+    FileTextReader textFileReader;
+    ExistingTargets targetValidator;
+    PredeterminedTargetPlaylist predeterminedTargets{
+        textFileReader, targetValidator};
+    submitting_pass_fail::InteractorImpl passFail{
+        adaptiveMethod, model, outputFile};
+    submitting_number_keywords::InteractorImpl numberKeywords{
+        adaptiveMethod, model, outputFile};
+    submitting_free_response::InteractorImpl freeResponse{
+        fixedLevelMethod, model, outputFile};
+    submitting_fixed_pass_fail::InteractorImpl fixedPassFail{
+        fixedLevelMethod, model, outputFile};
+};
+}
+
+static auto contents(const std::string &path) -> std::string {
+    std::ifstream file{path};
+    if (!file)
+        throw std::runtime_error{"Unable to read " + path};
+    std::stringstream stream;
+    stream << file.rdbuf();
+    return stream.str();
+}
+
+static void assign(Options &options, const std::string &option) {
+    const auto equals{option.find('=')};
+    if (equals == std::string::npos)
+        throw std::runtime_error{"Expected name=value: " + option};
+    const auto name{option.substr(0, equals)};
+    const auto value{option.substr(equals + 1)};
+    if (name == "threshold")
+        options.listener.threshold = std::stod(value);
+    else if (name == "slope")
+        options.listener.slope = std::stod(value);
+    else if (name == "guess")
+        options.listener.guessRate = std::stod(value);
+    else if (name == "lapse")
+        options.listener.lapseRate = std::stod(value);
+    else if (name == "sessions")
+        options.sessions = std::stol(value);
+    else if (name == "trials")
+        options.maximumTrials = std::stol(value);
+    else if (name == "threads")
+        options.threads = static_cast<unsigned>(std::stoul(value));
+    else if (name == "seed")
+        options.seed = std::stoull(value);
+    else if (name == "output")
+        options.output = value;
+    else if (name == "trace")
+        options.trace = value;
+    else
+        throw std::runtime_error{"Unknown option: " + name};
+}
+
+static auto percentile(const std::vector<double> &sorted, double p) -> double {
+    if (sorted.empty())
+        return 0;
+    const auto rank{std::min(sorted.size() - 1,
+        static_cast<std::size_t>(p * static_cast<double>(sorted.size())))};
+    return sorted.at(rank);
+}
+
+static auto microseconds(double seconds) -> double { return seconds * 1e6; }
+
+static void report(const std::vector<Outcome> &outcomes, double wallSeconds,
+    std::ostream &out) {
+    gsl::index trials{};
+    gsl::index complete{};
+    gsl::index failed{};
+    auto virtualSeconds{0.};
+    std::vector<double> latencies;
+    for (const auto &outcome : outcomes) {
+        if (!outcome.error.empty()) {
+            ++failed;
+            continue;
+        }
+        trials += outcome.result.trials;
+        complete += outcome.result.complete ? 1 : 0;
+        virtualSeconds += outcome.result.virtualDuration.seconds;
+        latencies.insert(latencies.end(),
+            outcome.result.interTrialSeconds.begin(),
+            outcome.result.interTrialSeconds.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto mean{latencies.empty()
+            ? 0.
+            : std::accumulate(latencies.begin(), latencies.end(), 0.) /
+                static_cast<double>(latencies.size())};
+    out << "sessions\t" << outcomes.size() << '\n'
+        << "complete sessions\t" << complete << '\n'
+        << "failed sessions\t" << failed << '\n'
+        << "trials\t" << trials << '\n'
+        << "wall seconds\t" << wallSeconds << '\n'
+        << "virtual seconds\t" << virtualSeconds << '\n'
+        << "speed-up\t" << virtualSeconds / wallSeconds << '\n'
+        << "trials per second\t" << static_cast<double>(trials) / wallSeconds
+        << '\n'
+        << "inter-trial mean (us)\t" << microseconds(mean) << '\n'
+        << "inter-trial p50 (us)\t" << microseconds(percentile(latencies, .5))
+        << '\n'
+        << "inter-trial p99 (us)\t" << microseconds(percentile(latencies, .99))
+        << '\n'
+        << "inter-trial max (us)\t"
+        << microseconds(latencies.empty() ? 0. : latencies.back()) << '\n';
+}
+}
+
+// Runs complete sessions of the test a settings file describes against
+// simulated listeners on virtual time and reports throughput and the wall
+// time of the inter-trial path. Sessions run in parallel, each on its own
+// objects; only stimulus descriptions are shared.
+auto main(int argc, char *argv[]) -> int {
+    using namespace av_speech_in_noise;
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    if (arguments.size() < 2) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " <test settings file> [sessions=] [threads=] [seed=] "
+                     "[trials=] [output=] [trace=] [threshold=] [slope=] "
+                     "[guess=] [lapse=]\n";
+        return 1;
+    }
+    try {
+        Options options;
+        options.settings = contents(gsl::at(arguments, 1));
+        for (const auto *option : arguments.subspan(2))
+            assign(options, option);
+        if (!options.output.empty())
+            std::filesystem::create_directories(options.output);
+        if (!options.trace.empty())
+            tracing::enable();
+        WavStimulusDescriptions stimuli;
+        std::vector<Outcome> outcomes(options.sessions);
+        const auto start{std::chrono::steady_clock::now()};
+        runWorkStealing(options.sessions, options.threads, [&](gsl::index i) {
+            auto &outcome{outcomes.at(i)};
+            try {
+                Session session{options, stimuli, i};
+                outcome.result = session.run(options);
+            } catch (const TargetPlaylist::LoadFailure &) {
+                outcome.error = "unable to load targets";
+            } catch (const std::exception &e) {
+                outcome.error = e.what();
+            } catch (...) {
+                outcome.error = "unknown error";
+            }
+        });
+        const auto wallSeconds{std::chrono::duration<double>{
+            std::chrono::steady_clock::now() - start}
+                                   .count()};
+        for (gsl::index i{0}; i < options.sessions; ++i)
+            if (!outcomes.at(i).error.empty())
+                std::cerr << "session " << i << ": " << outcomes.at(i).error
+                          << '\n';
+        report(outcomes, wallSeconds, std::cout);
+        if (!options.trace.empty()) {
+            tracing::disable();
+            std::ofstream trace{options.trace};
+            tracing::write(trace);
+            if (tracing::dropped() != 0)
+                std::cerr << tracing::dropped()
+                          << " trace events dropped from full buffers\n";
+        }
+        return std::any_of(outcomes.begin(), outcomes.end(),
+                   [](const Outcome &o) { return !o.error.empty(); })
+            ? 1
+            : 0;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
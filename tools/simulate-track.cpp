@@ -0,0 +1,111 @@
+#include <av-speech-in-noise/core/AdaptiveTrack.hpp>
+#include <av-speech-in-noise/core/AdaptiveTrackSimulation.hpp>
+#include <av-speech-in-noise/core/PsiTrack.hpp>
+#include <av-speech-in-noise/ui/TestSettingsInterpreter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+static auto contents(const std::string &path) -> std::string {
+    std::ifstream file{path};
+    if (!file)
+        throw std::runtime_error{"Unable to read " + path};
+    std::stringstream stream;
+    stream << file.rdbuf();
+    return stream.str();
+}
+
+namespace {
+struct Options {
+    av_speech_in_noise::AdaptiveTrackSimulationSettings settings;
+    bool psi{};
+};
+}
+
+static void assign(Options &options, const std::string &option) {
+    auto &s{options.settings};
+    const auto equals{option.find('=')};
+    if (equals == std::string::npos)
+        throw std::runtime_error{"Expected name=value: " + option};
+    const auto name{option.substr(0, equals)};
+    const auto value{option.substr(equals + 1)};
+    if (name == "threshold")
+        s.listener.threshold = std::stod(value);
+    else if (name == "slope")
+        s.listener.slope = std::stod(value);
+    else if (name == "guess")
+        s.listener.guessRate = std::stod(value);
+    else if (name == "lapse")
+        s.listener.lapseRate = std::stod(value);
+    else if (name == "tracks")
+        s.tracks = std::stol(value);
+    else if (name == "trials")
+        s.maximumTrialsPerTrack = std::stol(value);
+    else if (name == "threads")
+        s.threads = static_cast<unsigned>(std::stoul(value));
+    else if (name == "seed")
+        s.seed = std::stoull(value);
+    else if (name == "track" && (value == "psi" || value == "staircase"))
+        options.psi = value == "psi";
+    else
+        throw std::runtime_error{"Unknown option: " + name};
+}
+
+// Simulates many runs of the adaptive track described by a test settings
+// file against a logistic listener and reports threshold bias and spread.
+auto main(int argc, char *argv[]) -> int {
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    if (arguments.size() < 2) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " <test settings file> [threshold=] [slope=] [guess=] "
+                     "[lapse=] [tracks=] [trials=] [threads=] [seed=] "
+                     "[track=staircase|psi]\n";
+        return 1;
+    }
+    try {
+        Options options;
+        auto &settings{options.settings};
+        settings.threads = std::max(1U, std::thread::hardware_concurrency());
+        settings.test = av_speech_in_noise::TestSettingsInterpreterImpl::
+            adaptiveTest(contents(gsl::at(arguments, 1)));
+        options.psi = settings.test.trackAlgorithm ==
+            av_speech_in_noise::TrackAlgorithm::psi;
+        for (const auto *option : arguments.subspan(2))
+            assign(options, option);
+        if (options.psi)
+            settings.estimates =
+                av_speech_in_noise::SimulatedThreshold::listenerThreshold;
+        av_speech_in_noise::PsiTrackParameters psi;
+        psi.guessRate = settings.listener.guessRate;
+        psi.lapseRate = settings.listener.lapseRate;
+        av_speech_in_noise::PsiTrack::Factory psiFactory{psi};
+        adaptive_track::AdaptiveTrack::Factory staircaseFactory;
+        const auto result{av_speech_in_noise::simulate(options.psi
+                ? static_cast<av_speech_in_noise::Track::Factory &>(psiFactory)
+                : staircaseFactory,
+            settings)};
+        std::cout << "tracks\t" << result.tracks << '\n'
+                  << "incomplete tracks\t" << result.incompleteTracks << '\n'
+                  << "convergence level\t" << result.convergenceLevel << '\n'
+                  << "expected threshold\t" << result.expectedThreshold
+                  << '\n'
+                  << "mean threshold\t" << result.meanThreshold << '\n'
+                  << "bias\t" << result.bias << '\n'
+                  << "threshold SD\t" << std::sqrt(result.thresholdVariance)
+                  << '\n'
+                  << "mean trials\t" << result.meanTrials << '\n'
+                  << "trials SD\t" << result.trialsStandardDeviation << '\n'
+                  << "maximum trials\t" << result.maximumTrials << '\n';
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include <av-speech-in-noise/core/OutputFileParser.hpp>
+#include <av-speech-in-noise/core/OutputFileSummary.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+
+// Writes a table summarizing every test of every output file below a
+// directory.
+auto main(int argc, char *argv[]) -> int {
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    if (arguments.size() < 2 || arguments.size() > 3) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " <output directory> [threads]\n";
+        return 1;
+    }
+    try {
+        const auto threads{arguments.size() == 3
+                ? static_cast<unsigned>(std::stoul(gsl::at(arguments, 2)))
+                : std::max(1U, std::thread::hardware_concurrency())};
+        av_speech_in_noise::writeSummaryTable(std::cout,
+            av_speech_in_noise::summarize(gsl::at(arguments, 1), threads));
+    } catch (const av_speech_in_noise::MappedFile::OpenFailure &) {
+        std::cerr << "unable to read an output file\n";
+        return 1;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,349 @@
+#include <av-speech-in-noise/core/WorkStealing.hpp>
+#include <av-speech-in-noise/player/AudioLevels.hpp>
+#include <av-speech-in-noise/player/WavFile.hpp>
+#include <av-speech-in-noise/ui/SessionController.hpp>
+#include <av-speech-in-noise/ui/TestSettingsInterpreter.hpp>
+
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Problem {
+    std::string kind;
+    std::string message;
+    std::string path;
+    std::optional<double> headroomDb;
+};
+
+struct Protocol {
+    std::filesystem::path file;
+    std::string method;
+    std::vector<Problem> problems;
+    std::string masker;
+    std::vector<std::string> targets;
+    av_speech_in_noise::RealLevel maskerLevel{};
+    av_speech_in_noise::RealLevel fullScaleLevel{};
+    av_speech_in_noise::SNR loudestSnr{};
+    bool loaded{};
+};
+
+struct Analysis {
+    std::optional<av_speech_in_noise::AudioLevels> levels;
+    std::string error;
+};
+
+struct Options {
+    std::vector<std::filesystem::path> files;
+    unsigned threads{std::max(1U, std::thread::hardware_concurrency())};
+};
+}
+
+static auto startsWith(const std::string &s, const std::string &prefix)
+    -> bool {
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+static auto options(gsl::span<char *> arguments) -> Options {
+    Options options;
+    for (const std::string argument : arguments.subspan(1))
+        if (startsWith(argument, "threads="))
+            options.threads = static_cast<unsigned>(
+                std::stoul(argument.substr(argument.find('=') + 1)));
+        else
+            options.files.emplace_back(argument);
+    return options;
+}
+
+static auto contents(const std::filesystem::path &path) -> std::string {
+    std::ifstream file{path};
+    if (!file)
+        throw std::runtime_error{"unable to read " + path.string()};
+    std::stringstream stream;
+    stream << file.rdbuf();
+    return stream.str();
+}
+
+static auto lowercase(std::string s) -> std::string {
+    std::transform(s.begin(), s.end(), s.begin(),
+        [](unsigned char c) { return std::tolower(c); });
+    return s;
+}
+
+static auto extension(const std::filesystem::path &path) -> std::string {
+    return lowercase(path.extension().string());
+}
+
+static auto isTarget(const std::filesystem::path &path) -> bool {
+    const auto e{extension(path)};
+    return path.filename().string().front() != '.' &&
+        (e == ".mov" || e == ".avi" || e == ".wav" || e == ".mp4");
+}
+
+static auto trim(const std::string &s) -> std::string {
+    const auto first{s.find_first_not_of(" \r")};
+    if (first == std::string::npos)
+        return "";
+    return s.substr(first, s.find_last_not_of(" \r") - first + 1);
+}
+
+// A directory, searched as the playlists search it, or a text file of one
+// target per line as PredeterminedTargetPlaylist reads it.
+static auto targets(const std::filesystem::path &path)
+    -> std::vector<std::string> {
+    std::vector<std::string> found;
+    if (std::filesystem::is_directory(path)) {
+        for (const auto &entry :
+            std::filesystem::recursive_directory_iterator{path})
+            if (entry.is_regular_file() && isTarget(entry.path()))
+                found.push_back(entry.path().string());
+        std::sort(found.begin(), found.end());
+    } else {
+        std::stringstream stream{contents(path)};
+        for (std::string line; std::getline(stream, line);)
+            if (!trim(line).empty())
+                found.push_back(trim(line));
+    }
+    return found;
+}
+
+static void problem(Protocol &protocol, std::string kind, std::string message,
+    std::string path = {}, std::optional<double> headroomDb = {}) {
+    protocol.problems.push_back({std::move(kind), std::move(message),
+        std::move(path), headroomDb});
+}
+
+static void load(Protocol &protocol) {
+    using av_speech_in_noise::TestSettingsInterpreterImpl;
+    const auto settings{contents(protocol.file)};
+    for (const auto &error : TestSettingsInterpreterImpl::errors(settings))
+        problem(protocol, "settings", error);
+    av_speech_in_noise::Test test;
+    try {
+        switch (TestSettingsInterpreterImpl::method(settings)) {
+        case av_speech_in_noise::Method::adaptivePassFail:
+        case av_speech_in_noise::Method::adaptiveCorrectKeywords:
+        case av_speech_in_noise::Method::adaptiveCoordinateResponseMeasure: {
+            const auto adaptive{
+                TestSettingsInterpreterImpl::adaptiveTest(settings)};
+            protocol.loudestSnr = adaptive.ceilingSnr;
+            test = adaptive;
+            break;
+        }
+        default: {
+            const auto fixedLevel{
+                TestSettingsInterpreterImpl::fixedLevelTest(settings)};
+            protocol.loudestSnr = fixedLevel.snr;
+            test = fixedLevel;
+        }
+        }
+    } catch (const std::runtime_error &) {
+        return;
+    }
+    protocol.method = test.identity.method;
+    protocol.maskerLevel = test.maskerLevel;
+    protocol.fullScaleLevel = test.fullScaleLevel;
+    protocol.masker = test.maskerFileUrl.path;
+    if (!protocol.masker.empty() &&
+        !std::filesystem::is_regular_file(protocol.masker))
+        problem(protocol, "missing", "masker does not exist", protocol.masker);
+    const auto &targetsPath{test.targetsUrl.path};
+    if (targetsPath.empty())
+        problem(protocol, "missing", "no targets");
+    else if (!std::filesystem::exists(targetsPath))
+        problem(protocol, "missing", "targets do not exist", targetsPath);
+    else
+        for (auto &target : targets(targetsPath))
+            if (std::filesystem::is_regular_file(target))
+                protocol.targets.push_back(std::move(target));
+            else
+                problem(protocol, "missing", "target does not exist", target);
+    protocol.loaded = true;
+}
+
+static auto analyze(const std::string &path) -> Analysis {
+    Analysis analysis;
+    if (extension(path) != ".wav")
+        return analysis;
+    std::ifstream stream{path, std::ios::binary};
+    try {
+        analysis.levels = av_speech_in_noise::levels(
+            av_speech_in_noise::readWav(stream).audio);
+    } catch (const av_speech_in_noise::AudioReader::InvalidFile &) {
+        analysis.error = "unable to decode";
+    }
+    return analysis;
+}
+
+static auto audible(const Analysis &a) -> bool {
+    return a.levels && std::isfinite(a.levels->rms.dBov);
+}
+
+// Scales as RunningATestImpl does: the masker to its level, the targets
+// relative to the masker by the loudest SNR the test can present.
+static void checkLevels(
+    Protocol &protocol, const std::map<std::string, Analysis> &analyses) {
+    std::optional<av_speech_in_noise::LevelAmplification> masker;
+    if (!protocol.masker.empty() &&
+        std::filesystem::is_regular_file(protocol.masker)) {
+        const auto &analysis{analyses.at(protocol.masker)};
+        if (!analysis.error.empty())
+            problem(protocol, "undecodable", analysis.error, protocol.masker);
+        else if (analysis.levels && !audible(analysis))
+            problem(protocol, "silent", "masker is silent", protocol.masker);
+        else if (analysis.levels) {
+            masker = av_speech_in_noise::LevelAmplification{
+                protocol.maskerLevel.dB_SPL - protocol.fullScaleLevel.dB_SPL -
+                analysis.levels->rms.dBov};
+            const auto headroom{
+                av_speech_in_noise::headroom(analysis.levels->peak, *masker)};
+            if (headroom < 0)
+                problem(protocol, "clips", "masker clips at its level",
+                    protocol.masker, headroom);
+        }
+    }
+    for (const auto &target : protocol.targets) {
+        const auto &analysis{analyses.at(target)};
+        if (!analysis.error.empty())
+            problem(protocol, "undecodable", analysis.error, target);
+        else if (masker && analysis.levels) {
+            const auto headroom{av_speech_in_noise::headroom(
+                analysis.levels->peak,
+                av_speech_in_noise::LevelAmplification{
+                    masker->dB + protocol.loudestSnr.dB})};
+            if (headroom < 0)
+                problem(protocol, "clips",
+                    "target clips at " +
+                        std::to_string(protocol.loudestSnr.dB) + " dB SNR",
+                    target, headroom);
+        }
+    }
+}
+
+static auto unchecked(
+    const Protocol &protocol, const std::map<std::string, Analysis> &analyses)
+    -> gsl::index {
+    return std::count_if(protocol.targets.begin(), protocol.targets.end(),
+        [&](const std::string &target) {
+            const auto &analysis{analyses.at(target)};
+            return !analysis.levels && analysis.error.empty();
+        });
+}
+
+static auto json(const std::string &s) -> std::string {
+    std::stringstream stream;
+    stream << '"';
+    for (const auto c : s)
+        if (c == '"' || c == '\\')
+            stream << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << static_cast<int>(c) << std::dec;
+        else
+            stream << c;
+    stream << '"';
+    return stream.str();
+}
+
+static void report(std::ostream &stream, const std::vector<Protocol> &protocols,
+    const std::map<std::string, Analysis> &analyses) {
+    stream << "{\"protocols\": [";
+    auto invalid{0};
+    for (std::size_t i{0}; i < protocols.size(); ++i) {
+        const auto &protocol{protocols.at(i)};
+        invalid += protocol.problems.empty() ? 0 : 1;
+        stream << (i == 0 ? "\n" : ",\n") << "  {\"file\": "
+               << json(protocol.file.string())
+               << ", \"method\": " << json(protocol.method)
+               << ", \"valid\": "
+               << (protocol.problems.empty() ? "true" : "false")
+               << ", \"targets\": " << protocol.targets.size()
+               << ", \"uncheckedTargets\": " << unchecked(protocol, analyses)
+               << ", \"problems\": [";
+        for (std::size_t j{0}; j < protocol.problems.size(); ++j) {
+            const auto &p{protocol.problems.at(j)};
+            stream << (j == 0 ? "" : ", ") << "{\"kind\": " << json(p.kind)
+                   << ", \"message\": " << json(p.message);
+            if (!p.path.empty())
+                stream << ", \"path\": " << json(p.path);
+            if (p.headroomDb)
+                stream << ", \"headroomDb\": " << *p.headroomDb;
+            stream << '}';
+        }
+        stream << "]}";
+    }
+    stream << "\n], \"valid\": " << protocols.size() - invalid
+           << ", \"invalid\": " << invalid << "}\n";
+}
+
+// Checks test settings files before a study: every setting parses, every
+// masker and target exists, WAV stimuli decode, and neither the masker at
+// its level nor a target at the loudest SNR the test can present clips.
+// Other formats are only checked for existence. Writes a JSON report.
+auto main(int argc, char *argv[]) -> int {
+    const gsl::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+    if (arguments.size() < 2) {
+        std::cerr << "usage: " << gsl::at(arguments, 0)
+                  << " <test settings file>... [threads=]\n";
+        return 1;
+    }
+    try {
+        const auto parsed{options(arguments)};
+        std::vector<Protocol> protocols(parsed.files.size());
+        av_speech_in_noise::runWorkStealing(
+            gsl::narrow<gsl::index>(protocols.size()), parsed.threads,
+            [&](gsl::index i) {
+                auto &protocol{protocols.at(i)};
+                protocol.file = parsed.files.at(i);
+                try {
+                    load(protocol);
+                } catch (const std::exception &e) {
+                    problem(protocol, "unreadable", e.what());
+                }
+            });
+
+        // Stimuli shared between protocols are decoded once.
+        std::map<std::string, Analysis> analyses;
+        for (const auto &protocol : protocols) {
+            if (!protocol.masker.empty() &&
+                std::filesystem::is_regular_file(protocol.masker))
+                analyses[protocol.masker];
+            for (const auto &target : protocol.targets)
+                analyses[target];
+        }
+        std::vector<std::map<std::string, Analysis>::iterator> pending;
+        for (auto it{analyses.begin()}; it != analyses.end(); ++it)
+            pending.push_back(it);
+        av_speech_in_noise::runWorkStealing(
+            gsl::narrow<gsl::index>(pending.size()), parsed.threads,
+            [&](gsl::index i) {
+                pending.at(i)->second = analyze(pending.at(i)->first);
+            });
+
+        for (auto &protocol : protocols)
+            if (protocol.loaded)
+                checkLevels(protocol, analyses);
+        report(std::cout, protocols, analyses);
+        return std::all_of(protocols.begin(), protocols.end(),
+                   [](const Protocol &p) { return p.problems.empty(); })
+            ? 0
+            : 1;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << '\n';
+    }
+    return 1;
+}